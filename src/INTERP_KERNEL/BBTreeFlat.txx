@@ -0,0 +1,301 @@
+// Copyright (C) 2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#pragma once
+
+#include "BBTree.txx"
+
+#include <vector>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstddef>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+/*!
+ * Linearized version of BBTree. The tree is split exactly as BBTree does (same median rule, same levels, same leaves) so
+ * that queries return the same elements in the same order, but :
+ * - the nodes are stored in one contiguous array in depth first order (the left child of a node is the next node),
+ * - the elements of all the leaves are stored in one shared index buffer, each leaf referring to a range of it,
+ * - the bounding boxes are copied in leaf order in a structure of arrays (all the xmin, then all the xmax, then all the ymin...),
+ *   so that the leaf box checks are done on contiguous memory, 4 boxes at a time when compiled with AVX2 support
+ *   (CMake option MEDCOUPLING_ENABLE_AVX2).
+ *
+ * Contrary to BBTree, the array of bounding boxes given at construction is not referenced anymore once the tree is built.
+ */
+template <int dim, class ConnType = int>
+class BBTreeFlat
+{
+private:
+  struct Node
+  {
+    //! for a leaf, range [_begin,_end) in _elems. For a non terminal node, _end is the id of the right child (left child is the next node).
+    ConnType _begin;
+    ConnType _end;
+    int _level;
+    bool _terminal;
+    double _max_left;
+    double _min_right;
+  };
+  std::vector<Node> _nodes;
+  std::vector<ConnType> _elems;
+  //! boxes in leaf order : [xmin_0..xmin_n-1, xmax_0..xmax_n-1, ymin_0..ymin_n-1, ...]
+  std::vector<double> _bb;
+  double _epsilon;
+
+  static const int MIN_NB_ELEMS=15;
+  static const int MAX_LEVEL=20;
+  //! maximal depth of the tree, used to size the traversal stacks
+  static const int MAX_DEPTH=MAX_LEVEL+2;
+public:
+  BBTreeFlat():_epsilon(BBTREE_DFT_EPSILON) { }
+  /*!
+    Constructor of the linearized bounding box tree. Parameters have the same meaning than for BBTree, so that BBTreeFlat can be
+    used in place of BBTree.
+    \param bbs pointer to the [xmin1 xmax1 ymin1 ymax1 xmin2 xmax2 ...] array containing the bounding boxes that are to be indexed.
+    \param elems array to the indices of the elements to index. If null, elements [0,nbelems) are indexed.
+    \param level level of the root of the tree.
+    \param nbelems nb of elements in the tree
+    \param epsilon precision to which points are decided to be coincident (see BBTree).
+  */
+  BBTreeFlat(const double* bbs, ConnType* elems, int level, ConnType nbelems, double epsilon=BBTREE_DFT_EPSILON):_epsilon(epsilon)
+  {
+    std::vector<ConnType> rootElems(nbelems);
+    for (ConnType i=0; i<nbelems; i++)
+      rootElems[i]=elems?elems[i]:i;
+    _elems.reserve(nbelems);
+    build(bbs,rootElems,level);
+    std::size_t nbOfLeafElems(_elems.size());
+    _bb.resize(2*dim*nbOfLeafElems);
+    for (std::size_t i=0; i<nbOfLeafElems; i++)
+      for (int idim=0; idim<dim; idim++)
+        {
+          _bb[(2*idim)*nbOfLeafElems+i]=bbs[_elems[i]*dim*2+idim*2];
+          _bb[(2*idim+1)*nbOfLeafElems+i]=bbs[_elems[i]*dim*2+idim*2+1];
+        }
+  }
+
+  /*! returns in \a elems the list of elements potentially intersecting the bounding box pointed to by \a bb
+    \param bb pointer to query bounding box
+    \param elems list of elements (given in 0-indexing that is to say in \b C \b mode) intersecting the bounding box
+  */
+  void getIntersectingElems(const double* bb, std::vector<ConnType>& elems) const
+  {
+    if (_nodes.empty())
+      return ;
+    std::size_t stack[MAX_DEPTH];
+    int stackSize(0);
+    std::size_t nodeId(0);
+    for(;;)
+      {
+        const Node& node(_nodes[nodeId]);
+        if (node._terminal)
+          {
+            intersectingElemsInLeaf(node,bb,elems);
+            if (stackSize==0)
+              return ;
+            nodeId=stack[--stackSize];
+            continue;
+          }
+        double min = bb[(node._level%dim)*2];
+        double max = bb[(node._level%dim)*2+1];
+        if (max < node._min_right)
+          nodeId++;
+        else if (min > node._max_left)
+          nodeId=node._end;
+        else
+          {
+            stack[stackSize++]=node._end;
+            nodeId++;
+          }
+      }
+  }
+
+  /*!
+   * Bulk version of getIntersectingElems for \a nbOfBoxes query boxes stored contiguously in \a bbs ([xmin1 xmax1 ymin1 ymax1 xmin2 ...]).
+   * The result is given in indirect indexing : elements intersecting the box \a i are elems[elemsIndex[i]:elemsIndex[i+1]].
+   * \a elems and \a elemsIndex are cleared first.
+   */
+  void getIntersectingElems(const double* bbs, ConnType nbOfBoxes, std::vector<ConnType>& elems, std::vector<ConnType>& elemsIndex) const
+  {
+    elems.clear();
+    elemsIndex.resize(nbOfBoxes+1);
+    elemsIndex[0]=0;
+    for (ConnType i=0; i<nbOfBoxes; i++)
+      {
+        getIntersectingElems(bbs+2*dim*i,elems);
+        elemsIndex[i+1]=(ConnType)elems.size();
+      }
+  }
+
+  /*!
+   * This method is very close to getIntersectingElems except that it returns number of elems instead of elems themselves.
+   */
+  ConnType getNbOfIntersectingElems(const double* bb) const
+  {
+    std::vector<ConnType> elems;
+    getIntersectingElems(bb,elems);
+    return (ConnType)elems.size();
+  }
+
+  /*! returns in \a elems the list of elements potentially containing the point pointed to by \a xx
+    \param xx pointer to query point coords
+    \param elems list of elements (given in 0-indexing) intersecting the bounding box
+  */
+  void getElementsAroundPoint(const double* xx, std::vector<ConnType>& elems) const
+  {
+    if (_nodes.empty())
+      return ;
+    std::size_t stack[MAX_DEPTH];
+    int stackSize(0);
+    std::size_t nodeId(0);
+    std::size_t nbOfLeafElems(_elems.size());
+    for(;;)
+      {
+        const Node& node(_nodes[nodeId]);
+        if (node._terminal)
+          {
+            for (ConnType i=node._begin; i<node._end; i++)
+              {
+                bool intersects = true;
+                for (int idim=0; idim<dim; idim++)
+                  {
+                    if (_bb[(2*idim)*nbOfLeafElems+i]-xx[idim]>_epsilon|| _bb[(2*idim+1)*nbOfLeafElems+i]-xx[idim]<-_epsilon)
+                      intersects=false;
+                  }
+                if (intersects)
+                  elems.push_back(_elems[i]);
+              }
+            if (stackSize==0)
+              return ;
+            nodeId=stack[--stackSize];
+            continue;
+          }
+        if (xx[node._level%dim] < node._min_right)
+          nodeId++;
+        else if (xx[node._level%dim] > node._max_left)
+          nodeId=node._end;
+        else
+          {
+            stack[stackSize++]=node._end;
+            nodeId++;
+          }
+      }
+  }
+
+  ConnType size() const { return (ConnType)_elems.size(); }
+
+private:
+  /*!
+   * Appends the node for \a elems at \a level (and recursively its children) to _nodes, splitting exactly as BBTree does.
+   */
+  void build(const double* bbs, const std::vector<ConnType>& elems, int level)
+  {
+    ConnType nbelems((ConnType)elems.size());
+    std::size_t nodeId(_nodes.size());
+    _nodes.push_back(Node());
+    _nodes[nodeId]._level=level;
+    _nodes[nodeId]._terminal=(nbelems < MIN_NB_ELEMS || level> MAX_LEVEL);
+    if (_nodes[nodeId]._terminal)
+      {
+        _nodes[nodeId]._begin=(ConnType)_elems.size();
+        _elems.insert(_elems.end(),elems.begin(),elems.end());
+        _nodes[nodeId]._end=(ConnType)_elems.size();
+        return ;
+      }
+    std::vector<double> nodes(nbelems);
+    for (ConnType i=0; i<nbelems; i++)
+      nodes[i]=bbs[elems[i]*dim*2+(level%dim)*2];
+    std::nth_element(nodes.begin(), nodes.begin()+nbelems/2, nodes.end());
+    double median(nodes[nbelems/2]);
+    std::vector<ConnType> new_elems_left;
+    std::vector<ConnType> new_elems_right;
+    new_elems_left.reserve(nbelems/2+1);
+    new_elems_right.reserve(nbelems/2+1);
+    double max_left = -std::numeric_limits<double>::max();
+    double min_right=  std::numeric_limits<double>::max();
+    for (ConnType i=0; i<nbelems;i++)
+      {
+        ConnType elem(elems[i]);
+        double max=bbs[elem*dim*2+(level%dim)*2+1];
+        double min = bbs[elem*dim*2+(level%dim)*2];
+        if (min>median)
+          {
+            new_elems_right.push_back(elem);
+            if (min<min_right) min_right = min;
+          }
+        else
+          {
+            new_elems_left.push_back(elem);
+            if (max>max_left) max_left = max;
+          }
+      }
+    _nodes[nodeId]._max_left=max_left+std::abs(_epsilon);
+    _nodes[nodeId]._min_right=min_right-std::abs(_epsilon);
+    _nodes[nodeId]._begin=0;
+    std::vector<double>().swap(nodes);
+    build(bbs,new_elems_left,level+1);
+    std::vector<ConnType>().swap(new_elems_left);
+    _nodes[nodeId]._end=(ConnType)_nodes.size();
+    build(bbs,new_elems_right,level+1);
+  }
+
+  /*!
+   * Appends to \a elems the elements of the leaf \a node whose bounding box intersects \a bb. The test is the one of BBTree.
+   */
+  void intersectingElemsInLeaf(const Node& node, const double* bb, std::vector<ConnType>& elems) const
+  {
+    std::size_t nbOfLeafElems(_elems.size());
+    ConnType i(node._begin);
+#if defined(__AVX2__)
+    const __m256d mEps(_mm256_set1_pd(-_epsilon)),pEps(_mm256_set1_pd(_epsilon));
+    for (; i+4<=node._end; i+=4)
+      {
+        __m256d out(_mm256_setzero_pd());
+        for (int idim=0; idim<dim; idim++)
+          {
+            __m256d mins(_mm256_loadu_pd(&_bb[(2*idim)*nbOfLeafElems+i])),maxs(_mm256_loadu_pd(&_bb[(2*idim+1)*nbOfLeafElems+i]));
+            __m256d outMin(_mm256_cmp_pd(_mm256_sub_pd(mins,_mm256_set1_pd(bb[idim*2+1])),mEps,_CMP_GT_OQ));
+            __m256d outMax(_mm256_cmp_pd(_mm256_sub_pd(maxs,_mm256_set1_pd(bb[idim*2])),pEps,_CMP_LT_OQ));
+            out=_mm256_or_pd(out,_mm256_or_pd(outMin,outMax));
+          }
+        int outMask(_mm256_movemask_pd(out));
+        if (outMask==0xF)
+          continue;
+        for (int k=0; k<4; k++)
+          if (!(outMask & (1<<k)))
+            elems.push_back(_elems[i+k]);
+      }
+#endif
+    for (; i<node._end; i++)
+      {
+        bool intersects = true;
+        for (int idim=0; idim<dim; idim++)
+          {
+            if (_bb[(2*idim)*nbOfLeafElems+i]-bb[idim*2+1]>-_epsilon|| _bb[(2*idim+1)*nbOfLeafElems+i]-bb[idim*2]<_epsilon)
+              intersects=false;
+          }
+        if (intersects)
+          elems.push_back(_elems[i]);
+      }
+  }
+};
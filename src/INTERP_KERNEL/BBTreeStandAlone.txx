@@ -19,20 +19,29 @@
 
 #pragma once
 
-#include "BBTree.txx"
+#include "BBTreeFlat.txx"
 #include <memory>
+#include <type_traits>
 
 /*!
- * Wrapper over BBTree to deal with ownership of bbox double array.
+ * Wrapper over a bounding box tree to deal with ownership of bbox double array.
+ * \a TreeType is the tree implementation : BBTreeFlat (default) or BBTree. Both give the same results in the same order.
+ * BBTreeFlat copies the boxes at construction, so the array is released as soon as the tree is built. BBTree references it, so it is kept.
  */
-template <int dim, class ConnType>
+template <int dim, class ConnType, class TreeType = BBTreeFlat<dim,ConnType> >
 class BBTreeStandAlone
 {
 private:
   std::unique_ptr<double[]> _bbox;
-  BBTree<dim,ConnType> _effective;
+  TreeType _effective;
 public:
-  BBTreeStandAlone(std::unique_ptr<double[]>&& bbs, ConnType nbelems, double epsilon=BBTREE_DFT_EPSILON):_bbox(std::move(bbs)),_effective(_bbox.get(),nullptr,0,nbelems,epsilon) { }
+  BBTreeStandAlone(std::unique_ptr<double[]>&& bbs, ConnType nbelems, double epsilon=BBTREE_DFT_EPSILON):_bbox(std::move(bbs)),_effective(_bbox.get(),nullptr,0,nbelems,epsilon)
+  {
+    if(std::is_same<TreeType,BBTreeFlat<dim,ConnType> >::value)
+      _bbox.reset();
+  }
   void getIntersectingElems(const double* bb, std::vector<ConnType>& elems) const { _effective.getIntersectingElems(bb,elems); }
   void getElementsAroundPoint(const double* xx, std::vector<ConnType>& elems) const { _effective.getElementsAroundPoint(xx,elems); }
+  //! Bulk query (see BBTreeFlat::getIntersectingElems). Only available with BBTreeFlat.
+  void getIntersectingElems(const double* bbs, ConnType nbOfBoxes, std::vector<ConnType>& elems, std::vector<ConnType>& elemsIndex) const { _effective.getIntersectingElems(bbs,nbOfBoxes,elems,elemsIndex); }
 };
@@ -0,0 +1,162 @@
+// Copyright (C) 2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef __INTERPKERNELTHREADS_HXX__
+#define __INTERPKERNELTHREADS_HXX__
+
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <cstddef>
+#include <exception>
+#include <system_error>
+
+namespace INTERP_KERNEL
+{
+  //! Number of chunks of work per thread used by the multi threaded algorithms, to balance the load between threads
+  const std::size_t NB_OF_CHUNKS_PER_THREAD=16;
+
+  /*!
+   * Returns the number of threads to use for a requested number \a nbThreads. A value lower or equal to 0 means
+   * "as many threads as the hardware supports".
+   */
+  inline unsigned int EffectiveNumberOfThreads(int nbThreads)
+  {
+    if(nbThreads>0)
+      return (unsigned int)nbThreads;
+    unsigned int ret(std::thread::hardware_concurrency());
+    return ret>0?ret:1u;
+  }
+
+  /*!
+   * Computes the range [\a start, \a stop) of the chunk \a chunkId when [0, \a nbOfItems) is split into \a nbOfChunks
+   * contiguous chunks of (almost) the same size.
+   */
+  template<class ConnType>
+  void ChunkBounds(ConnType nbOfItems, std::size_t nbOfChunks, std::size_t chunkId, ConnType& start, ConnType& stop)
+  {
+    std::size_t n((std::size_t)nbOfItems),q(n/nbOfChunks),r(n%nbOfChunks);
+    start=(ConnType)(chunkId*q+(chunkId<r?chunkId:r));
+    stop=(ConnType)((std::size_t)start+q+(chunkId<r?1:0));
+  }
+
+  /*!
+   * Deals the chunk ids [0, \a nbOfChunks) to threads asking for work. Each chunk id is given exactly once.
+   */
+  class ChunkDispatcher
+  {
+  public:
+    ChunkDispatcher(std::size_t nbOfChunks):_nb_of_chunks(nbOfChunks),_next(0),_aborted(false) { }
+    std::size_t getNumberOfChunks() const { return _nb_of_chunks; }
+    //! Returns false if there is no more chunk to process. Otherwise \a chunkId is set to the next chunk to process.
+    bool nextChunk(std::size_t& chunkId)
+    {
+      if(_aborted)
+        return false;
+      chunkId=_next++;
+      return chunkId<_nb_of_chunks;
+    }
+    //! Stops the distribution of chunks (typically because a thread failed)
+    void abort() { _aborted=true; }
+  private:
+    std::size_t _nb_of_chunks;
+    std::atomic<std::size_t> _next;
+    std::atomic<bool> _aborted;
+  };
+
+  /*!
+   * Calls \a func(threadId) in \a nbThreads threads, the calling thread included, and waits for all of them to finish.
+   * \a threadId is in [0, \a nbThreads). Objects created by \a func live in the thread that uses them, which is required for
+   * objects relying on thread local settings (see QuadraticPlanarPrecision).
+   * If the system refuses to spawn all the threads, \a func is run by fewer threads, so \a func must not assume that all
+   * the thread ids are used. The first exception thrown by \a func is rethrown in the calling thread once all threads have
+   * been joined.
+   */
+  template<class Func>
+  void ParallelRun(unsigned int nbThreads, Func func)
+  {
+    if(nbThreads<=1)
+      {
+        func(0u);
+        return ;
+      }
+    std::vector<std::exception_ptr> errors(nbThreads);
+    auto work=[&](unsigned int threadId)
+      {
+        try
+          {
+            func(threadId);
+          }
+        catch(...)
+          {
+            errors[threadId]=std::current_exception();
+          }
+      };
+    std::vector<std::thread> threads;
+    threads.reserve(nbThreads-1);
+    for(unsigned int t=1;t<nbThreads;t++)
+      {
+        try
+          {
+            threads.emplace_back(work,t);
+          }
+        catch(std::system_error&)
+          {// not able to spawn more threads : the remaining ones will take the load
+            break;
+          }
+      }
+    work(0);
+    for(std::vector<std::thread>::iterator it=threads.begin();it!=threads.end();it++)
+      (*it).join();
+    for(std::vector<std::exception_ptr>::const_iterator it=errors.begin();it!=errors.end();it++)
+      if(*it)
+        std::rethrow_exception(*it);
+  }
+
+  /*!
+   * Calls \a func(threadId,chunkId) for each \a chunkId in [0, \a nbOfChunks) using \a nbThreads threads, the calling thread
+   * included. \a threadId is in [0, \a nbThreads) and allows \a func to use per thread working data.
+   * Chunks are dealt dynamically to balance the load but each of them is processed exactly once, so that a caller storing
+   * its results per chunk gets an output that does not depend on the number of threads.
+   * The first exception thrown by \a func is rethrown in the calling thread once all threads have been joined.
+   */
+  template<class Func>
+  void ParallelForEachChunk(unsigned int nbThreads, std::size_t nbOfChunks, Func func)
+  {
+    if(nbThreads>nbOfChunks)
+      nbThreads=(unsigned int)nbOfChunks;
+    ChunkDispatcher dispatcher(nbOfChunks);
+    ParallelRun(nbThreads,[&](unsigned int threadId)
+      {
+        std::size_t chunkId;
+        try
+          {
+            while(dispatcher.nextChunk(chunkId))
+              func(threadId,chunkId);
+          }
+        catch(...)
+          {
+            dispatcher.abort();
+            throw;
+          }
+      });
+  }
+}
+
+#endif
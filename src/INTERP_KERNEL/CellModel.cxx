@@ -58,8 +58,8 @@ namespace INTERP_KERNEL
   const std::map<NormalizedCellType,CellModel>& CellModel::GetMapOfUniqueInstance()
   {
     static std::map<NormalizedCellType,CellModel> map_of_unique_instance;
-    if(map_of_unique_instance.empty())
-      BuildUniqueInstance(map_of_unique_instance);
+    static const bool isBuilt( (BuildUniqueInstance(map_of_unique_instance),true) ); // thread safe initialization
+    (void)isBuilt;
     return map_of_unique_instance;
   }
 
@@ -207,6 +207,107 @@ void ExprParserOfEval::sortMemory()
       *it=(*it)->deepCopy();
 }
 
+ExprParserOfEvalByBlock::ExprParserOfEvalByBlock(const ExprParser& expr):_max_depth(0)
+{
+  expr.checkForEvaluation();
+  int depth(0);
+  appendInstructions(expr._for_eval,depth);
+  if(depth!=1)
+    throw INTERP_KERNEL::Exception("ExprParserOfEvalByBlock : expression is not ready for evaluation ! Call prepareFastEvaluator before !");
+}
+
+void ExprParserOfEvalByBlock::appendInstructions(const ExprParserOfEval& expr, int& depth)
+{
+  if(expr._leaf)
+    {
+      Instruction inst={0,-1,0.};
+      const LeafExprVar *leafC(dynamic_cast<const LeafExprVar *>(expr._leaf));
+      if(leafC && leafC->getFastPos()>=0)
+        inst._pos=leafC->getFastPos();
+      else
+        inst._value=expr._leaf->getDoubleValue();
+      _instructions.push_back(inst);
+      _max_depth=std::max(_max_depth,++depth);
+    }
+  else
+    for(std::vector<ExprParserOfEval>::const_iterator iter=expr._sub_parts.begin();iter!=expr._sub_parts.end();iter++)
+      appendInstructions(*iter,depth);
+  for(std::vector<Function *>::const_iterator iter=expr._funcs.begin();iter!=expr._funcs.end();iter++)
+    {
+      if(!(*iter))
+        continue;
+      int nbOfParams((*iter)->getNbInputParams());
+      if(nbOfParams>depth)
+        throw INTERP_KERNEL::Exception("ExprParserOfEvalByBlock : invalid expression ! Not enough parameters for a function !");
+      Instruction inst={*iter,-1,0.};
+      _instructions.push_back(inst);
+      depth-=nbOfParams-1;
+    }
+}
+
+/*!
+ * Evaluates the expression on \a nbOfTuples tuples. The tuple \a i of the input starts at \a input + \a i * \a inputStride and
+ * its result is written at \a output + \a i * \a outputStride.
+ * The results of a block of tuples are written only once the whole block has been evaluated, so \a output may be \a input.
+ * If \a isSafe, the evaluation stops at the first block containing an invalid operation (division by 0., acos of value > 1. ...),
+ * as detected by ExprParser::evaluateDoubleInternalSafe.
+ * \return the number of tuples evaluated and written, i.e. \a nbOfTuples or the index of the first tuple of the block that failed.
+ */
+std::size_t ExprParserOfEvalByBlock::evaluate(const double *input, std::size_t inputStride, double *output, std::size_t outputStride, std::size_t nbOfTuples, bool isSafe) const
+{
+  std::vector<double> stck(_max_depth*BLOCK_SIZE);
+  for(std::size_t start=0;start<nbOfTuples;start+=BLOCK_SIZE)
+    {
+      std::size_t sz(std::min(BLOCK_SIZE,nbOfTuples-start));
+      try
+        {
+          evaluateBlock(input+start*inputStride,inputStride,output+start*outputStride,outputStride,sz,isSafe,stck.data());
+        }
+      catch(INTERP_KERNEL::Exception&)
+        {
+          if(!isSafe)
+            throw;
+          return start;
+        }
+    }
+  return nbOfTuples;
+}
+
+void ExprParserOfEvalByBlock::evaluateBlock(const double *input, std::size_t inputStride, double *output, std::size_t outputStride, std::size_t nbOfTuples, bool isSafe, double *stck) const
+{
+  double *args[3];
+  std::size_t depth(0);
+  for(std::vector<Instruction>::const_iterator it=_instructions.begin();it!=_instructions.end();it++)
+    {
+      if((*it)._func)
+        {
+          std::size_t nbOfParams((*it)._func->getNbInputParams());
+          for(std::size_t j=0;j<nbOfParams;j++)
+            args[j]=stck+(depth-1-j)*BLOCK_SIZE;
+          if(isSafe)
+            (*it)._func->operateBlockOfDoubleSafe(args,nbOfTuples);
+          else
+            (*it)._func->operateBlockOfDouble(args,nbOfTuples);
+          depth-=nbOfParams-1;
+        }
+      else
+        {
+          double *pt(stck+depth*BLOCK_SIZE);
+          if((*it)._pos>=0)
+            {
+              const double *inPt(input+(*it)._pos);
+              for(std::size_t i=0;i<nbOfTuples;i++,inPt+=inputStride)
+                pt[i]=*inPt;
+            }
+          else
+            std::fill(pt,pt+nbOfTuples,(*it)._value);
+          depth++;
+        }
+    }
+  for(std::size_t i=0;i<nbOfTuples;i++)
+    output[i*outputStride]=stck[i];
+}
+
 ExprParser::ExprParser(const std::string& expr, ExprParser *father):_father(father),_is_parsed(false),_leaf(0),_is_parsing_ok(false),_expr(expr)
 {
   _expr=deleteWhiteSpaces(_expr);
@@ -74,6 +74,7 @@ namespace INTERP_KERNEL
     INTERPKERNEL_EXPORT void compileX86_64(std::vector<std::string>& ass) const;
     INTERPKERNEL_EXPORT void fillValue(Value *val) const;
     INTERPKERNEL_EXPORT std::string getVar() const { return _var_name; }
+    INTERPKERNEL_EXPORT int getFastPos() const { return _fast_pos; }
     INTERPKERNEL_EXPORT void prepareExprEvaluation(const std::vector<std::string>& vars, int nbOfCompo, int targetNbOfCompo) const;
     INTERPKERNEL_EXPORT void prepareExprEvaluationDouble(const std::vector<std::string>& vars, int nbOfCompo, int targetNbOfCompo, int refPos, const double *ptOfInputStart, const double *ptOfInputEnd) const;
     INTERPKERNEL_EXPORT void prepareExprEvaluationVec() const;
@@ -89,8 +90,11 @@ namespace INTERP_KERNEL
     mutable const double *_val;
   };
 
+  class ExprParserOfEvalByBlock;
+
   class ExprParserOfEval
   {
+    friend class ExprParserOfEvalByBlock;
   public:
     ExprParserOfEval():_leaf(0) { }
     ExprParserOfEval(LeafExpr *leaf, const std::vector<ExprParserOfEval>& subParts, const std::vector<Function *>& funcs):_leaf(leaf),_sub_parts(subParts),_funcs(funcs) { }
@@ -124,6 +128,7 @@ namespace INTERP_KERNEL
 
   class ExprParser
   {
+    friend class ExprParserOfEvalByBlock;
   public:
     INTERPKERNEL_EXPORT ExprParser(ExprParser&& other);
     INTERPKERNEL_EXPORT ExprParser& operator=(ExprParser&& other);
@@ -189,6 +194,38 @@ namespace INTERP_KERNEL
     static const char WHITE_SPACES[];
     static const char EXPR_PARSE_ERR_MSG[];
   };
+
+  /*!
+   * Evaluates an expression on many tuples at once. The expression tree of an ExprParser is flattened into a sequence of
+   * instructions, and each instruction is applied to a whole block of tuples (see Function::operateBlockOfDouble) instead of
+   * walking the tree for each tuple. Results are identical to those of ExprParser::evaluateDoubleInternal.
+   *
+   * The ExprParser given at construction must have been prepared with ExprParser::prepareExprEvaluationDouble and
+   * ExprParser::prepareFastEvaluator, and must outlive \a this. Once built, \a this is read only so it can be used by several
+   * threads at the same time.
+   */
+  class ExprParserOfEvalByBlock
+  {
+  public:
+    INTERPKERNEL_EXPORT ExprParserOfEvalByBlock(const ExprParser& expr);
+    INTERPKERNEL_EXPORT std::size_t evaluate(const double *input, std::size_t inputStride, double *output, std::size_t outputStride, std::size_t nbOfTuples, bool isSafe) const;
+  public:
+    //! number of tuples evaluated at once
+    static const std::size_t BLOCK_SIZE=256;
+  private:
+    struct Instruction
+    {
+      //! if not null the instruction applies _func, else it pushes the component _pos of the input tuple, or _value if _pos is negative.
+      const Function *_func;
+      int _pos;
+      double _value;
+    };
+    void appendInstructions(const ExprParserOfEval& expr, int& depth);
+    void evaluateBlock(const double *input, std::size_t inputStride, double *output, std::size_t outputStride, std::size_t nbOfTuples, bool isSafe, double *stck) const;
+  private:
+    std::vector<Instruction> _instructions;
+    int _max_depth;
+  };
 }
 
 #endif
@@ -185,6 +185,23 @@ Function *FunctionsFactory::buildBinaryFuncFromString(char type)
   return buildBinaryFuncFromString(tmp);
 }
 
+/*!
+ * Default implementation, evaluating the elements one by one with operateStackOfDouble.
+ */
+void Function::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  int nbOfParams(getNbInputParams());
+  std::vector<double> stck(nbOfParams);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    {
+      stck.resize(nbOfParams);
+      for(int j=0;j<nbOfParams;j++)
+        stck[j]=args[nbOfParams-1-j][i];
+      operateStackOfDouble(stck);
+      args[nbOfParams-1][i]=stck.back();
+    }
+}
+
 Function::~Function()
 {
 }
@@ -210,6 +227,10 @@ const char *IdentityFunction::getRepr() const
   return REPR;
 }
 
+void IdentityFunction::operateBlockOfDouble(double **, std::size_t) const
+{
+}
+
 bool IdentityFunction::isACall() const
 {
   return false;
@@ -241,6 +262,10 @@ const char *PositiveFunction::getRepr() const
   return REPR;
 }
 
+void PositiveFunction::operateBlockOfDouble(double **, std::size_t) const
+{
+}
+
 bool PositiveFunction::isACall() const
 {
   return false;
@@ -267,6 +292,13 @@ void NegateFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=-v;
 }
 
+void NegateFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=-v[i];
+}
+
 const char *NegateFunction::getRepr() const
 {
   return REPR;
@@ -298,6 +330,13 @@ void CosFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=cos(v);
 }
 
+void CosFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=cos(v[i]);
+}
+
 const char *CosFunction::getRepr() const
 {
   return REPR;
@@ -329,6 +368,13 @@ void SinFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=sin(v);
 }
 
+void SinFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=sin(v[i]);
+}
+
 const char *SinFunction::getRepr() const
 {
   return REPR;
@@ -360,6 +406,13 @@ void TanFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=tan(v);
 }
 
+void TanFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=tan(v[i]);
+}
+
 const char *TanFunction::getRepr() const
 {
   return REPR;
@@ -391,6 +444,13 @@ void ACosFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=acos(v);
 }
 
+void ACosFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=acos(v[i]);
+}
+
 void ACosFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
 {
   double v(stck.back());
@@ -399,6 +459,15 @@ void ACosFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
   stck.back()=acos(v);
 }
 
+void ACosFunction::operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const
+{
+  const double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    if(fabs(v[i])>1.)
+      throw INTERP_KERNEL::Exception("acos on a value which absolute is > 1 !");
+  operateBlockOfDouble(args,nbOfElems);
+}
+
 const char *ACosFunction::getRepr() const
 {
   return REPR;
@@ -430,6 +499,13 @@ void ASinFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=asin(v);
 }
 
+void ASinFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=asin(v[i]);
+}
+
 void ASinFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
 {
   double v(stck.back());
@@ -438,6 +514,15 @@ void ASinFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
   stck.back()=asin(v);
 }
 
+void ASinFunction::operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const
+{
+  const double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    if(fabs(v[i])>1.)
+      throw INTERP_KERNEL::Exception("asin on a value which absolute is > 1 !");
+  operateBlockOfDouble(args,nbOfElems);
+}
+
 const char *ASinFunction::getRepr() const
 {
   return REPR;
@@ -469,6 +554,13 @@ void ATanFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=atan(v);
 }
 
+void ATanFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=atan(v[i]);
+}
+
 const char *ATanFunction::getRepr() const
 {
   return REPR;
@@ -500,6 +592,13 @@ void CoshFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=cosh(v);
 }
 
+void CoshFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=cosh(v[i]);
+}
+
 const char *CoshFunction::getRepr() const
 {
   return REPR;
@@ -531,6 +630,13 @@ void SinhFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=sinh(v);
 }
 
+void SinhFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=sinh(v[i]);
+}
+
 const char *SinhFunction::getRepr() const
 {
   return REPR;
@@ -562,6 +668,13 @@ void TanhFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=tanh(v);
 }
 
+void TanhFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=tanh(v[i]);
+}
+
 const char *TanhFunction::getRepr() const
 {
   return REPR;
@@ -593,6 +706,13 @@ void SqrtFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=sqrt(v);
 }
 
+void SqrtFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=sqrt(v[i]);
+}
+
 void SqrtFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
 {
   double v(stck.back());
@@ -601,6 +721,15 @@ void SqrtFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
   stck.back()=sqrt(v);
 }
 
+void SqrtFunction::operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const
+{
+  const double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    if(v[i]<0.)
+      throw INTERP_KERNEL::Exception("sqrt on a value < 0. !");
+  operateBlockOfDouble(args,nbOfElems);
+}
+
 const char *SqrtFunction::getRepr() const
 {
   return REPR;
@@ -632,6 +761,13 @@ void AbsFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=fabs(v);
 }
 
+void AbsFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=fabs(v[i]);
+}
+
 const char *AbsFunction::getRepr() const
 {
   return REPR;
@@ -659,6 +795,13 @@ void ExpFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=std::exp(v);
 }
 
+void ExpFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=std::exp(v[i]);
+}
+
 const char *ExpFunction::getRepr() const
 {
   return REPR;
@@ -690,6 +833,13 @@ void LnFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=std::log(v);
 }
 
+void LnFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=std::log(v[i]);
+}
+
 void LnFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
 {
   double v(stck.back());
@@ -698,6 +848,15 @@ void LnFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
   stck.back()=std::log(v);
 }
 
+void LnFunction::operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const
+{
+  const double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    if(v[i]<0.)
+      throw INTERP_KERNEL::Exception("ln on a value < 0. !");
+  operateBlockOfDouble(args,nbOfElems);
+}
+
 const char *LnFunction::getRepr() const
 {
   return REPR;
@@ -729,6 +888,13 @@ void LogFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=std::log(v);
 }
 
+void LogFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=std::log(v[i]);
+}
+
 void LogFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
 {
   double v(stck.back());
@@ -737,6 +903,15 @@ void LogFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
   stck.back()=std::log(v);
 }
 
+void LogFunction::operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const
+{
+  const double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    if(v[i]<0.)
+      throw INTERP_KERNEL::Exception("log on a value < 0. !");
+  operateBlockOfDouble(args,nbOfElems);
+}
+
 const char *LogFunction::getRepr() const
 {
   return REPR;
@@ -768,6 +943,13 @@ void Log10Function::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=std::log10(v);
 }
 
+void Log10Function::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    v[i]=std::log10(v[i]);
+}
+
 void Log10Function::operateStackOfDoubleSafe(std::vector<double>& stck) const
 {
   double v(stck.back());
@@ -776,6 +958,15 @@ void Log10Function::operateStackOfDoubleSafe(std::vector<double>& stck) const
   stck.back()=std::log10(v);
 }
 
+void Log10Function::operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const
+{
+  const double *v(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    if(v[i]<0.)
+      throw INTERP_KERNEL::Exception("log10 on a value < 0. !");
+  operateBlockOfDouble(args,nbOfElems);
+}
+
 const char *Log10Function::getRepr() const
 {
   return REPR;
@@ -827,6 +1018,14 @@ void PlusFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=a+stck.back();
 }
 
+void PlusFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  const double *a(args[0]);
+  double *b(args[1]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    b[i]=a[i]+b[i];
+}
+
 const char *PlusFunction::getRepr() const
 {
   return REPR;
@@ -873,6 +1072,14 @@ void MinusFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=a-stck.back();
 }
 
+void MinusFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  const double *a(args[0]);
+  double *b(args[1]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    b[i]=a[i]-b[i];
+}
+
 const char *MinusFunction::getRepr() const
 {
   return REPR;
@@ -910,6 +1117,14 @@ void MultFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=a*stck.back();
 }
 
+void MultFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  const double *a(args[0]);
+  double *b(args[1]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    b[i]=a[i]*b[i];
+}
+
 const char *MultFunction::getRepr() const
 {
   return REPR;
@@ -956,6 +1171,14 @@ void DivFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=a/stck.back();
 }
 
+void DivFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  const double *a(args[0]);
+  double *b(args[1]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    b[i]=a[i]/b[i];
+}
+
 void DivFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
 {
   double a(stck.back());
@@ -965,6 +1188,15 @@ void DivFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
   stck.back()=a/stck.back();
 }
 
+void DivFunction::operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const
+{
+  const double *b(args[1]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    if(b[i]==0.)
+      throw INTERP_KERNEL::Exception("division by 0. !");
+  operateBlockOfDouble(args,nbOfElems);
+}
+
 const char *DivFunction::getRepr() const
 {
   return REPR;
@@ -1011,6 +1243,14 @@ void PowFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=std::pow(a,stck.back());
 }
 
+void PowFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  const double *a(args[0]);
+  double *b(args[1]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    b[i]=std::pow(a[i],b[i]);
+}
+
 void PowFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
 {
   double a(stck.back());
@@ -1021,6 +1261,15 @@ void PowFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
   stck.back()=std::pow(a,b);
 }
 
+void PowFunction::operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const
+{
+  const double *a(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    if(a[i]<0.)
+      throw INTERP_KERNEL::Exception("pow with val < 0. !");
+  operateBlockOfDouble(args,nbOfElems);
+}
+
 const char *PowFunction::getRepr() const
 {
   return REPR;
@@ -1071,6 +1320,14 @@ void MaxFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=std::max(stck.back(),a);
 }
 
+void MaxFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  const double *a(args[0]);
+  double *b(args[1]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    b[i]=std::max(b[i],a[i]);
+}
+
 const char *MaxFunction::getRepr() const
 {
   return REPR;
@@ -1117,6 +1374,14 @@ void MinFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=std::min(stck.back(),a);
 }
 
+void MinFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  const double *a(args[0]);
+  double *b(args[1]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    b[i]=std::min(b[i],a[i]);
+}
+
 const char *MinFunction::getRepr() const
 {
   return REPR;
@@ -1164,6 +1429,14 @@ void GreaterThanFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=a>b?std::numeric_limits<double>::max():-std::numeric_limits<double>::max();
 }
 
+void GreaterThanFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  const double *a(args[0]);
+  double *b(args[1]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    b[i]=a[i]>b[i]?std::numeric_limits<double>::max():-std::numeric_limits<double>::max();
+}
+
 const char *GreaterThanFunction::getRepr() const
 {
   return REPR;
@@ -1211,6 +1484,14 @@ void LowerThanFunction::operateStackOfDouble(std::vector<double>& stck) const
   stck.back()=a<b?std::numeric_limits<double>::max():-std::numeric_limits<double>::max();
 }
 
+void LowerThanFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  const double *a(args[0]);
+  double *b(args[1]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    b[i]=a[i]<b[i]?std::numeric_limits<double>::max():-std::numeric_limits<double>::max();
+}
+
 const char *LowerThanFunction::getRepr() const
 {
   return REPR;
@@ -1269,6 +1550,15 @@ void IfFunction::operateStackOfDouble(std::vector<double>& stck) const
     stck.back()=the;
 }
 
+void IfFunction::operateBlockOfDouble(double **args, std::size_t nbOfElems) const
+{
+  const double *cond(args[0]),*the(args[1]);
+  double *els(args[2]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    if(cond[i]==std::numeric_limits<double>::max())
+      els[i]=the[i];
+}
+
 void IfFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
 {
   double cond(stck.back());
@@ -1281,6 +1571,15 @@ void IfFunction::operateStackOfDoubleSafe(std::vector<double>& stck) const
     stck.back()=the;
 }
 
+void IfFunction::operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const
+{
+  const double *cond(args[0]);
+  for(std::size_t i=0;i<nbOfElems;i++)
+    if(cond[i]!=std::numeric_limits<double>::max() && cond[i]!=-std::numeric_limits<double>::max())
+      throw INTERP_KERNEL::Exception("ifFunc : first parameter of ternary func is NOT a consequence of a boolean op !");
+  operateBlockOfDouble(args,nbOfElems);
+}
+
 const char *IfFunction::getRepr() const
 {
   return REPR;
@@ -25,6 +25,7 @@
 #include "InterpKernelException.hxx"
 
 #include <vector>
+#include <cstddef>
 
 namespace INTERP_KERNEL
 {
@@ -51,6 +52,9 @@ namespace INTERP_KERNEL
     virtual void operateX86(std::vector<std::string>& asmb) const = 0;
     virtual void operateStackOfDouble(std::vector<double>& stck) const = 0;
     virtual void operateStackOfDoubleSafe(std::vector<double>& stck) const { operateStackOfDouble(stck); }
+    //! Same as operateStackOfDouble on \a nbOfElems values at once. \a args[0] is the top of the stack, the result is stored in \a args[getNbInputParams()-1].
+    virtual void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
+    virtual void operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const { operateBlockOfDouble(args,nbOfElems); }
     virtual const char *getRepr() const = 0;
     virtual bool isACall() const = 0;
     virtual Function *deepCopy() const = 0;
@@ -69,6 +73,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     IdentityFunction *deepCopy() const { return new IdentityFunction; }
@@ -83,6 +88,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     PositiveFunction *deepCopy() const { return new PositiveFunction; }
@@ -97,6 +103,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     NegateFunction *deepCopy() const { return new NegateFunction; }
@@ -111,6 +118,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     CosFunction *deepCopy() const { return new CosFunction; }
@@ -125,6 +133,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     SinFunction *deepCopy() const { return new SinFunction; }
@@ -139,6 +148,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     TanFunction *deepCopy() const { return new TanFunction; }
@@ -153,7 +163,9 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     void operateStackOfDoubleSafe(std::vector<double>& stck) const;
+    void operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     ACosFunction *deepCopy() const { return new ACosFunction; }
@@ -168,7 +180,9 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     void operateStackOfDoubleSafe(std::vector<double>& stck) const;
+    void operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     ASinFunction *deepCopy() const { return new ASinFunction; }
@@ -183,6 +197,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     ATanFunction *deepCopy() const { return new ATanFunction; }
@@ -197,6 +212,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     CoshFunction *deepCopy() const { return new CoshFunction; }
@@ -211,6 +227,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     SinhFunction *deepCopy() const { return new SinhFunction; }
@@ -225,6 +242,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     TanhFunction *deepCopy() const { return new TanhFunction; }
@@ -239,7 +257,9 @@ namespace INTERP_KERNEL
     void operateX86(std::vector<std::string>& asmb) const;
     void operate(std::vector<Value *>& stck) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     void operateStackOfDoubleSafe(std::vector<double>& stck) const;
+    void operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     SqrtFunction *deepCopy() const { return new SqrtFunction; }
@@ -254,6 +274,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     AbsFunction *deepCopy() const { return new AbsFunction; }
@@ -268,6 +289,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     ExpFunction *deepCopy() const { return new ExpFunction; }
@@ -282,7 +304,9 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     void operateStackOfDoubleSafe(std::vector<double>& stck) const;
+    void operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     LnFunction *deepCopy() const { return new LnFunction; }
@@ -297,7 +321,9 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     void operateStackOfDoubleSafe(std::vector<double>& stck) const;
+    void operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     LogFunction *deepCopy() const { return new LogFunction; }
@@ -312,7 +338,9 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     void operateStackOfDoubleSafe(std::vector<double>& stck) const;
+    void operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     Log10Function *deepCopy() const { return new Log10Function; }
@@ -333,6 +361,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     PlusFunction *deepCopy() const { return new PlusFunction; }
@@ -347,6 +376,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     MinusFunction *deepCopy() const { return new MinusFunction; }
@@ -361,6 +391,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     MultFunction *deepCopy() const { return new MultFunction; }
@@ -375,7 +406,9 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     void operateStackOfDoubleSafe(std::vector<double>& stck) const;
+    void operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     DivFunction *deepCopy() const { return new DivFunction; }
@@ -390,7 +423,9 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     void operateStackOfDoubleSafe(std::vector<double>& stck) const;
+    void operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     PowFunction *deepCopy() const { return new PowFunction; }
@@ -405,6 +440,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     MaxFunction *deepCopy() const { return new MaxFunction; }
@@ -419,6 +455,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     MinFunction *deepCopy() const { return new MinFunction; }
@@ -433,6 +470,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     GreaterThanFunction *deepCopy() const { return new GreaterThanFunction; }
@@ -447,6 +485,7 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     LowerThanFunction *deepCopy() const { return new LowerThanFunction; }
@@ -467,7 +506,9 @@ namespace INTERP_KERNEL
     void operate(std::vector<Value *>& stck) const;
     void operateX86(std::vector<std::string>& asmb) const;
     void operateStackOfDouble(std::vector<double>& stck) const;
+    void operateBlockOfDouble(double **args, std::size_t nbOfElems) const;
     void operateStackOfDoubleSafe(std::vector<double>& stck) const;
+    void operateBlockOfDoubleSafe(double **args, std::size_t nbOfElems) const;
     const char *getRepr() const;
     bool isACall() const;
     IfFunction *deepCopy() const { return new IfFunction; }
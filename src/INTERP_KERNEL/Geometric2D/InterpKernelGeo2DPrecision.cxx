@@ -20,20 +20,29 @@
 
 #include "InterpKernelGeo2DPrecision.hxx"
 
-double INTERP_KERNEL::QuadraticPlanarPrecision::_precision=1e-14;
+namespace
+{
+  // Not a static member of QuadraticPlanarPrecision : thread local data can not be exported from a DLL
+  thread_local double THREAD_PRECISION=1e-14;
+}
 
 INTERP_KERNEL::QuadraticPlanarPrecision::QuadraticPlanarPrecision(double precision):
-    _initial_precision(_precision)
+    _initial_precision(THREAD_PRECISION)
 {
-  _precision=precision;
+  THREAD_PRECISION=precision;
 }
 
 INTERP_KERNEL::QuadraticPlanarPrecision::~QuadraticPlanarPrecision()
 {
-  _precision = _initial_precision;
+  THREAD_PRECISION = _initial_precision;
 }
 
 void INTERP_KERNEL::QuadraticPlanarPrecision::setPrecision(double precision)
 { 
-  _precision=precision;
+  THREAD_PRECISION=precision;
+}
+
+double INTERP_KERNEL::QuadraticPlanarPrecision::getPrecision()
+{
+  return THREAD_PRECISION;
 }
@@ -26,7 +26,7 @@
 namespace INTERP_KERNEL
 {
   /* !!TODO: a more global review of the code should be done, so that eps is always a parameter of all methods
-     instead of being stored as a static attribute.
+     instead of being stored as a per thread attribute.
   */
 
   /** Class storing the precision for the detection of colinear segments, coincident points, etc ...
@@ -35,6 +35,10 @@ namespace INTERP_KERNEL
    * RAII pattern allowing to temporarily override Geometric2D precision.
    * When the instance is destroyed, the previous precision is set back.
    *
+   * The precision is a per thread context : it is set and read for the calling thread only. Several threads can thus run
+   * Geometric2D computations with different precisions at the same time (for example several remappers, or the worker
+   * threads of a multi threaded interpolation). A new thread starts with the default precision 1e-14. As a consequence,
+   * an instance must be destroyed by the thread that created it.
    */
   class INTERPKERNEL_EXPORT QuadraticPlanarPrecision
   {
@@ -43,9 +47,8 @@ namespace INTERP_KERNEL
     virtual ~QuadraticPlanarPrecision();
 
     static void setPrecision(double precision);
-    inline static double getPrecision() { return _precision; }
+    static double getPrecision();
   private:
-    static double _precision;
     double _initial_precision;
   };
 
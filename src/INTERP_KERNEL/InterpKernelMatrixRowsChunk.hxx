@@ -0,0 +1,56 @@
+// Copyright (C) 2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef __INTERPKERNELMATRIXROWSCHUNK_HXX__
+#define __INTERPKERNELMATRIXROWSCHUNK_HXX__
+
+#include <vector>
+#include <utility>
+
+namespace INTERP_KERNEL
+{
+  /*!
+   * Contiguous range of rows [start,stop) of a matrix of type \a MatrixType. It exposes the part of the matrix interface used
+   * by the intersectors (operator[] returning a row), so that a worker thread can fill its own rows without touching the
+   * shared result matrix. Rows are moved into the result matrix by mergeInto.
+   *
+   * Only intersectors for which the row \a i is exclusively fed by the target cell \a i (i.e. P0 target) can use it.
+   */
+  template<class MatrixType, class ConnType>
+  class MatrixRowsChunk
+  {
+  public:
+    typedef typename MatrixType::value_type value_type;
+  public:
+    MatrixRowsChunk(ConnType start, ConnType stop):_start(start),_rows(stop-start) { }
+    value_type& operator[](ConnType rowId) { return _rows[rowId-_start]; }
+    void mergeInto(MatrixType& result)
+    {
+      ConnType rowId(_start);
+      for(typename std::vector<value_type>::iterator it=_rows.begin();it!=_rows.end();it++,rowId++)
+        std::swap(result[rowId],*it);
+      std::vector<value_type>().swap(_rows);
+    }
+  private:
+    ConnType _start;
+    std::vector<value_type> _rows;
+  };
+}
+
+#endif
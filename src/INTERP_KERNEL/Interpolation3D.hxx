@@ -28,6 +28,9 @@
 
 namespace INTERP_KERNEL
 {
+  template<class MyMeshType, class MyMatrix>
+  class Intersector3D;
+
   /**
    * \class Interpolation3D
    * \brief Class used to calculate the volumes of intersection between the elements of two 3D meshes.
@@ -40,6 +43,9 @@ namespace INTERP_KERNEL
     Interpolation3D(const InterpolationOptions& io);
     template<class MyMeshType, class MatrixType>
     typename MyMeshType::MyConnType interpolateMeshes(const MyMeshType& srcMesh, const MyMeshType& targetMesh, MatrixType& result, const std::string& method);
+  private:
+    template<class MyMeshType, class MatrixType>
+    Intersector3D<MyMeshType,MatrixType> *buildIntersector(const MyMeshType& srcMesh, const MyMeshType& targetMesh, const std::string& methC) const;
   };
 }
 
@@ -51,10 +51,44 @@
 
 #endif
 
+#include "InterpKernelThreads.hxx"
+#include "InterpKernelMatrixRowsChunk.hxx"
+
 #include <memory>
+#include <algorithm>
 
 namespace INTERP_KERNEL
 {
+  /*!
+   * Feeds \a result with the intersections of the target cells in [\a start, \a stop) : for each of these target cells,
+   * the source cells candidates are retrieved from \a tree and given to \a intersector.
+   */
+  template<class MyMeshType, class TreeType, class IntersectorType, class MatrixType>
+  void IntersectTargetCells3D(const TreeType& tree, const MyMeshType& targetMesh, typename MyMeshType::MyConnType start, typename MyMeshType::MyConnType stop,
+                              IntersectorType& intersector, MatrixType& result)
+  {
+    using ConnType = typename MyMeshType::MyConnType;
+    // for each target element, get source elements with which to calculate intersection
+    // - calculate intersection by calling intersectCells
+    for(ConnType i = start; i < stop; ++i)
+      {
+        MeshElement<ConnType> trgMeshElem(i, targetMesh);
+
+        const BoundingBox *box = trgMeshElem.getBoundingBox();
+
+        // get target bbox in right order
+        double targetBox[6];
+        box->fillInXMinXmaxYminYmaxZminZmaxFormat(targetBox);
+
+        std::vector<ConnType> intersectElems;
+
+        tree.getIntersectingElems(targetBox, intersectElems);
+
+        if ( !intersectElems.empty() )
+          intersector.intersectCells(i,intersectElems,result);
+      }
+  }
+
   /**
    * Calculates the matrix of volumes of intersection between the elements of srcMesh and the elements of targetMesh.
    * The calculation is done in two steps. First a filtering process reduces the number of pairs of elements for which the
@@ -71,6 +105,9 @@ namespace INTERP_KERNEL
    * the indexing is more natural : the intersection volume of the target element i with source element j is found at matrix[i-1][j].
    * 
 
+   * When the NbThreads option is not 1 and the target field is P0, target cells are dealt by several threads, each one
+   * with its own intersector. The resulting matrix is exactly the same whatever the number of threads.
+   *
    * @param srcMesh     3-dimensional source mesh
    * @param targetMesh  3-dimesional target mesh, containing only tetraedra
    * @param result      matrix in which the result is stored 
@@ -85,75 +122,8 @@ namespace INTERP_KERNEL
 
     LOG(2, "Target mesh has " << numTargetElems << " elements ");
 
-    std::unique_ptr<Intersector3D<MyMeshType,MatrixType>> intersector;
     std::string methC = InterpolationOptions::filterInterpolationMethod(method);
-    if(methC=="P0P0")
-      {
-        switch(InterpolationOptions::getIntersectionType())
-          {
-          case Triangulation:
-            intersector.reset( new PolyhedronIntersectorP0P0<MyMeshType,MatrixType>(targetMesh, srcMesh, getSplittingPolicy()) );
-            break;
-          case PointLocator:
-            intersector.reset( new PointLocator3DIntersectorP0P0<MyMeshType,MatrixType>(targetMesh, srcMesh, getPrecision()) );
-            break;
-          default:
-            throw INTERP_KERNEL::Exception("Invalid 3D intersection type for P0P0 interp specified : must be Triangle or PointLocator.");
-          }
-      }
-    else if(methC=="P0P1")
-      {
-        switch(InterpolationOptions::getIntersectionType())
-          {
-          case Triangulation:
-            intersector.reset( new PolyhedronIntersectorP0P1<MyMeshType,MatrixType>(targetMesh, srcMesh, getSplittingPolicy()) );
-            break;
-          case PointLocator:
-            intersector.reset( new PointLocator3DIntersectorP0P1<MyMeshType,MatrixType>(targetMesh, srcMesh, getPrecision()) );
-            break;
-          default:
-            throw INTERP_KERNEL::Exception("Invalid 3D intersection type for P0P1 interp specified : must be Triangle or PointLocator.");
-          }
-      }
-    else if(methC=="P1P0")
-      {
-        switch(InterpolationOptions::getIntersectionType())
-          {
-          case Triangulation:
-            intersector.reset( new PolyhedronIntersectorP1P0<MyMeshType,MatrixType>(targetMesh, srcMesh, getSplittingPolicy()) );
-            break;
-          case PointLocator:
-            intersector.reset( new PointLocator3DIntersectorP1P0<MyMeshType,MatrixType>(targetMesh, srcMesh, getPrecision()) );
-            break;
-          case Barycentric:
-            intersector.reset( new PolyhedronIntersectorP1P0Bary<MyMeshType,MatrixType>(targetMesh, srcMesh, getSplittingPolicy()) );
-            break;
-          default:
-            throw INTERP_KERNEL::Exception("Invalid 3D intersection type for P1P0 interp specified : must be Triangle, PointLocator or Barycentric.");
-          }
-      }
-    else if(methC=="P1P1")
-      {
-        switch(InterpolationOptions::getIntersectionType())
-          {
-          case Triangulation:
-            intersector.reset( new PolyhedronIntersectorP1P1<MyMeshType,MatrixType>(targetMesh, srcMesh, getSplittingPolicy()) );
-            break;
-          case PointLocator:
-            intersector.reset( new PointLocator3DIntersectorP1P1<MyMeshType,MatrixType>(targetMesh, srcMesh, getPrecision()) );
-            break;
-          case Barycentric:
-            intersector.reset( new Barycentric3DIntersectorP1P1<MyMeshType,MatrixType>(targetMesh, srcMesh, getPrecision()) );
-            break;
-          case MappedBarycentric:
-            intersector.reset( new MappedBarycentric3DIntersectorP1P1<MyMeshType,MatrixType>(targetMesh, srcMesh, getPrecision()) );
-            break;
-          default:
-            throw INTERP_KERNEL::Exception("Invalid 3D intersection type for P1P1 interp specified : must be Triangle, PointLocator, Barycentric or MappedBarycentric.");
-          }
-      }
-    else
-      throw Exception("Invalid method chosen must be in \"P0P0\", \"P0P1\", \"P1P0\" or \"P1P1\".");
+    std::unique_ptr<Intersector3D<MyMeshType,MatrixType>> intersector( buildIntersector<MyMeshType,MatrixType>(srcMesh,targetMesh,methC) );
     // create empty maps for all source elements
     result.resize(intersector->getNumberOfRowsOfResMatrix());
 
@@ -296,29 +266,104 @@ namespace INTERP_KERNEL
     // create BBTree structure
     BBTreeStandAlone<3,ConnType> tree( BuildBBTree(srcMesh) );
 
-    // for each target element, get source elements with which to calculate intersection
-    // - calculate intersection by calling intersectCells
-    for(ConnType i = 0; i < numTargetElems; ++i)
+    const unsigned int nbThreads( EffectiveNumberOfThreads(getNbThreads()) );
+    // For a P0 target, the row i of the matrix is fed only by the target cell i. The target cells can then be dealt by several
+    // threads, each one with its own intersector, while giving exactly the same matrix than the sequential mode.
+    // For a P1 target, rows (target nodes) are shared by target cells and the sequential accumulation order is kept.
+    if(nbThreads>1 && methC.substr(2)=="P0")
       {
-        MeshElement<ConnType> trgMeshElem(i, targetMesh);
-
-        const BoundingBox *box = trgMeshElem.getBoundingBox();
-
-        // get target bbox in right order
-        double targetBox[6];
-        box->fillInXMinXmaxYminYmaxZminZmaxFormat(targetBox);
-
-        std::vector<ConnType> intersectElems;
-
-        tree.getIntersectingElems(targetBox, intersectElems);
-
-        if ( !intersectElems.empty() )
-          intersector->intersectCells(i,intersectElems,result);
+        typedef MatrixRowsChunk<MatrixType,ConnType> ChunkType;
+        const std::size_t nbOfChunks( std::min<std::size_t>( (std::size_t)numTargetElems, NB_OF_CHUNKS_PER_THREAD*nbThreads ) );
+        LOG(2, "Intersecting target cells using " << nbThreads << " threads and " << nbOfChunks << " chunks");
+        std::vector< std::unique_ptr<ChunkType> > chunks(nbOfChunks);
+        ChunkDispatcher dispatcher(nbOfChunks);
+        ParallelRun((unsigned int)std::min<std::size_t>(nbThreads,nbOfChunks),[&](unsigned int)
+          {
+            std::unique_ptr< Intersector3D<MyMeshType,ChunkType> > threadIntersector( buildIntersector<MyMeshType,ChunkType>(srcMesh,targetMesh,methC) );
+            std::size_t chunkId;
+            while(dispatcher.nextChunk(chunkId))
+              {
+                ConnType start,stop;
+                ChunkBounds(numTargetElems,nbOfChunks,chunkId,start,stop);
+                chunks[chunkId].reset( new ChunkType(start,stop) );
+                IntersectTargetCells3D(tree,targetMesh,start,stop,*threadIntersector,*chunks[chunkId]);
+              }
+          });
+        // merge is done in the order of target cells
+        for(typename std::vector< std::unique_ptr<ChunkType> >::iterator it=chunks.begin();it!=chunks.end();it++)
+          (*it)->mergeInto(result);
       }
+    else
+      IntersectTargetCells3D(tree,targetMesh,ConnType(0),numTargetElems,*intersector,result);
 
 #endif
     return intersector->getNumberOfColsOfResMatrix();
   }
+
+  /*!
+   * Builds the intersector corresponding to the interpolation method \a methC and to the intersection type of \a this.
+   * The returned object has to be deallocated by the caller.
+   */
+  template<class MyMeshType, class MatrixType>
+  Intersector3D<MyMeshType,MatrixType> *Interpolation3D::buildIntersector(const MyMeshType& srcMesh, const MyMeshType& targetMesh, const std::string& methC) const
+  {
+    if(methC=="P0P0")
+      {
+        switch(InterpolationOptions::getIntersectionType())
+          {
+          case Triangulation:
+            return new PolyhedronIntersectorP0P0<MyMeshType,MatrixType>(targetMesh, srcMesh, getSplittingPolicy());
+          case PointLocator:
+            return new PointLocator3DIntersectorP0P0<MyMeshType,MatrixType>(targetMesh, srcMesh, getPrecision());
+          default:
+            throw INTERP_KERNEL::Exception("Invalid 3D intersection type for P0P0 interp specified : must be Triangle or PointLocator.");
+          }
+      }
+    else if(methC=="P0P1")
+      {
+        switch(InterpolationOptions::getIntersectionType())
+          {
+          case Triangulation:
+            return new PolyhedronIntersectorP0P1<MyMeshType,MatrixType>(targetMesh, srcMesh, getSplittingPolicy());
+          case PointLocator:
+            return new PointLocator3DIntersectorP0P1<MyMeshType,MatrixType>(targetMesh, srcMesh, getPrecision());
+          default:
+            throw INTERP_KERNEL::Exception("Invalid 3D intersection type for P0P1 interp specified : must be Triangle or PointLocator.");
+          }
+      }
+    else if(methC=="P1P0")
+      {
+        switch(InterpolationOptions::getIntersectionType())
+          {
+          case Triangulation:
+            return new PolyhedronIntersectorP1P0<MyMeshType,MatrixType>(targetMesh, srcMesh, getSplittingPolicy());
+          case PointLocator:
+            return new PointLocator3DIntersectorP1P0<MyMeshType,MatrixType>(targetMesh, srcMesh, getPrecision());
+          case Barycentric:
+            return new PolyhedronIntersectorP1P0Bary<MyMeshType,MatrixType>(targetMesh, srcMesh, getSplittingPolicy());
+          default:
+            throw INTERP_KERNEL::Exception("Invalid 3D intersection type for P1P0 interp specified : must be Triangle, PointLocator or Barycentric.");
+          }
+      }
+    else if(methC=="P1P1")
+      {
+        switch(InterpolationOptions::getIntersectionType())
+          {
+          case Triangulation:
+            return new PolyhedronIntersectorP1P1<MyMeshType,MatrixType>(targetMesh, srcMesh, getSplittingPolicy());
+          case PointLocator:
+            return new PointLocator3DIntersectorP1P1<MyMeshType,MatrixType>(targetMesh, srcMesh, getPrecision());
+          case Barycentric:
+            return new Barycentric3DIntersectorP1P1<MyMeshType,MatrixType>(targetMesh, srcMesh, getPrecision());
+          case MappedBarycentric:
+            return new MappedBarycentric3DIntersectorP1P1<MyMeshType,MatrixType>(targetMesh, srcMesh, getPrecision());
+          default:
+            throw INTERP_KERNEL::Exception("Invalid 3D intersection type for P1P1 interp specified : must be Triangle, PointLocator, Barycentric or MappedBarycentric.");
+          }
+      }
+    else
+      throw Exception("Invalid method chosen must be in \"P0P0\", \"P0P1\", \"P1P0\" or \"P1P1\".");
+  }
 }
 
 #endif
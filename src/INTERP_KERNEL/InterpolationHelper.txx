@@ -29,8 +29,12 @@
 
 namespace INTERP_KERNEL
 {
-  template<class MyMeshType>
-  BBTreeStandAlone<3,typename MyMeshType::MyConnType> BuildBBTreeWithAdjustment(const MyMeshType& srcMesh, std::function<void(double *,typename MyMeshType::MyConnType)> bboxAdjuster)
+  /*!
+   * Builds the tree of the bounding boxes of the cells of \a srcMesh, adjusted by \a bboxAdjuster.
+   * \a TreeType selects the tree implementation (see BBTreeStandAlone).
+   */
+  template<class MyMeshType, class TreeType = BBTreeFlat<3,typename MyMeshType::MyConnType> >
+  BBTreeStandAlone<3,typename MyMeshType::MyConnType,TreeType> BuildBBTreeWithAdjustment(const MyMeshType& srcMesh, std::function<void(double *,typename MyMeshType::MyConnType)> bboxAdjuster)
   {
     using ConnType = typename MyMeshType::MyConnType;
     const ConnType numSrcElems = srcMesh.getNumberOfElements();
@@ -47,12 +51,12 @@ namespace INTERP_KERNEL
         box->fillInXMinXmaxYminYmaxZminZmaxFormat(bboxes.get()+6*i);
       }
     bboxAdjuster(bboxes.get(),nbElts);
-    return BBTreeStandAlone<3,ConnType>(std::move(bboxes),numSrcElems);
+    return BBTreeStandAlone<3,ConnType,TreeType>(std::move(bboxes),numSrcElems);
   }
 
-  template<class MyMeshType>
-  BBTreeStandAlone<3,typename MyMeshType::MyConnType> BuildBBTree(const MyMeshType& srcMesh)
+  template<class MyMeshType, class TreeType = BBTreeFlat<3,typename MyMeshType::MyConnType> >
+  BBTreeStandAlone<3,typename MyMeshType::MyConnType,TreeType> BuildBBTree(const MyMeshType& srcMesh)
   {
-    return BuildBBTreeWithAdjustment(srcMesh,[](double *,typename MyMeshType::MyConnType){});
+    return BuildBBTreeWithAdjustment<MyMeshType,TreeType>(srcMesh,[](double *,typename MyMeshType::MyConnType){});
   }
 }
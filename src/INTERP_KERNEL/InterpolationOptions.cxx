@@ -56,6 +56,8 @@ const char INTERP_KERNEL::InterpolationOptions::INTERSEC_TYPE_STR[]="Intersectio
 
 const char INTERP_KERNEL::InterpolationOptions::SPLITTING_POLICY_STR[]="SplittingPolicy";
 
+const char INTERP_KERNEL::InterpolationOptions::NB_THREADS_STR[]="NbThreads";
+
 const char INTERP_KERNEL::InterpolationOptions::TRIANGULATION_INTERSECT2D_STR[]="Triangulation";
 
 const char INTERP_KERNEL::InterpolationOptions::CONVEX_INTERSECT2D_STR[]="Convex";
@@ -90,6 +92,7 @@ void INTERP_KERNEL::InterpolationOptions::init()
   _orientation=0;
   _measure_abs=true;
   _splitting_policy=PLANAR_FACE_5;
+  _nb_threads=1;
 }
 
 std::string INTERP_KERNEL::InterpolationOptions::getIntersectionTypeRepr() const
@@ -169,6 +172,11 @@ bool INTERP_KERNEL::InterpolationOptions::setOptionInt(const std::string& key, i
         setMeasureAbsStatus(valBool);
         return true;
       }
+    else if(key==NB_THREADS_STR)
+      {
+        setNbThreads(value);
+        return true;
+      }
     else
       return false;
 }
@@ -294,6 +302,7 @@ std::string INTERP_KERNEL::InterpolationOptions::printOptions() const
   oss << "Orientation : " << _orientation << std::endl;
   oss << "Measure abs : " << _measure_abs << std::endl;
   oss << "Splitting policy : " << getSplittingPolicyRepr() << std::endl;
+  oss << "Number of threads : " << _nb_threads << std::endl;
   oss << "****************************" << std::endl;
   return oss.str();
 }
@@ -54,6 +54,8 @@ namespace INTERP_KERNEL
     int _orientation ;
     bool _measure_abs;
     SplittingPolicy _splitting_policy ;
+    //! number of threads used to compute intersections. 1 (default) means sequential, 0 means all the hardware threads
+    int _nb_threads;
   public:
     InterpolationOptions() { init(); }
     int getPrintLevel() const { return _print_level; }
@@ -94,6 +96,9 @@ namespace INTERP_KERNEL
     void setSplittingPolicy(SplittingPolicy sp) { _splitting_policy=sp; }
     std::string getSplittingPolicyRepr() const;
 
+    int getNbThreads() const { return _nb_threads; }
+    void setNbThreads(int nbThreads) { _nb_threads=nbThreads; }
+
     std::string filterInterpolationMethod(const std::string& meth) const;
 
     void init();
@@ -134,6 +139,7 @@ namespace INTERP_KERNEL
     static const char MEASURE_ABS_STR[];
     static const char INTERSEC_TYPE_STR[];
     static const char SPLITTING_POLICY_STR[];
+    static const char NB_THREADS_STR[];
     static const char TRIANGULATION_INTERSECT2D_STR[];
     static const char CONVEX_INTERSECT2D_STR[];
     static const char GEOMETRIC_INTERSECT2D_STR[];
@@ -61,6 +61,9 @@ namespace INTERP_KERNEL
   protected:
     RealPlanar& asLeafInterpPlanar() { return static_cast<RealPlanar&>(*this); }
     const RealPlanar& asLeafInterpPlanar() const { return static_cast< const RealPlanar& >(*this); }
+  private:
+    template<class MyMeshType, class MatrixType>
+    PlanarIntersector<MyMeshType,MatrixType> *buildIntersector(const MyMeshType& meshS, const MyMeshType& meshT, const std::string& meth) const;
   };
 }
 
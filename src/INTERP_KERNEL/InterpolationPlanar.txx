@@ -44,12 +44,44 @@
 #include "MappedBarycentric2DIntersectorP1P1.txx"
 #include "VectorUtils.hxx"
 #include "BBTree.txx"
+#include "InterpKernelThreads.hxx"
+#include "InterpKernelMatrixRowsChunk.hxx"
 
 #include <limits>
+#include <memory>
+#include <algorithm>
 #include <time.h>
 
 namespace INTERP_KERNEL
 {
+  /*!
+   * Feeds \a result with the intersections of the target cells in [\a start, \a stop) : for each of these target cells,
+   * the source cells candidates are retrieved from \a tree and given to \a intersector.
+   * Returns the number of computed intersections.
+   */
+  template<class MyMeshType, class TreeType, class IntersectorType, class MatrixType>
+  std::size_t IntersectTargetCellsPlanar(const TreeType& tree, const MyMeshType& myMeshT, typename MyMeshType::MyConnType start, typename MyMeshType::MyConnType stop,
+                                         IntersectorType& intersector, MatrixType& result)
+  {
+    static const int SPACEDIM=MyMeshType::MY_SPACEDIM;
+    typedef typename MyMeshType::MyConnType ConnType;
+    static const NumberingPolicy numPol=MyMeshType::My_numPol;
+    std::size_t counter=0;
+    const ConnType *connIndxT=myMeshT.getConnectivityIndexPtr();
+    for(ConnType iT=start; iT<stop; iT++)
+      {
+        ConnType nb_nodesT=connIndxT[iT+1]-connIndxT[iT];
+        std::vector<ConnType> intersecting_elems;
+        double bb[2*SPACEDIM];
+        intersector.getElemBB(bb,myMeshT,OTT<ConnType,numPol>::indFC(iT),nb_nodesT);
+        tree.getIntersectingElems(bb, intersecting_elems);
+        intersector.intersectCells(iT,intersecting_elems,result);
+        counter+=intersecting_elems.size();
+        intersecting_elems.clear();
+      }
+    return counter;
+  }
+
   template<class RealPlanar>
   InterpolationPlanar<RealPlanar>::InterpolationPlanar():_dim_caracteristic(1)
                                                          
@@ -149,23 +181,99 @@ namespace INTERP_KERNEL
         std::cout << "InterpolationPlanar::computation of the intersections" << std::endl;
       }
     
-    PlanarIntersector<MyMeshType,MatrixType>* intersector=0;
     std::string meth = InterpolationOptions::filterInterpolationMethod(method);
+    std::unique_ptr< PlanarIntersector<MyMeshType,MatrixType> > intersector( buildIntersector<MyMeshType,MatrixType>(myMeshS,myMeshT,meth) );
+    /****************************************************************/
+    /* Create a search tree based on the bounding boxes             */
+    /* Instantiate the intersector and initialise the result vector */
+    /****************************************************************/
+ 
+    long start_filtering=clock();
+ 
+    std::vector<double> bbox;
+    intersector->createBoundingBoxes(myMeshS,bbox); // create the bounding boxes
+    performAdjustmentOfBB(intersector.get(),bbox);
+    const double *bboxPtr=0;
+    if(nbMailleS>0)
+      bboxPtr=&bbox[0];
+    BBTree<SPACEDIM,ConnType> my_tree(bboxPtr, 0, 0,nbMailleS);//creating the search structure 
+
+    long end_filtering=clock();
+
+    result.resize(intersector->getNumberOfRowsOfResMatrix());//on initialise.
+
+    /****************************************************/
+    /* Loop on the target cells - core of the algorithm */
+    /****************************************************/
+    long start_intersection=clock();
+    ConnType nbelem_type=myMeshT.getNumberOfElements();
+    const unsigned int nbThreads( EffectiveNumberOfThreads(InterpolationOptions::getNbThreads()) );
+    // For a P0 target, the row iT of the matrix is fed only by the target cell iT : target cells are dealt by several
+    // threads, each one with its own intersector (and Geometric2D precision context), while giving exactly the same
+    // matrix than the sequential mode. For a P1 target rows are shared by target cells and the sequential order is kept.
+    if(nbThreads>1 && meth.substr(2)=="P0")
+      {
+        typedef MatrixRowsChunk<MatrixType,ConnType> ChunkType;
+        const std::size_t nbOfChunks( std::min<std::size_t>( (std::size_t)nbelem_type, NB_OF_CHUNKS_PER_THREAD*nbThreads ) );
+        std::vector< std::unique_ptr<ChunkType> > chunks(nbOfChunks);
+        std::vector<std::size_t> counters(nbThreads,0);
+        ChunkDispatcher dispatcher(nbOfChunks);
+        ParallelRun((unsigned int)std::min<std::size_t>(nbThreads,nbOfChunks),[&](unsigned int threadId)
+          {
+            std::unique_ptr< PlanarIntersector<MyMeshType,ChunkType> > threadIntersector( buildIntersector<MyMeshType,ChunkType>(myMeshS,myMeshT,meth) );
+            std::size_t chunkId;
+            while(dispatcher.nextChunk(chunkId))
+              {
+                ConnType start,stop;
+                ChunkBounds(nbelem_type,nbOfChunks,chunkId,start,stop);
+                chunks[chunkId].reset( new ChunkType(start,stop) );
+                counters[threadId]+=IntersectTargetCellsPlanar(my_tree,myMeshT,start,stop,*threadIntersector,*chunks[chunkId]);
+              }
+          });
+        // merge is done in the order of target cells
+        for(typename std::vector< std::unique_ptr<ChunkType> >::iterator it=chunks.begin();it!=chunks.end();it++)
+          (*it)->mergeInto(result);
+        for(std::vector<std::size_t>::const_iterator it=counters.begin();it!=counters.end();it++)
+          counter+=*it;
+      }
+    else
+      counter=IntersectTargetCellsPlanar(my_tree,myMeshT,ConnType(0),nbelem_type,*intersector,result);
+    ConnType ret=intersector->getNumberOfColsOfResMatrix();
+
+    if (InterpolationOptions::getPrintLevel() >=1)
+      {
+        long end_intersection=clock();
+        std::cout << "Filtering time= " << end_filtering-start_filtering << std::endl;
+        std::cout << "Intersection time= " << end_intersection-start_intersection << std::endl;
+        long global_end =clock();    
+        std::cout << "Number of computed intersections = " << counter << std::endl;
+        std::cout << "Global time= " << global_end - global_start << std::endl;
+      }
+    return ret;
+  }
+
+  /*!
+   * Builds the intersector corresponding to the interpolation method \a meth and to the intersection type of \a this.
+   * The returned object has to be deallocated by the caller.
+   */
+  template<class RealPlanar>
+  template<class MyMeshType, class MatrixType>
+  PlanarIntersector<MyMeshType,MatrixType> *InterpolationPlanar<RealPlanar>::buildIntersector(const MyMeshType& myMeshS, const MyMeshType& myMeshT, const std::string& meth) const
+  {
     if(meth=="P0P0")
       {
         switch (InterpolationOptions::getIntersectionType())
           {
           case Triangulation:
-            intersector=new TriangulationIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P0>(myMeshT,myMeshS,_dim_caracteristic,
+            return new TriangulationIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P0>(myMeshT,myMeshS,_dim_caracteristic,
                                                                                                   InterpolationOptions::getPrecision(),
                                                                                                   InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                                   InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                                                   InterpolationOptions::getMedianPlane(),
                                                                                                   InterpolationOptions::getOrientation(),
                                                                                                   InterpolationOptions::getPrintLevel());
-            break;
           case Convex:
-            intersector=new ConvexIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P0>(myMeshT,myMeshS,_dim_caracteristic,
+            return new ConvexIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P0>(myMeshT,myMeshS,_dim_caracteristic,
                                                                                            InterpolationOptions::getPrecision(),
                                                                                            InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                            InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
@@ -173,23 +281,20 @@ namespace INTERP_KERNEL
                                                                                            InterpolationOptions::getDoRotate(),
                                                                                            InterpolationOptions::getOrientation(),
                                                                                            InterpolationOptions::getPrintLevel());
-            break;
           case Geometric2D:
-            intersector=new Geometric2DIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P0>(myMeshT, myMeshS, _dim_caracteristic,
+            return new Geometric2DIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P0>(myMeshT, myMeshS, _dim_caracteristic,
                                                                                                 InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                                 InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                                                 InterpolationOptions::getMedianPlane(),
                                                                                                 InterpolationOptions::getPrecision(),
                                                                                                 InterpolationOptions::getOrientation());
-            break;
           case PointLocator:
-            intersector=new PointLocator2DIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P0>(myMeshT, myMeshS, _dim_caracteristic,
+            return new PointLocator2DIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P0>(myMeshT, myMeshS, _dim_caracteristic,
                                                                                                    InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                                    InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                                                    InterpolationOptions::getMedianPlane(),
                                                                                                    InterpolationOptions::getPrecision(),
                                                                                                    InterpolationOptions::getOrientation());
-            break;
           default:
             throw INTERP_KERNEL::Exception("For P0P0 planar interpolation possibities are : Triangulation, Convex, Geometric2D, PointLocator !");
           }
@@ -199,16 +304,15 @@ namespace INTERP_KERNEL
         switch (InterpolationOptions::getIntersectionType())
           {
           case Triangulation:
-            intersector=new TriangulationIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P1>(myMeshT,myMeshS,_dim_caracteristic,
+            return new TriangulationIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P1>(myMeshT,myMeshS,_dim_caracteristic,
                                                                                                   InterpolationOptions::getPrecision(),
                                                                                                   InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                                   InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                                                   InterpolationOptions::getMedianPlane(),
                                                                                                   InterpolationOptions::getOrientation(),
                                                                                                   InterpolationOptions::getPrintLevel());
-            break;
           case Convex:
-            intersector=new ConvexIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P1>(myMeshT,myMeshS,_dim_caracteristic,
+            return new ConvexIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P1>(myMeshT,myMeshS,_dim_caracteristic,
                                                                                            InterpolationOptions::getPrecision(),
                                                                                            InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                            InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
@@ -216,40 +320,35 @@ namespace INTERP_KERNEL
                                                                                            InterpolationOptions::getDoRotate(),
                                                                                            InterpolationOptions::getOrientation(),
                                                                                            InterpolationOptions::getPrintLevel());
-            break;
           case Geometric2D:
-            intersector=new Geometric2DIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P1>(myMeshT, myMeshS, _dim_caracteristic,
+            return new Geometric2DIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P1>(myMeshT, myMeshS, _dim_caracteristic,
                                                                                                 InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                                 InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                                                 InterpolationOptions::getMedianPlane(),
                                                                                                 InterpolationOptions::getPrecision(),
                                                                                                 InterpolationOptions::getOrientation());
-            break;
           case PointLocator:
-            intersector=new PlanarIntersectorP0P1PL<MyMeshType,MatrixType>(myMeshT, myMeshS, _dim_caracteristic,
+            return new PlanarIntersectorP0P1PL<MyMeshType,MatrixType>(myMeshT, myMeshS, _dim_caracteristic,
                                                                            InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                            InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                            InterpolationOptions::getMedianPlane(),
                                                                            InterpolationOptions::getPrecision(),
                                                                            InterpolationOptions::getOrientation());
-            break;
           case Barycentric:
-            intersector=new TriangulationIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P1Bary>(myMeshT,myMeshS,_dim_caracteristic,
+            return new TriangulationIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P1Bary>(myMeshT,myMeshS,_dim_caracteristic,
                                                                                                       InterpolationOptions::getPrecision(),
                                                                                                       InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                                       InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                                                       InterpolationOptions::getMedianPlane(),
                                                                                                       InterpolationOptions::getOrientation(),
                                                                                                       InterpolationOptions::getPrintLevel());
-            break;
           case BarycentricGeo2D:
-            intersector=new Geometric2DIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P1Bary>(myMeshT, myMeshS, _dim_caracteristic,
+            return new Geometric2DIntersector<MyMeshType,MatrixType,PlanarIntersectorP0P1Bary>(myMeshT, myMeshS, _dim_caracteristic,
                                                                                                     InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                                     InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                                                     InterpolationOptions::getMedianPlane(),
                                                                                                     InterpolationOptions::getPrecision(),
                                                                                                     InterpolationOptions::getOrientation());
-            break;
           default:
             throw INTERP_KERNEL::Exception("For P0P1 planar interpolation possibities are : Triangulation, Convex, Geometric2D, PointLocator, Barycentric, BarycentricGeo2D !");
           }
@@ -259,16 +358,15 @@ namespace INTERP_KERNEL
         switch (InterpolationOptions::getIntersectionType())
           {
           case Triangulation:
-            intersector=new TriangulationIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P0>(myMeshT,myMeshS,_dim_caracteristic,
+            return new TriangulationIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P0>(myMeshT,myMeshS,_dim_caracteristic,
                                                                                                   InterpolationOptions::getPrecision(),
                                                                                                   InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                                   InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                                                   InterpolationOptions::getMedianPlane(),
                                                                                                   InterpolationOptions::getOrientation(),
                                                                                                   InterpolationOptions::getPrintLevel());
-            break;
           case Convex:
-            intersector=new ConvexIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P0>(myMeshT,myMeshS,_dim_caracteristic,
+            return new ConvexIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P0>(myMeshT,myMeshS,_dim_caracteristic,
                                                                                            InterpolationOptions::getPrecision(),
                                                                                            InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                            InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
@@ -276,40 +374,35 @@ namespace INTERP_KERNEL
                                                                                            InterpolationOptions::getDoRotate(),
                                                                                            InterpolationOptions::getOrientation(),
                                                                                            InterpolationOptions::getPrintLevel());
-            break;
           case Geometric2D:
-            intersector=new Geometric2DIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P0>(myMeshT, myMeshS, _dim_caracteristic,
+            return new Geometric2DIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P0>(myMeshT, myMeshS, _dim_caracteristic,
                                                                                                 InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                                 InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                                                 InterpolationOptions::getMedianPlane(),
                                                                                                 InterpolationOptions::getPrecision(),
                                                                                                 InterpolationOptions::getOrientation());
-            break;
           case PointLocator:
-            intersector=new PlanarIntersectorP1P0PL<MyMeshType,MatrixType>(myMeshT, myMeshS, _dim_caracteristic,
+            return new PlanarIntersectorP1P0PL<MyMeshType,MatrixType>(myMeshT, myMeshS, _dim_caracteristic,
                                                                            InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                            InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                            InterpolationOptions::getMedianPlane(),
                                                                            InterpolationOptions::getPrecision(),
                                                                            InterpolationOptions::getOrientation());
-            break;
           case Barycentric:
-             intersector=new TriangulationIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P0Bary>(myMeshT,myMeshS,_dim_caracteristic,
+             return new TriangulationIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P0Bary>(myMeshT,myMeshS,_dim_caracteristic,
                                                                                                        InterpolationOptions::getPrecision(),
                                                                                                        InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                                        InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                                                        InterpolationOptions::getMedianPlane(),
                                                                                                        InterpolationOptions::getOrientation(),
                                                                                                        InterpolationOptions::getPrintLevel());
-             break;
           case BarycentricGeo2D:
-            intersector=new Geometric2DIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P0Bary>(myMeshT, myMeshS, _dim_caracteristic,
+            return new Geometric2DIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P0Bary>(myMeshT, myMeshS, _dim_caracteristic,
                                                                                                     InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                                     InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                                                     InterpolationOptions::getMedianPlane(),
                                                                                                     InterpolationOptions::getPrecision(),
                                                                                                     InterpolationOptions::getOrientation());
-            break;
           default:
             throw INTERP_KERNEL::Exception("For P1P0 planar interpolation possibities are : Triangulation, Convex, Geometric2D, PointLocator, BarycentricGeo2D or Barycentric!");
           }
@@ -319,16 +412,15 @@ namespace INTERP_KERNEL
         switch (InterpolationOptions::getIntersectionType())
           {
           case Triangulation:
-            intersector=new TriangulationIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P1>(myMeshT,myMeshS,_dim_caracteristic,
+            return new TriangulationIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P1>(myMeshT,myMeshS,_dim_caracteristic,
                                                                                                   InterpolationOptions::getPrecision(),
                                                                                                   InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                                   InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                                                   InterpolationOptions::getMedianPlane(),
                                                                                                   InterpolationOptions::getOrientation(),
                                                                                                   InterpolationOptions::getPrintLevel());
-            break;
           case Convex:
-            intersector=new ConvexIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P1>(myMeshT,myMeshS,_dim_caracteristic,
+            return new ConvexIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P1>(myMeshT,myMeshS,_dim_caracteristic,
                                                                                            InterpolationOptions::getPrecision(),
                                                                                            InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                            InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
@@ -336,86 +428,33 @@ namespace INTERP_KERNEL
                                                                                            InterpolationOptions::getDoRotate(),
                                                                                            InterpolationOptions::getOrientation(),
                                                                                            InterpolationOptions::getPrintLevel());
-            break;
           case Geometric2D:
-            intersector=new Geometric2DIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P1>(myMeshT, myMeshS, _dim_caracteristic,
+            return new Geometric2DIntersector<MyMeshType,MatrixType,PlanarIntersectorP1P1>(myMeshT, myMeshS, _dim_caracteristic,
                                                                                                 InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                                 InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                                                 InterpolationOptions::getMedianPlane(),
                                                                                                 InterpolationOptions::getPrecision(),
                                                                                                 InterpolationOptions::getOrientation());
-            break;
           case PointLocator:
-            intersector=new PlanarIntersectorP1P1PL<MyMeshType,MatrixType>(myMeshT, myMeshS, _dim_caracteristic,
+            return new PlanarIntersectorP1P1PL<MyMeshType,MatrixType>(myMeshT, myMeshS, _dim_caracteristic,
                                                                            InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                            InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                            InterpolationOptions::getMedianPlane(),
                                                                            InterpolationOptions::getPrecision(),
                                                                            InterpolationOptions::getOrientation());
-            break;
           case MappedBarycentric:
-            intersector=new MappedBarycentric2DIntersectorP1P1<MyMeshType,MatrixType>(myMeshT, myMeshS, _dim_caracteristic,
+            return new MappedBarycentric2DIntersectorP1P1<MyMeshType,MatrixType>(myMeshT, myMeshS, _dim_caracteristic,
                                                                                      InterpolationOptions::getMaxDistance3DSurfIntersect(),
                                                                                      InterpolationOptions::getMinDotBtwPlane3DSurfIntersect(),
                                                                                      InterpolationOptions::getMedianPlane(),
                                                                                      InterpolationOptions::getPrecision(),
                                                                                      InterpolationOptions::getOrientation());
-            break;
           default:
             throw INTERP_KERNEL::Exception("For P1P1 planar interpolation possibities are : Triangulation, Convex, Geometric2D, PointLocator, MappedBarycentric !");
           }
       }
     else
       throw INTERP_KERNEL::Exception("Invalid method specified or intersection type ! Must be in : \"P0P0\" \"P0P1\" \"P1P0\" or \"P1P1\"");
-    /****************************************************************/
-    /* Create a search tree based on the bounding boxes             */
-    /* Instantiate the intersector and initialise the result vector */
-    /****************************************************************/
- 
-    long start_filtering=clock();
- 
-    std::vector<double> bbox;
-    intersector->createBoundingBoxes(myMeshS,bbox); // create the bounding boxes
-    performAdjustmentOfBB(intersector,bbox);
-    const double *bboxPtr=0;
-    if(nbMailleS>0)
-      bboxPtr=&bbox[0];
-    BBTree<SPACEDIM,ConnType> my_tree(bboxPtr, 0, 0,nbMailleS);//creating the search structure 
-
-    long end_filtering=clock();
-
-    result.resize(intersector->getNumberOfRowsOfResMatrix());//on initialise.
-
-    /****************************************************/
-    /* Loop on the target cells - core of the algorithm */
-    /****************************************************/
-    long start_intersection=clock();
-    ConnType nbelem_type=myMeshT.getNumberOfElements();
-    const ConnType *connIndxT=myMeshT.getConnectivityIndexPtr();
-    for(ConnType iT=0; iT<nbelem_type; iT++)
-      {
-        ConnType nb_nodesT=connIndxT[iT+1]-connIndxT[iT];
-        std::vector<ConnType> intersecting_elems;
-        double bb[2*SPACEDIM];
-        intersector->getElemBB(bb,myMeshT,OTT<ConnType,numPol>::indFC(iT),nb_nodesT);
-        my_tree.getIntersectingElems(bb, intersecting_elems);
-        intersector->intersectCells(iT,intersecting_elems,result);
-        counter+=intersecting_elems.size();
-        intersecting_elems.clear();
-      }
-    ConnType ret=intersector->getNumberOfColsOfResMatrix();
-    delete intersector;
-
-    if (InterpolationOptions::getPrintLevel() >=1)
-      {
-        long end_intersection=clock();
-        std::cout << "Filtering time= " << end_filtering-start_filtering << std::endl;
-        std::cout << "Intersection time= " << end_intersection-start_intersection << std::endl;
-        long global_end =clock();    
-        std::cout << "Number of computed intersections = " << counter << std::endl;
-        std::cout << "Global time= " << global_end - global_start << std::endl;
-      }
-    return ret;
   }
 }
 
@@ -83,6 +83,63 @@ namespace INTERP_TEST
     delete[] bbox;
   }
 
+  /**
+   * Test that BBTreeFlat gives exactly the same results (same elements in the same order) than BBTree,
+   * for single and bulk queries, on overlapping boxes of various sizes.
+   */
+  void BBTreeTest::test_BBTreeFlat()
+  {
+    const int N=3000;
+    std::vector<double> bbox(6*N);
+    unsigned int seed(12345);
+    for (int i=0; i<6*N; i+=2)
+      {
+        seed=seed*1103515245u+12345u;
+        double lo((double)((seed>>8)%10000)/1000.);
+        seed=seed*1103515245u+12345u;
+        double len((double)(1+(seed>>8)%1000)/1000.);
+        bbox[i]=lo;
+        bbox[i+1]=lo+len;
+      }
+    BBTree<3> tree(&bbox[0],0,0,N);
+    BBTreeFlat<3> flatTree(&bbox[0],0,0,N);
+    CPPUNIT_ASSERT_EQUAL(N,flatTree.size());
+    const int NB_OF_QUERIES=200;
+    std::vector<double> queries(6*NB_OF_QUERIES);
+    std::copy(bbox.begin()+6*(N-NB_OF_QUERIES),bbox.end(),queries.begin());
+    std::vector<int> allElems,allElemsIndex(1,0);
+    for (int i=0; i<NB_OF_QUERIES; i++)
+      {
+        std::vector<int> elems,flatElems;
+        tree.getIntersectingElems(&queries[6*i],elems);
+        flatTree.getIntersectingElems(&queries[6*i],flatElems);
+        CPPUNIT_ASSERT(!elems.empty());
+        CPPUNIT_ASSERT(elems==flatElems);
+        CPPUNIT_ASSERT_EQUAL((int)elems.size(),flatTree.getNbOfIntersectingElems(&queries[6*i]));
+        allElems.insert(allElems.end(),elems.begin(),elems.end());
+        allElemsIndex.push_back((int)allElems.size());
+        elems.clear(); flatElems.clear();
+        double xx[3]={queries[6*i],queries[6*i+2],queries[6*i+4]};
+        tree.getElementsAroundPoint(xx,elems);
+        flatTree.getElementsAroundPoint(xx,flatElems);
+        CPPUNIT_ASSERT(!elems.empty());
+        CPPUNIT_ASSERT(elems==flatElems);
+      }
+    std::vector<int> bulkElems,bulkElemsIndex;
+    flatTree.getIntersectingElems(&queries[0],NB_OF_QUERIES,bulkElems,bulkElemsIndex);
+    CPPUNIT_ASSERT(allElems==bulkElems);
+    CPPUNIT_ASSERT(allElemsIndex==bulkElemsIndex);
+    // box outside the tree
+    double bbox1[6]={-2.0, -1.0, 0.0, 1.0, 0.0, 1.0};
+    std::vector<int> elems;
+    flatTree.getIntersectingElems(bbox1,elems);
+    CPPUNIT_ASSERT(elems.empty());
+    // empty tree
+    BBTreeFlat<3> emptyTree(&bbox[0],0,0,0);
+    emptyTree.getIntersectingElems(&queries[0],elems);
+    CPPUNIT_ASSERT(elems.empty());
+  }
+
   void BBTreeTest::test_DirectedBB_3D()
   {
     // a rectangle 1x2 extruded along vector (10,0,10)
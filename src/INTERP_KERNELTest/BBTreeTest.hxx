@@ -24,6 +24,7 @@
 
 #include "InterpKernelTestExport.hxx"
 #include "BBTree.txx"
+#include "BBTreeFlat.txx"
 
 namespace INTERP_TEST
 {
@@ -37,6 +38,7 @@ namespace INTERP_TEST
 
     CPPUNIT_TEST_SUITE( BBTreeTest );
     CPPUNIT_TEST( test_BBTree );
+    CPPUNIT_TEST( test_BBTreeFlat );
     CPPUNIT_TEST( test_DirectedBB_1D );
     CPPUNIT_TEST( test_DirectedBB_2D );
     CPPUNIT_TEST( test_DirectedBB_3D );
@@ -50,6 +52,7 @@ namespace INTERP_TEST
 
     // tests
     void test_BBTree();
+    void test_BBTreeFlat();
     void test_DirectedBB_1D();
     void test_DirectedBB_2D();
     void test_DirectedBB_3D();
@@ -24,6 +24,7 @@
 #include "GenMathFormulae.hxx"
 #include "InterpKernelAutoPtr.hxx"
 #include "InterpKernelExprParser.hxx"
+#include "InterpKernelThreads.hxx"
 
 #include "InterpKernelAutoPtr.hxx"
 #include "InterpKernelGeo2DEdgeArcCircle.hxx"
@@ -42,6 +43,41 @@ typedef double (*MYFUNCPTR)(double);
 
 using namespace MEDCoupling;
 
+namespace
+{
+  /*!
+   * Evaluates \a expr (prepared by prepareExprEvaluationDouble and prepareFastEvaluator) on \a nbOfTuples tuples, by blocks of tuples
+   * and using MEDCouplingGetNumberOfThreads() threads. See INTERP_KERNEL::ExprParserOfEvalByBlock::evaluate for the meaning of the parameters,
+   * \a output may be \a input.
+   * Returns \a nbOfTuples, or if \a isSafe and the evaluation failed, the first tuple of the failing block of the first failing chunk. All the tuples
+   * before it have been evaluated and written, the caller can then evaluate again tuple by tuple from it to report the error.
+   */
+  mcIdType EvaluateExprByBlock(const INTERP_KERNEL::ExprParser& expr, const double *input, std::size_t inputStride, double *output, std::size_t outputStride, mcIdType nbOfTuples, bool isSafe)
+  {
+    INTERP_KERNEL::ExprParserOfEvalByBlock evaluator(expr);
+    unsigned int nbThreads(INTERP_KERNEL::EffectiveNumberOfThreads(MEDCouplingGetNumberOfThreads()));
+    std::size_t nbOfBlocks(((std::size_t)nbOfTuples+INTERP_KERNEL::ExprParserOfEvalByBlock::BLOCK_SIZE-1)/INTERP_KERNEL::ExprParserOfEvalByBlock::BLOCK_SIZE);
+    std::size_t nbOfChunks(std::min(nbOfBlocks,nbThreads*INTERP_KERNEL::NB_OF_CHUNKS_PER_THREAD));
+    if(nbThreads==1 || nbOfChunks<=1)
+      return ToIdType(evaluator.evaluate(input,inputStride,output,outputStride,nbOfTuples,isSafe));
+    std::vector<mcIdType> stopOfChunks(nbOfChunks);
+    INTERP_KERNEL::ParallelForEachChunk(nbThreads,nbOfChunks,[&](unsigned int, std::size_t chunkId)
+      {
+        mcIdType start,stop;
+        INTERP_KERNEL::ChunkBounds(nbOfTuples,nbOfChunks,chunkId,start,stop);
+        stopOfChunks[chunkId]=start+ToIdType(evaluator.evaluate(input+start*inputStride,inputStride,output+start*outputStride,outputStride,stop-start,isSafe));
+      });
+    for(std::size_t chunkId=0;chunkId<nbOfChunks;chunkId++)
+      {
+        mcIdType start,stop;
+        INTERP_KERNEL::ChunkBounds(nbOfTuples,nbOfChunks,chunkId,start,stop);
+        if(stopOfChunks[chunkId]!=stop)
+          return stopOfChunks[chunkId];
+      }
+    return nbOfTuples;
+  }
+}
+
 template class MEDCOUPLING_EXPORT MEDCoupling::MemArray<mcIdType>;
 template class MEDCOUPLING_EXPORT MEDCoupling::MemArray<double>;
 template class MEDCOUPLING_EXPORT MEDCoupling::DataArrayTemplate<mcIdType>;
@@ -2742,41 +2778,24 @@ DataArrayDouble *DataArrayDouble::applyFunc(const std::string& func, bool isSafe
   std::vector<double> stck;
   expr.prepareExprEvaluationDouble(vars2,1,1,0,&buff,&buff+1);
   expr.prepareFastEvaluator();
-  if(!isSafe)
-    {
-      for(mcIdType i=0;i<nbOfTuples;i++)
-        {
-          for(std::size_t iComp=0;iComp<nbOfComp;iComp++,ptr++,ptrToFill++)
-            {
-              buff=*ptr;
-              expr.evaluateDoubleInternal(stck);
-              *ptrToFill=stck.back();
-              stck.pop_back();
-            }
-        }
-    }
-  else
+  mcIdType nbOfVals(nbOfTuples*ToIdType(nbOfComp));
+  // if the evaluation fails, evaluate again value by value from the failing block to locate the failure
+  for(mcIdType pos=EvaluateExprByBlock(expr,ptr,1,ptrToFill,1,nbOfVals,isSafe);pos<nbOfVals;pos++)
     {
-      for(mcIdType i=0;i<nbOfTuples;i++)
-        {
-          for(std::size_t iComp=0;iComp<nbOfComp;iComp++,ptr++,ptrToFill++)
-            {
-              buff=*ptr;
-              try
-              {
-                  expr.evaluateDoubleInternalSafe(stck);
-              }
-              catch(INTERP_KERNEL::Exception& e)
-              {
-                  std::ostringstream oss; oss << "For tuple # " << i << " component # " << iComp << " with value (";
-                  oss << buff;
-                  oss << ") : Evaluation of function failed !" << e.what();
-                  throw INTERP_KERNEL::Exception(oss.str().c_str());
-              }
-              *ptrToFill=stck.back();
-              stck.pop_back();
-            }
-        }
+      buff=ptr[pos];
+      try
+      {
+          expr.evaluateDoubleInternalSafe(stck);
+      }
+      catch(INTERP_KERNEL::Exception& e)
+      {
+          std::ostringstream oss; oss << "For tuple # " << pos/ToIdType(nbOfComp) << " component # " << pos%ToIdType(nbOfComp) << " with value (";
+          oss << buff;
+          oss << ") : Evaluation of function failed !" << e.what();
+          throw INTERP_KERNEL::Exception(oss.str().c_str());
+      }
+      ptrToFill[pos]=stck.back();
+      stck.pop_back();
     }
   return newArr.retn();
 }
@@ -2791,6 +2810,7 @@ DataArrayDouble *DataArrayDouble::applyFunc(const std::string& func, bool isSafe
  *              Supported expressions are described \ref MEDCouplingArrayApplyFuncExpr "here".
  *  \param [in] isSafe - By default true. If true invalid operation (division by 0. acos of value > 1. ...) leads to a throw of an exception.
  *              If false the computation is carried on without any notification. When false the evaluation is a little faster.
+ *              As the evaluation is done in place, the values before the failing one are modified when the exception is thrown.
  *
  * \sa applyFunc
  */
@@ -2827,41 +2847,27 @@ void DataArrayDouble::applyFuncOnThis(const std::string& func, bool isSafe)
   std::vector<double> stck;
   expr.prepareExprEvaluationDouble(vars2,1,1,0,&buff,&buff+1);
   expr.prepareFastEvaluator();
-  if(!isSafe)
-    {
-      for(mcIdType i=0;i<nbOfTuples;i++)
-        {
-          for(std::size_t iComp=0;iComp<nbOfComp;iComp++,ptr++,ptrToFill++)
-            {
-              buff=*ptr;
-              expr.evaluateDoubleInternal(stck);
-              *ptrToFill=stck.back();
-              stck.pop_back();
-            }
-        }
-    }
-  else
+  mcIdType nbOfVals(nbOfTuples*ToIdType(nbOfComp));
+  // evaluated in place : if the evaluation fails, the values before the failing block are already modified and the
+  // others are evaluated again value by value, as before the evaluation by blocks, to locate the failure
+  mcIdType pos(EvaluateExprByBlock(expr,ptr,1,ptrToFill,1,nbOfVals,isSafe));
+  declareAsNew();
+  for(;pos<nbOfVals;pos++)
     {
-      for(mcIdType i=0;i<nbOfTuples;i++)
-        {
-          for(std::size_t iComp=0;iComp<nbOfComp;iComp++,ptr++,ptrToFill++)
-            {
-              buff=*ptr;
-              try
-              {
-                  expr.evaluateDoubleInternalSafe(stck);
-              }
-              catch(INTERP_KERNEL::Exception& e)
-              {
-                  std::ostringstream oss; oss << "For tuple # " << i << " component # " << iComp << " with value (";
-                  oss << buff;
-                  oss << ") : Evaluation of function failed !" << e.what();
-                  throw INTERP_KERNEL::Exception(oss.str().c_str());
-              }
-              *ptrToFill=stck.back();
-              stck.pop_back();
-            }
-        }
+      buff=ptr[pos];
+      try
+      {
+          expr.evaluateDoubleInternalSafe(stck);
+      }
+      catch(INTERP_KERNEL::Exception& e)
+      {
+          std::ostringstream oss; oss << "For tuple # " << pos/ToIdType(nbOfComp) << " component # " << pos%ToIdType(nbOfComp) << " with value (";
+          oss << buff;
+          oss << ") : Evaluation of function failed !" << e.what();
+          throw INTERP_KERNEL::Exception(oss.str().c_str());
+      }
+      ptrToFill[pos]=stck.back();
+      stck.pop_back();
     }
 }
 
@@ -2937,35 +2943,24 @@ DataArrayDouble *DataArrayDouble::applyFuncNamedCompo(std::size_t nbOfComp, cons
       expr.prepareFastEvaluator();
       const double *ptr(getConstPointer());
       ptrToFill=newArr->getPointer()+iComp;
-      if(!isSafe)
+      // if the evaluation fails, evaluate again tuple by tuple from the failing block to locate the failure
+      mcIdType i(EvaluateExprByBlock(expr,ptr,oldNbOfComp,ptrToFill,nbOfComp,nbOfTuples,isSafe));
+      for(ptrToFill+=i*nbOfComp,ptr+=i*oldNbOfComp;i<nbOfTuples;i++,ptrToFill+=nbOfComp,ptr+=oldNbOfComp)
         {
-          for(mcIdType i=0;i<nbOfTuples;i++,ptrToFill+=nbOfComp,ptr+=oldNbOfComp)
-            {
-              std::copy(ptr,ptr+oldNbOfComp,buffPtr);
-              expr.evaluateDoubleInternal(stck);
+          std::copy(ptr,ptr+oldNbOfComp,buffPtr);
+          try
+          {
+              expr.evaluateDoubleInternalSafe(stck);
               *ptrToFill=stck.back();
               stck.pop_back();
-            }
-        }
-      else
-        {
-          for(mcIdType i=0;i<nbOfTuples;i++,ptrToFill+=nbOfComp,ptr+=oldNbOfComp)
-            {
-              std::copy(ptr,ptr+oldNbOfComp,buffPtr);
-              try
-              {
-                  expr.evaluateDoubleInternalSafe(stck);
-                  *ptrToFill=stck.back();
-                  stck.pop_back();
-              }
-              catch(INTERP_KERNEL::Exception& e)
-              {
-                  std::ostringstream oss; oss << "For tuple # " << i << " with value (";
-                  std::copy(ptr+oldNbOfComp*i,ptr+oldNbOfComp*(i+1),std::ostream_iterator<double>(oss,", "));
-                  oss << ") : Evaluation of function failed !" << e.what();
-                  throw INTERP_KERNEL::Exception(oss.str().c_str());
-              }
-            }
+          }
+          catch(INTERP_KERNEL::Exception& e)
+          {
+              std::ostringstream oss; oss << "For tuple # " << i << " with value (";
+              std::copy(ptr,ptr+oldNbOfComp,std::ostream_iterator<double>(oss,", "));
+              oss << ") : Evaluation of function failed !" << e.what();
+              throw INTERP_KERNEL::Exception(oss.str().c_str());
+          }
         }
     }
   return newArr.retn();
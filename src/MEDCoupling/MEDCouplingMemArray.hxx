@@ -28,6 +28,7 @@
 #include "InterpKernelException.hxx"
 #include "MEDCouplingTraits.hxx"
 #include "MEDCouplingMap.hxx"
+#include "MEDCouplingMemoryPool.hxx"
 #include "BBTreePts.txx"
 
 #include <string>
@@ -96,6 +97,8 @@ namespace MEDCoupling
     void reAlloc(std::size_t newNbOfElements);
     void useArray(const T *array, bool ownership, DeallocType type, std::size_t nbOfElem);
     void useExternalArrayWithRWAccess(const T *array, std::size_t nbOfElem);
+    void useExternalArrayWithDeallocator(T *array, std::size_t nbOfElem, Deallocator dealloc, void *param);
+    void useReadOnlyArrayWithDeallocator(const T *array, std::size_t nbOfElem, Deallocator dealloc, void *param);
     void writeOnPlace(std::size_t id, T element0, const T *others, std::size_t sizeOfOthers);
     template<class InputIterator>
     void insertAtTheEnd(InputIterator first, InputIterator last);
@@ -114,6 +117,7 @@ namespace MEDCoupling
     static void CDeallocator(void *pt, void *param);
     static void COffsetDeallocator(void *pt, void *param);
   private:
+    static T *AllocateRaw(std::size_t nbOfElements, Deallocator& dealloc, void *& param);
     static void DestroyPointer(T *pt, Deallocator dealloc, void *param);
     static Deallocator BuildFromType(DeallocType type);
   private:
@@ -259,6 +263,9 @@ namespace MEDCoupling
     void alloc(std::size_t nbOfTuple, std::size_t nbOfCompo=1);
     void useArray(const T *array, bool ownership, DeallocType type, std::size_t nbOfTuple, std::size_t nbOfCompo);
     void useExternalArrayWithRWAccess(const T *array, std::size_t nbOfTuple, std::size_t nbOfCompo);
+    void useExternalArrayWithDeallocator(T *array, std::size_t nbOfTuple, std::size_t nbOfCompo, typename MemArray<T>::Deallocator dealloc, void *param=0);
+    void writeRawFile(const std::string& fileName, std::int64_t tag=0) const;
+    std::int64_t useMappedRawFile(const std::string& fileName, bool copyOnWrite=false);
     T getIJSafe(std::size_t tupleId, std::size_t compoId) const;
     T getIJ(std::size_t tupleId, std::size_t compoId) const { return _mem[tupleId*_info_on_compo.size()+compoId]; }
     void setIJ(std::size_t tupleId, std::size_t compoId, T newVal) { _mem[tupleId*_info_on_compo.size()+compoId]=newVal; declareAsNew(); }
@@ -30,6 +30,8 @@
 #include "MCAuto.hxx"
 #include "MEDCouplingMap.txx"
 #include "BBTreeDiscrete.txx"
+#include "MEDCouplingParallelAlgorithms.txx"
+#include "MEDCouplingRawFile.hxx"
 
 #include <set>
 #include <sstream>
@@ -59,10 +61,11 @@ namespace MEDCoupling
   {
     if(!other._pointer.isNull())
       {
-        _nb_of_elem_alloc=other._nb_of_elem;
-        T *pointer=(T*)malloc(_nb_of_elem_alloc*sizeof(T));
+        Deallocator dealloc;
+        void *param;
+        T *pointer(AllocateRaw(other._nb_of_elem,dealloc,param));
         std::copy(other._pointer.getConstPointer(),other._pointer.getConstPointer()+other._nb_of_elem,pointer);
-        useArray(pointer,true,DeallocType::C_DEALLOC,other._nb_of_elem);
+        useExternalArrayWithDeallocator(pointer,other._nb_of_elem,dealloc,param);
       }
   }
 
@@ -91,6 +94,30 @@ namespace MEDCoupling
     _dealloc=CPPDeallocator;
   }
 
+  template<class T>
+  void MemArray<T>::useExternalArrayWithDeallocator(T *array, std::size_t nbOfElem, Deallocator dealloc, void *param)
+  {
+    destroy();
+    _nb_of_elem=nbOfElem;
+    _nb_of_elem_alloc=nbOfElem;
+    _pointer.setInternal(array);
+    _ownership=dealloc!=0;
+    _dealloc=dealloc;
+    _param_for_deallocator=param;
+  }
+
+  template<class T>
+  void MemArray<T>::useReadOnlyArrayWithDeallocator(const T *array, std::size_t nbOfElem, Deallocator dealloc, void *param)
+  {
+    destroy();
+    _nb_of_elem=nbOfElem;
+    _nb_of_elem_alloc=nbOfElem;
+    _pointer.setExternal(array);
+    _ownership=dealloc!=0;
+    _dealloc=dealloc;
+    _param_for_deallocator=param;
+  }
+
   template<class T>
   void MemArray<T>::writeOnPlace(std::size_t id, T element0, const T *others, std::size_t sizeOfOthers)
   {
@@ -335,14 +362,7 @@ namespace MEDCoupling
   void MemArray<T>::sort(bool asc)
   {
     T *pt=_pointer.getPointer();
-    if(asc)
-      std::sort(pt,pt+_nb_of_elem);
-    else
-      {
-        typename std::reverse_iterator<T *> it1(pt+_nb_of_elem);
-        typename std::reverse_iterator<T *> it2(pt);
-        std::sort(it1,it2);
-      }
+    ParallelSort(pt,pt+_nb_of_elem,asc);
   }
 
   template<class T>
@@ -374,9 +394,8 @@ namespace MEDCoupling
     destroy();
     _nb_of_elem=nbOfElements;
     _nb_of_elem_alloc=nbOfElements;
-    _pointer.setInternal((T*)malloc(_nb_of_elem_alloc*sizeof(T)));
+    _pointer.setInternal(AllocateRaw(nbOfElements,_dealloc,_param_for_deallocator));
     _ownership=true;
-    _dealloc=CDeallocator;
   }
 
   /*!
@@ -393,7 +412,9 @@ namespace MEDCoupling
   {
     if(_nb_of_elem_alloc==newNbOfElements)
       return ;
-    T *pointer=(T*)malloc(newNbOfElements*sizeof(T));
+    Deallocator dealloc;
+    void *param;
+    T *pointer(AllocateRaw(newNbOfElements,dealloc,param));
     std::copy(_pointer.getConstPointer(),_pointer.getConstPointer()+std::min<std::size_t>(_nb_of_elem,newNbOfElements),pointer);
     if(_ownership)
       DestroyPointer(const_cast<T *>(_pointer.getConstPointer()),_dealloc,_param_for_deallocator);//Do not use getPointer because in case of _external
@@ -401,8 +422,8 @@ namespace MEDCoupling
     _nb_of_elem=std::min<std::size_t>(_nb_of_elem,newNbOfElements);
     _nb_of_elem_alloc=newNbOfElements;
     _ownership=true;
-    _dealloc=CDeallocator;
-    _param_for_deallocator=0;
+    _dealloc=dealloc;
+    _param_for_deallocator=param;
   }
 
   /*!
@@ -417,7 +438,9 @@ namespace MEDCoupling
   {
     if(_nb_of_elem==newNbOfElements)
       return ;
-    T *pointer=(T*)malloc(newNbOfElements*sizeof(T));
+    Deallocator dealloc;
+    void *param;
+    T *pointer(AllocateRaw(newNbOfElements,dealloc,param));
     std::copy(_pointer.getConstPointer(),_pointer.getConstPointer()+std::min<std::size_t>(_nb_of_elem,newNbOfElements),pointer);
     if(_ownership)
       DestroyPointer(const_cast<T *>(_pointer.getConstPointer()),_dealloc,_param_for_deallocator);//Do not use getPointer because in case of _external
@@ -425,8 +448,8 @@ namespace MEDCoupling
     _nb_of_elem=newNbOfElements;
     _nb_of_elem_alloc=newNbOfElements;
     _ownership=true;
-    _dealloc=CDeallocator;
-    _param_for_deallocator=0;
+    _dealloc=dealloc;
+    _param_for_deallocator=param;
   }
 
   template<class T>
@@ -465,6 +488,23 @@ namespace MEDCoupling
     }
   }
 
+  /*!
+   * Allocates room for \a nbOfElements elements, in the MEDCouplingMemoryPool of the current thread if any (see MEDCouplingMemoryPoolScope),
+   * using malloc otherwise. \a dealloc and \a param are set to what releases the returned pointer.
+   */
+  template<class T>
+  T *MemArray<T>::AllocateRaw(std::size_t nbOfElements, Deallocator& dealloc, void *& param)
+  {
+    if(MEDCouplingMemoryPool *pool=MEDCouplingMemoryPool::GetCurrent())
+      {
+        param=pool;
+        return reinterpret_cast<T *>(pool->allocate(nbOfElements*sizeof(T),dealloc));
+      }
+    dealloc=CDeallocator;
+    param=0;
+    return (T*)malloc(nbOfElements*sizeof(T));
+  }
+
   template<class T>
   void MemArray<T>::DestroyPointer(T *pt, typename MemArray<T>::Deallocator dealloc, void *param)
   {
@@ -766,6 +806,70 @@ namespace MEDCoupling
     declareAsNew();
   }
 
+  /*!
+   * Sets a C array owned by somebody else (a solver for example) to be used as raw data of \a this, with read and write access.
+   * No copy is done : \a this is a view on \a array. Contrary to DataArrayTemplate<T>::useExternalArrayWithRWAccess, the owner is told
+   * when \a this stops using \a array : \a dealloc(\a array, \a param) is called exactly once, at the destruction of \a this or when
+   * \a this is given other data (alloc, reAlloc, useArray...). \a dealloc typically decrements a reference counter of the owner
+   * rather than freeing \a array.
+   * The previously set info of components is retained and re-sized.
+   *  \param [in] array - the C array to be used as raw data of \a this.
+   *  \param [in] nbOfTuple - new number of tuples in \a this.
+   *  \param [in] nbOfCompo - new number of components in \a this.
+   *  \param [in] dealloc - the function called when \a array is released by \a this. If NULL, nothing is called.
+   *  \param [in] param - the second argument given to \a dealloc.
+   */
+  template<class T>
+  void DataArrayTemplate<T>::useExternalArrayWithDeallocator(T *array, std::size_t nbOfTuple, std::size_t nbOfCompo, typename MemArray<T>::Deallocator dealloc, void *param)
+  {
+    _info_on_compo.resize(nbOfCompo);
+    _mem.useExternalArrayWithDeallocator(array,nbOfTuple*nbOfCompo,dealloc,param);
+    declareAsNew();
+  }
+
+  /*!
+   * Writes the values of \a this, with its number of tuples and of components, in the raw binary file \a fileName (see MEDCouplingRawFile).
+   * The file can then be mapped in memory by DataArrayTemplate<T>::useMappedRawFile. The name and the components info are not written.
+   *  \param [in] fileName - the name of the file to write.
+   *  \param [in] tag - an integer stored with the values, given back by DataArrayTemplate<T>::useMappedRawFile.
+   *  \throw If \a this is not allocated.
+   *  \throw If the file cannot be written.
+   */
+  template<class T>
+  void DataArrayTemplate<T>::writeRawFile(const std::string& fileName, std::int64_t tag) const
+  {
+    checkAllocated();
+    MEDCouplingRawFile::Write(fileName,Traits<T>::ArrayTypeName,begin(),sizeof(T),getNumberOfTuples(),getNumberOfComponents(),tag);
+  }
+
+  /*!
+   * Makes \a this a view on the raw binary file \a fileName written by DataArrayTemplate<T>::writeRawFile, mapped in memory.
+   * Nothing is read at this point : the values are loaded by the system from the file as they are accessed, and can be dropped from
+   * memory under pressure, so that arrays larger than the memory can be processed. The mapping is released when \a this is given
+   * other data or is destroyed.
+   *  \param [in] fileName - the name of the file to map.
+   *  \param [in] copyOnWrite - if false, \a this is read only : any attempt to modify its values throws. If true, the values can be
+   *               modified, the modified pages being copied in memory and the file being left unchanged.
+   *  \return std::int64_t - the tag given to DataArrayTemplate<T>::writeRawFile.
+   *  \throw If the file cannot be read or has not been written by an array of the same type as \a this.
+   *  \throw If memory mapping is not available on this platform.
+   */
+  template<class T>
+  std::int64_t DataArrayTemplate<T>::useMappedRawFile(const std::string& fileName, bool copyOnWrite)
+  {
+    std::size_t nbOfTuple(0),nbOfCompo(0);
+    std::int64_t tag(0);
+    void *param(0);
+    T *pt(reinterpret_cast<T *>(MEDCouplingRawFile::Map(fileName,Traits<T>::ArrayTypeName,sizeof(T),copyOnWrite,nbOfTuple,nbOfCompo,tag,param)));
+    _info_on_compo.resize(nbOfCompo);
+    if(copyOnWrite)
+      _mem.useExternalArrayWithDeallocator(pt,nbOfTuple*nbOfCompo,MEDCouplingRawFile::Unmap,param);
+    else
+      _mem.useReadOnlyArrayWithDeallocator(pt,nbOfTuple*nbOfCompo,MEDCouplingRawFile::Unmap,param);
+    declareAsNew();
+    return tag;
+  }
+
   /*!
    * Returns a value located at specified tuple and component.
    * This method is equivalent to DataArrayTemplate<T>::getIJ() except that validity of
@@ -5766,12 +5870,8 @@ struct NotInRange
       throw INTERP_KERNEL::Exception("DataArrayInt::buildSubstraction : only single component allowed !");
     if(other->getNumberOfComponents()!=1)
       throw INTERP_KERNEL::Exception("DataArrayInt::buildSubstraction : only single component allowed for other type !");
-    const T *pt=this->getConstPointer();
-    std::size_t nbOfElements=this->getNumberOfTuples();
-    std::set<T> s1(pt,pt+nbOfElements);
-    pt=other->getConstPointer();
-    nbOfElements=other->getNumberOfTuples();
-    std::set<T> s2(pt,pt+nbOfElements);
+    std::vector<T> s1(this->begin(),this->end()),s2(other->begin(),other->end());
+    SortUnique(s1); SortUnique(s2);
     std::vector<T> r;
     std::set_difference(s1.begin(),s1.end(),s2.begin(),s2.end(),std::back_insert_iterator< std::vector<T> >(r));
     DataArrayType *ret=DataArrayType::New();
@@ -5866,28 +5966,13 @@ struct NotInRange
     this->checkAllocated();
     if(this->getNumberOfComponents()!=1)
       throw INTERP_KERNEL::Exception("DataArrayInt::indexOfSameConsecutiveValueGroups : only single component allowed !");
-    const T *pt(this->begin());
-    const T *const ptEnd(this->end()) , * const ptBg(this->begin());
-    // first find nb of different values in this
-    std::size_t nbOfTuplesOut(0);
-    while( pt != ptEnd )
-    {
-      T val(*pt);
-      const T *endOfPack(std::find_if(pt+1,ptEnd,[val](T elt){ return val!=elt; }));
-      pt = endOfPack;
-      ++nbOfTuplesOut;
-    }
-    MCAuto<DataArrayIdType> ret(DataArrayIdType::New()); ret->alloc(nbOfTuplesOut+1,1);
-    mcIdType *retPtr(ret->getPointer()); *retPtr++ = 0;
-    pt = this->begin();
-    while( pt != ptEnd )
-    {
-      T val(*pt);
-      const T *endOfPack(std::find_if(pt+1,ptEnd,[val](T elt){ return val!=elt; }));
-      *retPtr++ = ToIdType( std::distance(ptBg,endOfPack) );
-      pt = endOfPack;
-      ++nbOfTuplesOut;
-    }
+    mcIdType nbOfTuples(this->getNumberOfTuples());
+    MCAuto<DataArrayIdType> ret(DataArrayIdType::New());
+    mcIdType *retPtr(nullptr);
+    std::size_t nbOfTuplesOut(ParallelGroupStarts(this->begin(),nbOfTuples,
+                                                  [&ret,&retPtr](std::size_t nbOfGroups) { ret->alloc(nbOfGroups+1,1); retPtr=ret->getPointer(); },
+                                                  [&retPtr](std::size_t groupId, std::size_t pos) { retPtr[groupId]=ToIdType(pos); }));
+    retPtr[nbOfTuplesOut]=nbOfTuples;
     return ret.retn();
   }
 
@@ -5906,14 +5991,12 @@ struct NotInRange
     this->checkAllocated();
     if(this->getNumberOfComponents()!=1)
       throw INTERP_KERNEL::Exception("DataArrayInt::buildUnique : only single component allowed !");
-    std::size_t nbOfElements(this->getNumberOfTuples());
-    MCAuto<DataArrayType> tmp(DataArrayType::New());
-    tmp->deepCopyFrom(*this);
-    T *data(tmp->getPointer());
-    T *last(std::unique(data,data+nbOfElements));
+    const T *data(this->begin());
     MCAuto<DataArrayType> ret(DataArrayType::New());
-    ret->alloc(std::distance(data,last),1);
-    std::copy(data,last,ret->getPointer());
+    T *retPtr(nullptr);
+    ParallelGroupStarts(data,this->getNumberOfTuples(),
+                        [&ret,&retPtr](std::size_t nbOfGroups) { ret->alloc(nbOfGroups,1); retPtr=ret->getPointer(); },
+                        [data,&retPtr](std::size_t groupId, std::size_t pos) { retPtr[groupId]=data[pos]; });
     return ret.retn();
   }
 
@@ -7040,16 +7123,20 @@ struct NotInRange
         std::ostringstream oss; oss << "DataArrayInt::FindPermutationFromFirstToSecond : first array has " << ids1->getNumberOfTuples() << " tuples and the second one " << ids2->getNumberOfTuples() << " tuples ! No chance to find a permutation between the 2 arrays !";
         throw INTERP_KERNEL::Exception(oss.str().c_str());
       }
-    MCAuto<DataArrayType> c1(ids1->deepCopy());
-    MCAuto<DataArrayType> c2(ids2->deepCopy());
-    c1->sort(true); c2->sort(true);
-    if(!c1->isEqualWithoutConsideringStr(*c2))
+    std::size_t nbOfTuples(ids1->getNumberOfTuples());
+    std::vector<T> c1,c2;
+    std::vector<mcIdType> n2o1,n2o2;
+    ArgSort(ids1->begin(),nbOfTuples,c1,n2o1);
+    ArgSort(ids2->begin(),nbOfTuples,c2,n2o2);
+    if(c1!=c2)
       throw INTERP_KERNEL::Exception("DataArrayInt::FindPermutationFromFirstToSecond : the two arrays are not lying on same ids ! Impossible to find a permutation between the 2 arrays !");
-    MCAuto<DataArrayIdType> p1=ids1->checkAndPreparePermutation();
-    MCAuto<DataArrayIdType> p2=ids2->checkAndPreparePermutation();
-    p2=p2->invertArrayO2N2N2O(p2->getNumberOfTuples());
-    p2=p2->selectByTupleIdSafe(p1->begin(),p1->end());
-    return p2.retn();
+    if(std::adjacent_find(c1.begin(),c1.end())!=c1.end())
+      throw INTERP_KERNEL::Exception("Some elements are equals in the specified array !");
+    MCAuto<DataArrayIdType> ret(DataArrayIdType::New()); ret->alloc(nbOfTuples,1);
+    mcIdType *retPtr(ret->getPointer());
+    for(std::size_t i=0;i<nbOfTuples;i++)
+      retPtr[n2o1[i]]=n2o2[i];
+    return ret.retn();
   }
 
   /*!
@@ -7147,23 +7234,14 @@ struct NotInRange
   mcIdType *DataArrayDiscrete<T>::CheckAndPreparePermutation(const T *start, const T *end)
   {
     std::size_t sz=std::distance(start,end);
+    std::vector<T> work;
+    std::vector<mcIdType> n2o;
+    ArgSort(start,sz,work,n2o);
+    if(std::adjacent_find(work.begin(),work.end())!=work.end())
+      throw INTERP_KERNEL::Exception("Some elements are equals in the specified array !");
     mcIdType *ret=(mcIdType *)malloc(sz*sizeof(mcIdType));
-    T *work=new T[sz];
-    std::copy(start,end,work);
-    std::sort(work,work+sz);
-    if(std::unique(work,work+sz)!=work+sz)
-      {
-        delete [] work;
-        free(ret);
-        throw INTERP_KERNEL::Exception("Some elements are equals in the specified array !");
-      }
-    std::map<T,mcIdType> m;
-    for(T *workPt=work;workPt!=work+sz;workPt++)
-      m[*workPt]=ToIdType(std::distance(work,workPt));
-    mcIdType *iter2=ret;
-    for(const T *iter=start;iter!=end;iter++,iter2++)
-      *iter2=m[*iter];
-    delete [] work;
+    for(std::size_t i=0;i<sz;i++)
+      ret[n2o[i]]=ToIdType(i);
     return ret;
   }
 
@@ -7319,13 +7397,10 @@ struct NotInRange
           throw INTERP_KERNEL::Exception("DataArrayInt::BuildUnion : only single component allowed !");
       }
     //
-    std::set<T> r;
+    std::vector<T> r;
     for(typename std::vector<const DataArrayType *>::const_iterator it=a.begin();it!=a.end();it++)
-      {
-        const T *pt=(*it)->getConstPointer();
-        mcIdType nbOfTuples((*it)->getNumberOfTuples());
-        r.insert(pt,pt+nbOfTuples);
-      }
+      r.insert(r.end(),(*it)->begin(),(*it)->end());
+    SortUnique(r);
     DataArrayType *ret=DataArrayType::New();
     ret->alloc(r.size(),1);
     std::copy(r.begin(),r.end(),ret->getPointer());
@@ -7359,20 +7434,19 @@ struct NotInRange
     if(a.size()==1)
       throw INTERP_KERNEL::Exception("DataArrayInt::BuildIntersection : only single not null element in array ! For safety reasons exception is raised !");
     //
-    std::set<T> r;
+    std::vector<T> r;
     for(typename std::vector<const DataArrayType *>::const_iterator it=a.begin();it!=a.end();it++)
       {
-        const T *pt=(*it)->getConstPointer();
-        mcIdType nbOfTuples((*it)->getNumberOfTuples());
-        std::set<T> s1(pt,pt+nbOfTuples);
+        std::vector<T> s1((*it)->begin(),(*it)->end());
+        SortUnique(s1);
         if(it!=a.begin())
           {
-            std::set<T> r2;
-            std::set_intersection(r.begin(),r.end(),s1.begin(),s1.end(),inserter(r2,r2.end()));
-            r=r2;
+            std::vector<T> r2;
+            std::set_intersection(r.begin(),r.end(),s1.begin(),s1.end(),std::back_insert_iterator< std::vector<T> >(r2));
+            r.swap(r2);
           }
         else
-          r=s1;
+          r.swap(s1);
       }
     DataArrayType *ret(DataArrayType::New());
     ret->alloc(r.size(),1);
@@ -0,0 +1,354 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "MEDCouplingMemoryPool.hxx"
+#include "InterpKernelException.hxx"
+
+#include <limits>
+#include <algorithm>
+#include <sstream>
+#include <cstdlib>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+using namespace MEDCoupling;
+
+namespace
+{
+  //! size of the smallest blocks of the pool. The size class i holds blocks of MIN_BLOCK_SIZE << i bytes.
+  const std::size_t MIN_BLOCK_SIZE=64;
+  const std::size_t NOT_POOLED=std::numeric_limits<std::size_t>::max();
+  const std::size_t DFT_MAX_POOLED_SIZE=1024*1024;
+  //! biggest value accepted by setMaxPooledSize : its size class is the last one whose block size does not overflow
+  const std::size_t MAX_POOLED_SIZE_LIMIT=std::size_t(1)<<(std::numeric_limits<std::size_t>::digits-2);
+  const std::size_t DFT_HUGE_PAGE_THRESHOLD=4*MEDCouplingMemoryPool::HUGE_PAGE_SIZE;
+
+  //! placed just before the memory given to the arrays, for the blocks that are not aligned on huge pages
+  struct alignas(std::max_align_t) BlockHeader
+  {
+    std::size_t _size_class;
+    std::size_t _nb_of_bytes;
+  };
+
+  //! pool in which the arrays of the current thread are allocated, see MEDCouplingMemoryPoolScope
+  thread_local MEDCouplingMemoryPool *CURRENT_POOL(nullptr);
+
+  void *AllocateAlignedOnHugePage(std::size_t nbOfBytes)
+  {
+    void *ret(nullptr);
+#ifdef WIN32
+    ret=_aligned_malloc(nbOfBytes,MEDCouplingMemoryPool::HUGE_PAGE_SIZE);
+#else
+    if(posix_memalign(&ret,MEDCouplingMemoryPool::HUGE_PAGE_SIZE,nbOfBytes)!=0)
+      ret=nullptr;
+#endif
+#ifdef __linux__
+    if(ret)
+      madvise(ret,nbOfBytes,MADV_HUGEPAGE);
+#endif
+    return ret;
+  }
+
+  void FreeAlignedOnHugePage(void *pt)
+  {
+#ifdef WIN32
+    _aligned_free(pt);
+#else
+    free(pt);
+#endif
+  }
+}
+
+MEDCouplingMemoryPool *MEDCouplingMemoryPool::New()
+{
+  return new MEDCouplingMemoryPool;
+}
+
+/*!
+ * Returns the pool in which the arrays allocated by the current thread are placed, or NULL if they are allocated using malloc.
+ * No reference is given to the caller.
+ * \sa MEDCouplingMemoryPoolScope
+ */
+MEDCouplingMemoryPool *MEDCouplingMemoryPool::GetCurrent()
+{
+  return CURRENT_POOL;
+}
+
+MEDCouplingMemoryPool::MEDCouplingMemoryPool():_max_pooled_size(DFT_MAX_POOLED_SIZE),_huge_page_threshold(DFT_HUGE_PAGE_THRESHOLD),
+                                               _free_blocks(SizeClassOf(DFT_MAX_POOLED_SIZE)+1),_nb_of_allocations(0),_nb_of_reused_blocks(0),
+                                               _nb_of_system_allocations(0),_nb_of_huge_page_allocations(0),_nb_of_bytes_in_use(0),
+                                               _peak_of_bytes_in_use(0),_nb_of_cached_bytes(0)
+{
+}
+
+MEDCouplingMemoryPool::~MEDCouplingMemoryPool()
+{
+  releaseCachedBlocksLocked();
+}
+
+std::size_t MEDCouplingMemoryPool::getHeapMemorySizeWithoutChildren() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  std::size_t ret(sizeof(MEDCouplingMemoryPool)+_nb_of_cached_bytes+_free_blocks.capacity()*sizeof(std::vector<void *>));
+  for(std::vector< std::vector<void *> >::const_iterator it=_free_blocks.begin();it!=_free_blocks.end();it++)
+    ret+=(*it).capacity()*sizeof(void *);
+  return ret;
+}
+
+std::vector<const BigMemoryObject *> MEDCouplingMemoryPool::getDirectChildrenWithNull() const
+{
+  return std::vector<const BigMemoryObject *>();
+}
+
+/*!
+ * Allocates a block of at least \a nbOfBytes bytes. The block is released by calling \a dealloc(returned pointer, this).
+ * \throw If the system is out of memory.
+ */
+void *MEDCouplingMemoryPool::allocate(std::size_t nbOfBytes, Deallocator& dealloc)
+{
+  if(nbOfBytes>std::numeric_limits<std::size_t>::max()-(HUGE_PAGE_SIZE+sizeof(BlockHeader)))
+    {
+      std::ostringstream oss; oss << "MEDCouplingMemoryPool::allocate : unable to allocate " << nbOfBytes << " bytes !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  void *ret(nullptr);
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if(nbOfBytes>=_huge_page_threshold)
+      {
+        std::size_t sz(((nbOfBytes+HUGE_PAGE_SIZE-1)/HUGE_PAGE_SIZE)*HUGE_PAGE_SIZE);
+        ret=AllocateAlignedOnHugePage(sz);
+        if(!ret)
+          {
+            std::ostringstream oss; oss << "MEDCouplingMemoryPool::allocate : unable to allocate " << sz << " bytes aligned on huge pages !";
+            throw INTERP_KERNEL::Exception(oss.str());
+          }
+        _huge_blocks[ret]=sz;
+        _nb_of_system_allocations++;
+        _nb_of_huge_page_allocations++;
+        _nb_of_bytes_in_use+=sz;
+        dealloc=DeallocateHugeBlock;
+      }
+    else
+      {
+        std::size_t sizeClass(nbOfBytes<=_max_pooled_size?SizeClassOf(nbOfBytes):NOT_POOLED);
+        BlockHeader *block(nullptr);
+        if(sizeClass!=NOT_POOLED && !_free_blocks[sizeClass].empty())
+          {
+            block=reinterpret_cast<BlockHeader *>(_free_blocks[sizeClass].back());
+            _free_blocks[sizeClass].pop_back();
+            _nb_of_reused_blocks++;
+            _nb_of_cached_bytes-=block->_nb_of_bytes;
+          }
+        else
+          {
+            std::size_t sz(sizeClass!=NOT_POOLED?(MIN_BLOCK_SIZE<<sizeClass):nbOfBytes);
+            block=reinterpret_cast<BlockHeader *>(malloc(sizeof(BlockHeader)+sz));
+            if(!block)
+              {
+                std::ostringstream oss; oss << "MEDCouplingMemoryPool::allocate : unable to allocate " << sz << " bytes !";
+                throw INTERP_KERNEL::Exception(oss.str());
+              }
+            block->_size_class=sizeClass;
+            block->_nb_of_bytes=sz;
+            _nb_of_system_allocations++;
+          }
+        _nb_of_bytes_in_use+=block->_nb_of_bytes;
+        ret=block+1;
+        dealloc=DeallocateBlock;
+      }
+    _nb_of_allocations++;
+    _peak_of_bytes_in_use=std::max(_peak_of_bytes_in_use,_nb_of_bytes_in_use);
+  }
+  incrRef();
+  return ret;
+}
+
+/*!
+ * Sets the size of the biggest blocks kept for reuse. The bigger blocks are given back to the system as soon as they are released.
+ * The blocks currently kept for reuse are freed.
+ * \throw If \a nbOfBytes is greater than a quarter of the address space, the rounding of such sizes to a power of two overflowing.
+ */
+void MEDCouplingMemoryPool::setMaxPooledSize(std::size_t nbOfBytes)
+{
+  if(nbOfBytes>MAX_POOLED_SIZE_LIMIT)
+    {
+      std::ostringstream oss; oss << "MEDCouplingMemoryPool::setMaxPooledSize : " << nbOfBytes << " is greater than the limit " << MAX_POOLED_SIZE_LIMIT << " !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  std::lock_guard<std::mutex> lock(_mutex);
+  releaseCachedBlocksLocked();
+  _max_pooled_size=nbOfBytes;
+  _free_blocks.resize(SizeClassOf(nbOfBytes)+1);
+}
+
+/*!
+ * Sets the size from which the blocks are aligned on huge pages (MEDCouplingMemoryPool::HUGE_PAGE_SIZE). Such blocks are never kept for reuse.
+ */
+void MEDCouplingMemoryPool::setHugePageThreshold(std::size_t nbOfBytes)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _huge_page_threshold=nbOfBytes;
+}
+
+/*!
+ * Gives back to the system the blocks kept for reuse. The blocks in use are not concerned.
+ */
+void MEDCouplingMemoryPool::releaseCachedBlocks()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  releaseCachedBlocksLocked();
+}
+
+//! Number of blocks given to the arrays since the creation of \a this or the last call to resetCounters.
+std::size_t MEDCouplingMemoryPool::getNumberOfAllocations() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _nb_of_allocations;
+}
+
+//! Number of blocks given to the arrays that were taken from the blocks kept for reuse, without asking the system.
+std::size_t MEDCouplingMemoryPool::getNumberOfReusedBlocks() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _nb_of_reused_blocks;
+}
+
+//! Number of blocks asked to the system.
+std::size_t MEDCouplingMemoryPool::getNumberOfSystemAllocations() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _nb_of_system_allocations;
+}
+
+//! Number of blocks asked to the system aligned on huge pages.
+std::size_t MEDCouplingMemoryPool::getNumberOfHugePageAllocations() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _nb_of_huge_page_allocations;
+}
+
+//! Number of bytes of the blocks currently used by arrays (sizes rounded up to the size of the blocks).
+std::size_t MEDCouplingMemoryPool::getNumberOfBytesInUse() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _nb_of_bytes_in_use;
+}
+
+//! Highest value reached by getNumberOfBytesInUse since the creation of \a this or the last call to resetCounters.
+std::size_t MEDCouplingMemoryPool::getPeakOfBytesInUse() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _peak_of_bytes_in_use;
+}
+
+//! Number of bytes of the blocks kept for reuse.
+std::size_t MEDCouplingMemoryPool::getNumberOfCachedBytes() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _nb_of_cached_bytes;
+}
+
+/*!
+ * Resets the counters of allocations. The peak of bytes in use restarts from the number of bytes currently in use.
+ */
+void MEDCouplingMemoryPool::resetCounters()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _nb_of_allocations=0;
+  _nb_of_reused_blocks=0;
+  _nb_of_system_allocations=0;
+  _nb_of_huge_page_allocations=0;
+  _peak_of_bytes_in_use=_nb_of_bytes_in_use;
+}
+
+void MEDCouplingMemoryPool::releaseCachedBlocksLocked()
+{
+  for(std::vector< std::vector<void *> >::iterator it=_free_blocks.begin();it!=_free_blocks.end();it++)
+    {
+      for(std::vector<void *>::const_iterator it2=(*it).begin();it2!=(*it).end();it2++)
+        free(*it2);
+      (*it).clear();
+    }
+  _nb_of_cached_bytes=0;
+}
+
+//! Returns the id of the smallest size class whose blocks can hold \a nbOfBytes bytes.
+std::size_t MEDCouplingMemoryPool::SizeClassOf(std::size_t nbOfBytes)
+{
+  std::size_t ret(0);
+  while((MIN_BLOCK_SIZE<<ret)<nbOfBytes)
+    ret++;
+  return ret;
+}
+
+void MEDCouplingMemoryPool::DeallocateBlock(void *pt, void *param)
+{
+  if(!pt)
+    return ;
+  MEDCouplingMemoryPool *pool(reinterpret_cast<MEDCouplingMemoryPool *>(param));
+  BlockHeader *block(reinterpret_cast<BlockHeader *>(pt)-1);
+  {
+    std::lock_guard<std::mutex> lock(pool->_mutex);
+    pool->_nb_of_bytes_in_use-=block->_nb_of_bytes;
+    if(block->_size_class<pool->_free_blocks.size())
+      {
+        pool->_free_blocks[block->_size_class].push_back(block);
+        pool->_nb_of_cached_bytes+=block->_nb_of_bytes;
+      }
+    else
+      free(block);
+  }
+  pool->decrRef();
+}
+
+void MEDCouplingMemoryPool::DeallocateHugeBlock(void *pt, void *param)
+{
+  if(!pt)
+    return ;
+  MEDCouplingMemoryPool *pool(reinterpret_cast<MEDCouplingMemoryPool *>(param));
+  {
+    std::lock_guard<std::mutex> lock(pool->_mutex);
+    std::map<void *,std::size_t>::iterator it(pool->_huge_blocks.find(pt));
+    if(it!=pool->_huge_blocks.end())
+      {
+        pool->_nb_of_bytes_in_use-=(*it).second;
+        pool->_huge_blocks.erase(it);
+      }
+    FreeAlignedOnHugePage(pt);
+  }
+  pool->decrRef();
+}
+
+/*!
+ * Makes \a pool the pool in which the arrays of the current thread are allocated, until the destruction of \a this. If \a pool is NULL,
+ * the arrays are allocated using malloc until the destruction of \a this.
+ */
+MEDCouplingMemoryPoolScope::MEDCouplingMemoryPoolScope(MEDCouplingMemoryPool *pool):_previous(CURRENT_POOL)
+{
+  _pool.takeRef(pool);
+  CURRENT_POOL=pool;
+}
+
+MEDCouplingMemoryPoolScope::~MEDCouplingMemoryPoolScope()
+{
+  CURRENT_POOL=_previous;
+}
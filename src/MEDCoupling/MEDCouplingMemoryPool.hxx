@@ -0,0 +1,110 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#pragma once
+
+#include "MEDCoupling.hxx"
+#include "MCAuto.hxx"
+#include "MEDCouplingRefCountObject.hxx"
+
+#include <map>
+#include <mutex>
+#include <vector>
+#include <cstddef>
+
+namespace MEDCoupling
+{
+  /*!
+   * Pool of memory blocks in which the arrays (MemArray) allocated by a thread are placed as long as a MEDCouplingMemoryPoolScope
+   * on the pool is alive in this thread.
+   *
+   * Blocks up to getMaxPooledSize() bytes are rounded up to a power of two. Once released by their array, they are kept in the pool
+   * and given back to the next allocations of the same size instead of going back to the system, which removes the allocator churn
+   * and the page faults of the short lived arrays of chains like buildPartOfMySelf, zipCoordsTraducer, invertArrayO2N2N2O...
+   * Blocks of at least getHugePageThreshold() bytes are aligned on huge pages and, on Linux, advised to be backed by transparent huge pages.
+   *
+   * Each block holds a reference on the pool, so that an array outliving the scope that allocated it stays valid. The blocks kept for
+   * reuse are freed with the pool, when its last reference is released. Blocks can be released by any thread.
+   */
+  class MEDCouplingMemoryPool : public RefCountObject
+  {
+  public:
+    typedef void (*Deallocator)(void *,void *);
+    //! size of the huge pages on which big blocks are aligned
+    static const std::size_t HUGE_PAGE_SIZE=2*1024*1024;
+  public:
+    MEDCOUPLING_EXPORT static MEDCouplingMemoryPool *New();
+    MEDCOUPLING_EXPORT static MEDCouplingMemoryPool *GetCurrent();
+    MEDCOUPLING_EXPORT std::string getClassName() const override { return std::string("MEDCouplingMemoryPool"); }
+    MEDCOUPLING_EXPORT std::size_t getHeapMemorySizeWithoutChildren() const;
+    MEDCOUPLING_EXPORT std::vector<const BigMemoryObject *> getDirectChildrenWithNull() const;
+    MEDCOUPLING_EXPORT void *allocate(std::size_t nbOfBytes, Deallocator& dealloc);
+    MEDCOUPLING_EXPORT std::size_t getMaxPooledSize() const { return _max_pooled_size; }
+    MEDCOUPLING_EXPORT void setMaxPooledSize(std::size_t nbOfBytes);
+    MEDCOUPLING_EXPORT std::size_t getHugePageThreshold() const { return _huge_page_threshold; }
+    MEDCOUPLING_EXPORT void setHugePageThreshold(std::size_t nbOfBytes);
+    MEDCOUPLING_EXPORT void releaseCachedBlocks();
+    MEDCOUPLING_EXPORT std::size_t getNumberOfAllocations() const;
+    MEDCOUPLING_EXPORT std::size_t getNumberOfReusedBlocks() const;
+    MEDCOUPLING_EXPORT std::size_t getNumberOfSystemAllocations() const;
+    MEDCOUPLING_EXPORT std::size_t getNumberOfHugePageAllocations() const;
+    MEDCOUPLING_EXPORT std::size_t getNumberOfBytesInUse() const;
+    MEDCOUPLING_EXPORT std::size_t getPeakOfBytesInUse() const;
+    MEDCOUPLING_EXPORT std::size_t getNumberOfCachedBytes() const;
+    MEDCOUPLING_EXPORT void resetCounters();
+  private:
+    MEDCouplingMemoryPool();
+    ~MEDCouplingMemoryPool();
+    void releaseCachedBlocksLocked();
+    static std::size_t SizeClassOf(std::size_t nbOfBytes);
+    static void DeallocateBlock(void *pt, void *param);
+    static void DeallocateHugeBlock(void *pt, void *param);
+  private:
+    mutable std::mutex _mutex;
+    std::size_t _max_pooled_size;
+    std::size_t _huge_page_threshold;
+    //! for each size class (64 << i bytes), the blocks released by their arrays and ready to be reused
+    std::vector< std::vector<void *> > _free_blocks;
+    //! size of the huge page aligned blocks in use
+    std::map<void *,std::size_t> _huge_blocks;
+    std::size_t _nb_of_allocations;
+    std::size_t _nb_of_reused_blocks;
+    std::size_t _nb_of_system_allocations;
+    std::size_t _nb_of_huge_page_allocations;
+    std::size_t _nb_of_bytes_in_use;
+    std::size_t _peak_of_bytes_in_use;
+    std::size_t _nb_of_cached_bytes;
+  };
+
+  /*!
+   * Makes the arrays allocated by the current thread be placed in a MEDCouplingMemoryPool during the lifetime of the instance.
+   * The previous pool of the thread (if any) is restored at the destruction, so that scopes can be nested.
+   */
+  class MEDCouplingMemoryPoolScope
+  {
+  public:
+    MEDCOUPLING_EXPORT MEDCouplingMemoryPoolScope(MEDCouplingMemoryPool *pool);
+    MEDCOUPLING_EXPORT ~MEDCouplingMemoryPoolScope();
+    MEDCouplingMemoryPoolScope(const MEDCouplingMemoryPoolScope& other) = delete;
+    MEDCouplingMemoryPoolScope& operator=(const MEDCouplingMemoryPoolScope& other) = delete;
+  private:
+    MCAuto<MEDCouplingMemoryPool> _pool;
+    MEDCouplingMemoryPool *_previous;
+  };
+}
@@ -0,0 +1,241 @@
+// Copyright (C) 2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef __MEDCOUPLING_MEDCOUPLINGPARALLELALGORITHMS_TXX__
+#define __MEDCOUPLING_MEDCOUPLINGPARALLELALGORITHMS_TXX__
+
+#include "MCType.hxx"
+#include "MEDCouplingRefCountObject.hxx"
+#include "InterpKernelThreads.hxx"
+
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <type_traits>
+#include <cstddef>
+
+/*!
+ * Building blocks used by the DataArrayDiscrete sort, unique and set operations on big arrays. They use
+ * MEDCouplingGetNumberOfThreads() threads and their output does not depend on the number of threads.
+ */
+namespace MEDCoupling
+{
+  //! Arrays with fewer elements than that are processed by a single thread
+  const std::size_t PARALLEL_ALGORITHMS_THRESHOLD=32768;
+
+  //! Returns the number of threads to use to process an array of \a nbOfElems elements
+  inline unsigned int NumberOfThreadsFor(std::size_t nbOfElems)
+  {
+    if(nbOfElems<PARALLEL_ALGORITHMS_THRESHOLD)
+      return 1u;
+    return INTERP_KERNEL::EffectiveNumberOfThreads(MEDCouplingGetNumberOfThreads());
+  }
+
+  /*!
+   * Splits [0, \a nbOfElems) into \a nbThreads contiguous ranges and calls \a func(rangeId,start,stop) for each of them using
+   * \a nbThreads threads. The range \a rangeId is always the same whatever the thread processing it.
+   */
+  template<class Func>
+  void ParallelForEachRange(unsigned int nbThreads, std::size_t nbOfElems, Func func)
+  {
+    std::size_t nbOfRanges(nbThreads);
+    INTERP_KERNEL::ParallelForEachChunk(nbThreads,nbOfRanges,[&](unsigned int, std::size_t rangeId)
+      {
+        std::size_t start,stop;
+        INTERP_KERNEL::ChunkBounds(nbOfElems,nbOfRanges,rangeId,start,stop);
+        func(rangeId,start,stop);
+      });
+  }
+
+  /*!
+   * Stable LSD radix sort (8 bits per pass) of the \a nbOfElems integers in \a keys. If \a ids is not null, the ids are moved
+   * along with their key. Keys are shifted by the minimal value first, so that only the bytes needed to encode the range
+   * of values are processed : ids lower than 2^24 are sorted in 3 passes whatever the size of \a T.
+   * Each pass counts the digits per range of elements and then scatters the elements of each range in parallel.
+   */
+  template<class T>
+  void RadixSort(T *keys, mcIdType *ids, std::size_t nbOfElems)
+  {
+    typedef typename std::make_unsigned<T>::type U;
+    const std::size_t NB_OF_BUCKETS=256;
+    if(nbOfElems<2)
+      return ;
+    unsigned int nbThreads(NumberOfThreadsFor(nbOfElems));
+    std::size_t nbOfRanges(nbThreads);
+    std::vector<T> mins(nbOfRanges),maxs(nbOfRanges);
+    ParallelForEachRange(nbThreads,nbOfElems,[&](std::size_t rangeId, std::size_t start, std::size_t stop)
+      {
+        std::pair<const T *,const T *> minMax(std::minmax_element(keys+start,keys+stop));
+        mins[rangeId]=*minMax.first; maxs[rangeId]=*minMax.second;
+      });
+    U minVal((U)*std::min_element(mins.begin(),mins.end())),range((U)((U)*std::max_element(maxs.begin(),maxs.end())-minVal));
+    int nbOfPasses(0);
+    for(;range!=0;range=(U)(range>>8))
+      nbOfPasses++;
+    if(nbOfPasses==0)
+      return ;//all the keys are equal
+    U *src(reinterpret_cast<U *>(keys));
+    std::vector<U> keysBuf(nbOfElems);
+    U *dst(keysBuf.data());
+    std::vector<mcIdType> idsBuf(ids?nbOfElems:0);
+    mcIdType *srcIds(ids),*dstIds(idsBuf.data());
+    ParallelForEachRange(nbThreads,nbOfElems,[&](std::size_t, std::size_t start, std::size_t stop)
+      {
+        for(std::size_t i=start;i<stop;i++)
+          src[i]=(U)(src[i]-minVal);
+      });
+    std::vector<std::size_t> offsets(nbOfRanges*NB_OF_BUCKETS);
+    for(int pass=0;pass<nbOfPasses;pass++)
+      {
+        int shift(8*pass);
+        std::fill(offsets.begin(),offsets.end(),0);
+        ParallelForEachRange(nbThreads,nbOfElems,[&](std::size_t rangeId, std::size_t start, std::size_t stop)
+          {
+            std::size_t *counts(offsets.data()+rangeId*NB_OF_BUCKETS);
+            for(std::size_t i=start;i<stop;i++)
+              counts[(src[i]>>shift)&0xFF]++;
+          });
+        // digits first, then ranges : elements of a range are written after the ones of the previous ranges with the same digit
+        std::size_t sum(0);
+        for(std::size_t digit=0;digit<NB_OF_BUCKETS;digit++)
+          for(std::size_t rangeId=0;rangeId<nbOfRanges;rangeId++)
+            {
+              std::size_t& offset(offsets[rangeId*NB_OF_BUCKETS+digit]);
+              std::size_t count(offset);
+              offset=sum;
+              sum+=count;
+            }
+        ParallelForEachRange(nbThreads,nbOfElems,[&](std::size_t rangeId, std::size_t start, std::size_t stop)
+          {
+            std::size_t *pos(offsets.data()+rangeId*NB_OF_BUCKETS);
+            for(std::size_t i=start;i<stop;i++)
+              {
+                std::size_t newPos(pos[(src[i]>>shift)&0xFF]++);
+                dst[newPos]=src[i];
+                if(ids)
+                  dstIds[newPos]=srcIds[i];
+              }
+          });
+        std::swap(src,dst);
+        std::swap(srcIds,dstIds);
+      }
+    U *out(reinterpret_cast<U *>(keys));
+    ParallelForEachRange(nbThreads,nbOfElems,[&](std::size_t, std::size_t start, std::size_t stop)
+      {
+        for(std::size_t i=start;i<stop;i++)
+          out[i]=(U)(src[i]+minVal);
+        if(ids && srcIds!=ids)
+          std::copy(srcIds+start,srcIds+stop,ids+start);
+      });
+  }
+
+  template<class T>
+  void ParallelSort(T *bg, T *end, bool asc, std::true_type)
+  {
+    std::size_t nbOfElems(std::distance(bg,end));
+    if(nbOfElems<PARALLEL_ALGORITHMS_THRESHOLD)
+      std::sort(bg,end);
+    else
+      RadixSort<T>(bg,nullptr,nbOfElems);
+    if(!asc)
+      std::reverse(bg,end);
+  }
+
+  template<class T>
+  void ParallelSort(T *bg, T *end, bool asc, std::false_type)
+  {
+    if(asc)
+      std::sort(bg,end);
+    else
+      std::sort(std::reverse_iterator<T *>(end),std::reverse_iterator<T *>(bg));
+  }
+
+  /*!
+   * Sorts [\a bg, \a end) in ascending order if \a asc is true, descending order if not. Integers are radix sorted, the other
+   * types are sorted with std::sort.
+   */
+  template<class T>
+  void ParallelSort(T *bg, T *end, bool asc)
+  {
+    ParallelSort(bg,end,asc,typename std::is_integral<T>::type());
+  }
+
+  /*!
+   * Computes the permutation sorting \a vals in ascending order : at output \a sortedVals contains the sorted values and
+   * \a n2o[i] is the position in \a vals of \a sortedVals[i]. Equal values keep their relative order.
+   */
+  template<class T>
+  void ArgSort(const T *vals, std::size_t nbOfElems, std::vector<T>& sortedVals, std::vector<mcIdType>& n2o)
+  {
+    unsigned int nbThreads(NumberOfThreadsFor(nbOfElems));
+    sortedVals.resize(nbOfElems);
+    n2o.resize(nbOfElems);
+    ParallelForEachRange(nbThreads,nbOfElems,[&](std::size_t, std::size_t start, std::size_t stop)
+      {
+        std::copy(vals+start,vals+stop,sortedVals.begin()+start);
+        for(std::size_t i=start;i<stop;i++)
+          n2o[i]=ToIdType(i);
+      });
+    RadixSort<T>(sortedVals.data(),n2o.data(),nbOfElems);
+  }
+
+  /*!
+   * Finds the starts of the groups of consecutive equal values in \a vals, i.e. the positions \a pos such that \a pos==0 or
+   * \a vals[pos-1]!=\a vals[pos]. \a alloc(nbOfGroups) is called once, then \a write(groupId,pos) is called for each group,
+   * possibly concurrently for different groups.
+   * \return the number of groups.
+   */
+  template<class T, class Alloc, class Write>
+  std::size_t ParallelGroupStarts(const T *vals, std::size_t nbOfElems, Alloc alloc, Write write)
+  {
+    unsigned int nbThreads(NumberOfThreadsFor(nbOfElems));
+    std::vector<std::size_t> nbOfGroups(nbThreads+1,0);
+    ParallelForEachRange(nbThreads,nbOfElems,[&](std::size_t rangeId, std::size_t start, std::size_t stop)
+      {
+        std::size_t nb(0);
+        for(std::size_t i=start;i<stop;i++)
+          if(i==0 || vals[i]!=vals[i-1])
+            nb++;
+        nbOfGroups[rangeId+1]=nb;
+      });
+    for(std::size_t rangeId=0;rangeId<nbThreads;rangeId++)
+      nbOfGroups[rangeId+1]+=nbOfGroups[rangeId];
+    alloc(nbOfGroups.back());
+    ParallelForEachRange(nbThreads,nbOfElems,[&](std::size_t rangeId, std::size_t start, std::size_t stop)
+      {
+        std::size_t groupId(nbOfGroups[rangeId]);
+        for(std::size_t i=start;i<stop;i++)
+          if(i==0 || vals[i]!=vals[i-1])
+            write(groupId++,i);
+      });
+    return nbOfGroups.back();
+  }
+
+  /*!
+   * Sorts in ascending order and removes the duplicates of \a vals.
+   */
+  template<class T>
+  void SortUnique(std::vector<T>& vals)
+  {
+    ParallelSort(vals.data(),vals.data()+vals.size(),true);
+    vals.erase(std::unique(vals.begin(),vals.end()),vals.end());
+  }
+}
+
+#endif
@@ -30,6 +30,7 @@
 #include "InterpKernelAutoPtr.hxx"
 
 #include <cmath>
+#include <algorithm>
 #include <limits>
 #include <numeric>
 #include <sstream>
@@ -473,6 +474,83 @@ void MEDCouplingPointSet::getBoundingBox(double *bbox) const
   _coords->getMinMaxPerComponent(bbox);
 }
 
+/*!
+ * Computes a finer description of the region covered by \a this than getBoundingBox, made of the bounding boxes of clusters of cells.
+ * The cells are split recursively \a nbOfLevels times in two at the middle of the largest extent of the centers of their bounding boxes,
+ * and the bounding box of each resulting cluster of cells is returned. A thin, curved or L-shaped region is thus covered by up to
+ * 2^ \a nbOfLevels boxes much tighter than its global bounding box. Any cell of \a this is included in at least one of the returned boxes.
+ *  \param [in] nbOfLevels - the number of bisections. 0 returns the box bounding all the cells.
+ *  \param [in] arcDetEps - the precision used to compute the bounding boxes of the quadratic cells, as in getBoundingBoxForBBTree.
+ *  \return DataArrayDouble * - a new instance with one tuple per non empty cluster (so less than 2^ \a nbOfLevels tuples when \a this has
+ *         few cells, and no tuple if it has no cell), each having 2*spaceDim components xMin, xMax, yMin, yMax, zMin, zMax (if in 3D).
+ *         The caller is to delete this array using decrRef() as it is no more needed.
+ *  \throw If the coordinates array is not set.
+ *  \throw If the nodal connectivity of cells is not defined.
+ *  \throw If \a nbOfLevels is negative.
+ *  \sa getBoundingBox, getBoundingBoxForBBTree
+ */
+DataArrayDouble *MEDCouplingPointSet::getBoundingBoxesOfCellClusters(int nbOfLevels, double arcDetEps) const
+{
+  if(nbOfLevels<0)
+    throw INTERP_KERNEL::Exception("MEDCouplingPointSet::getBoundingBoxesOfCellClusters : the number of levels must be >= 0 !");
+  MCAuto<DataArrayDouble> bbox(getBoundingBoxForBBTree(arcDetEps));
+  std::size_t spaceDim(bbox->getNumberOfComponents()/2);
+  mcIdType nbOfCells(bbox->getNumberOfTuples());
+  const double *bboxPtr(bbox->begin());
+  std::vector<mcIdType> cells(nbOfCells);
+  std::iota(cells.begin(),cells.end(),0);
+  // each cluster is a range [first,second) in cells
+  std::vector< std::pair<mcIdType,mcIdType> > clusters;
+  if(nbOfCells>0)
+    clusters.push_back(std::pair<mcIdType,mcIdType>(0,nbOfCells));
+  for(int level=0;level<nbOfLevels;level++)
+    {
+      std::vector< std::pair<mcIdType,mcIdType> > newClusters;
+      for(std::vector< std::pair<mcIdType,mcIdType> >::const_iterator it=clusters.begin();it!=clusters.end();it++)
+        {
+          if((*it).second-(*it).first<2)
+            { newClusters.push_back(*it); continue; }
+          // axis of largest extent of the centers of the cells of the cluster (centers are kept doubled)
+          std::vector<double> minMax(2*spaceDim);
+          for(std::size_t j=0;j<spaceDim;j++)
+            { minMax[2*j]=std::numeric_limits<double>::max(); minMax[2*j+1]=-std::numeric_limits<double>::max(); }
+          for(mcIdType i=(*it).first;i<(*it).second;i++)
+            for(std::size_t j=0;j<spaceDim;j++)
+              {
+                double c(bboxPtr[2*spaceDim*cells[i]+2*j]+bboxPtr[2*spaceDim*cells[i]+2*j+1]);
+                minMax[2*j]=std::min(minMax[2*j],c); minMax[2*j+1]=std::max(minMax[2*j+1],c);
+              }
+          std::size_t axis(0);
+          for(std::size_t j=1;j<spaceDim;j++)
+            if(minMax[2*j+1]-minMax[2*j]>minMax[2*axis+1]-minMax[2*axis])
+              axis=j;
+          if(minMax[2*axis+1]<=minMax[2*axis])
+            { newClusters.push_back(*it); continue; }// all the centers are the same
+          // split at the middle of the extent, rather than at the median, to follow the shape of the region
+          double cut(minMax[2*axis]+minMax[2*axis+1]);
+          mcIdType mid(ToIdType(std::partition(cells.begin()+(*it).first,cells.begin()+(*it).second,[bboxPtr,spaceDim,axis,cut](mcIdType a)
+                                                 { return 2.*(bboxPtr[2*spaceDim*a+2*axis]+bboxPtr[2*spaceDim*a+2*axis+1])<cut; })-cells.begin()));
+          newClusters.push_back(std::pair<mcIdType,mcIdType>((*it).first,mid));
+          newClusters.push_back(std::pair<mcIdType,mcIdType>(mid,(*it).second));
+        }
+      clusters.swap(newClusters);
+    }
+  MCAuto<DataArrayDouble> ret(DataArrayDouble::New());
+  ret->alloc(clusters.size(),2*spaceDim);
+  double *retPtr(ret->getPointer());
+  for(std::vector< std::pair<mcIdType,mcIdType> >::const_iterator it=clusters.begin();it!=clusters.end();it++,retPtr+=2*spaceDim)
+    {
+      std::copy(bboxPtr+2*spaceDim*cells[(*it).first],bboxPtr+2*spaceDim*(cells[(*it).first]+1),retPtr);
+      for(mcIdType i=(*it).first+1;i<(*it).second;i++)
+        for(std::size_t j=0;j<spaceDim;j++)
+          {
+            retPtr[2*j]=std::min(retPtr[2*j],bboxPtr[2*spaceDim*cells[i]+2*j]);
+            retPtr[2*j+1]=std::max(retPtr[2*j+1],bboxPtr[2*spaceDim*cells[i]+2*j+1]);
+          }
+    }
+  return ret.retn();
+}
+
 /*!
  * Removes "free" nodes, i.e. nodes not used to define any element.
  *  \throw If the coordinates array is not set.
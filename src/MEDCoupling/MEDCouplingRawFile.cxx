@@ -0,0 +1,177 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "MEDCouplingRawFile.hxx"
+#include "InterpKernelException.hxx"
+
+#include <sstream>
+#include <fstream>
+#include <cstring>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace MEDCoupling;
+
+namespace
+{
+  const char RAW_FILE_MAGIC[8]={'M','C','R','A','W','A','R','\0'};
+  const std::size_t TYPE_NAME_SIZE=24;
+
+  struct RawFileHeader
+  {
+    char _magic[8];
+    char _type_name[TYPE_NAME_SIZE];
+    std::uint64_t _nb_of_tuples;
+    std::uint64_t _nb_of_compo;
+    std::int64_t _tag;
+    std::int64_t _reserved;
+  };
+
+  static_assert(sizeof(RawFileHeader)==MEDCouplingRawFile::HEADER_SIZE,"unexpected size of the header of raw files");
+
+  /*!
+   * Tells if \a nbOfBytes bytes hold exactly \a nbOfTuples * \a nbOfCompo values of \a sizeOfValue bytes. The comparison is done
+   * by divisions, the product of the values of a corrupted header overflowing.
+   */
+  bool IsSizeOfValues(std::uint64_t nbOfBytes, std::uint64_t nbOfTuples, std::uint64_t nbOfCompo, std::size_t sizeOfValue)
+  {
+    if(nbOfTuples==0 || nbOfCompo==0)
+      return nbOfBytes==0;
+    if(nbOfBytes%sizeOfValue!=0)
+      return false;
+    std::uint64_t nbOfValues(nbOfBytes/sizeOfValue);
+    return nbOfValues%nbOfCompo==0 && nbOfValues/nbOfCompo==nbOfTuples;
+  }
+
+  //! what is needed to unmap a file, given as parameter to MEDCouplingRawFile::Unmap
+  struct Mapping
+  {
+    void *_base;
+    std::size_t _length;
+  };
+}
+
+/*!
+ * Writes \a nbOfTuples * \a nbOfCompo values of \a sizeOfValue bytes each, starting at \a values, in the raw file \a fileName.
+ * \throw If the file cannot be written.
+ */
+void MEDCouplingRawFile::Write(const std::string& fileName, const char *arrayTypeName, const void *values, std::size_t sizeOfValue,
+                               std::size_t nbOfTuples, std::size_t nbOfCompo, std::int64_t tag)
+{
+  RawFileHeader header;
+  std::memset(&header,0,sizeof(RawFileHeader));
+  std::memcpy(header._magic,RAW_FILE_MAGIC,sizeof(RAW_FILE_MAGIC));
+  std::strncpy(header._type_name,arrayTypeName,TYPE_NAME_SIZE-1);
+  header._nb_of_tuples=nbOfTuples;
+  header._nb_of_compo=nbOfCompo;
+  header._tag=tag;
+  std::ofstream ofs(fileName.c_str(),std::ios_base::binary | std::ios_base::trunc);
+  if(!ofs)
+    {
+      std::ostringstream oss; oss << "MEDCouplingRawFile::Write : unable to open file \"" << fileName << "\" for writing !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  ofs.write(reinterpret_cast<const char *>(&header),sizeof(RawFileHeader));
+  ofs.write(reinterpret_cast<const char *>(values),(std::streamsize)(nbOfTuples*nbOfCompo*sizeOfValue));
+  ofs.close();
+  if(!ofs)
+    {
+      std::ostringstream oss; oss << "MEDCouplingRawFile::Write : error while writing file \"" << fileName << "\" !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+}
+
+/*!
+ * Maps in memory the raw file \a fileName, which must hold values of an array of type \a arrayTypeName.
+ * If \a copyOnWrite is false, the returned values are read only. Otherwise they can be modified, the modified pages being copied in memory
+ * and the file being left unchanged.
+ * \return the address of the first value. The mapping is released by calling MEDCouplingRawFile::Unmap(returned pointer, \a param).
+ * \throw If the file cannot be read or is not a raw file of \a arrayTypeName values, or if memory mapping is not available on this platform.
+ */
+void *MEDCouplingRawFile::Map(const std::string& fileName, const char *arrayTypeName, std::size_t sizeOfValue, bool copyOnWrite,
+                              std::size_t& nbOfTuples, std::size_t& nbOfCompo, std::int64_t& tag, void *& param)
+{
+#ifdef WIN32
+  throw INTERP_KERNEL::Exception("MEDCouplingRawFile::Map : memory mapping of files is not available on this platform !");
+#else
+  int fd(open(fileName.c_str(),O_RDONLY));
+  if(fd<0)
+    {
+      std::ostringstream oss; oss << "MEDCouplingRawFile::Map : unable to open file \"" << fileName << "\" !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  struct stat st;
+  RawFileHeader header;
+  if(fstat(fd,&st)!=0 || (std::size_t)st.st_size<sizeof(RawFileHeader) || read(fd,&header,sizeof(RawFileHeader))!=(ssize_t)sizeof(RawFileHeader))
+    {
+      close(fd);
+      std::ostringstream oss; oss << "MEDCouplingRawFile::Map : file \"" << fileName << "\" is too short to be a raw file !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  std::ostringstream oss; oss << "MEDCouplingRawFile::Map : file \"" << fileName << "\" ";
+  if(std::memcmp(header._magic,RAW_FILE_MAGIC,sizeof(RAW_FILE_MAGIC))!=0)
+    oss << "is not a raw file !";
+  else if(std::string(header._type_name,strnlen(header._type_name,TYPE_NAME_SIZE))!=arrayTypeName)
+    oss << "holds values of a " << std::string(header._type_name,strnlen(header._type_name,TYPE_NAME_SIZE)) << " and not of a " << arrayTypeName << " !";
+  else if(!IsSizeOfValues((std::uint64_t)st.st_size-sizeof(RawFileHeader),header._nb_of_tuples,header._nb_of_compo,sizeOfValue))
+    oss << "has a size (" << st.st_size << ") not matching the " << header._nb_of_tuples << " tuples and " << header._nb_of_compo << " components of its header !";
+  else
+    oss.str("");
+  if(!oss.str().empty())
+    {
+      close(fd);
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  std::size_t length((std::size_t)st.st_size);
+  void *base(mmap(nullptr,length,copyOnWrite?(PROT_READ | PROT_WRITE):PROT_READ,MAP_PRIVATE,fd,0));
+  close(fd);
+  if(base==MAP_FAILED)
+    {
+      std::ostringstream oss2; oss2 << "MEDCouplingRawFile::Map : unable to map file \"" << fileName << "\" in memory !";
+      throw INTERP_KERNEL::Exception(oss2.str());
+    }
+  nbOfTuples=header._nb_of_tuples;
+  nbOfCompo=header._nb_of_compo;
+  tag=header._tag;
+  Mapping *mapping(new Mapping);
+  mapping->_base=base;
+  mapping->_length=length;
+  param=mapping;
+  return reinterpret_cast<char *>(base)+sizeof(RawFileHeader);
+#endif
+}
+
+/*!
+ * Deallocator (see MemArray) of the values returned by MEDCouplingRawFile::Map.
+ */
+void MEDCouplingRawFile::Unmap(void *, void *param)
+{
+  Mapping *mapping(reinterpret_cast<Mapping *>(param));
+  if(!mapping)
+    return ;
+#ifndef WIN32
+  munmap(mapping->_base,mapping->_length);
+#endif
+  delete mapping;
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#pragma once
+
+#include "MEDCoupling.hxx"
+
+#include <string>
+#include <cstdint>
+#include <cstddef>
+
+namespace MEDCoupling
+{
+  /*!
+   * Raw binary files holding the values of a DataArray, written by DataArrayTemplate::writeRawFile and mapped in memory by
+   * DataArrayTemplate::useMappedRawFile.
+   * A file is made of a header of HEADER_SIZE bytes (magic, name of the type of array, number of tuples, number of components and an
+   * integer tag free for the caller) followed by the values, in the byte order of the machine that has written it. As the values are
+   * stored as they are in memory, mapping a file costs nothing whatever its size : pages are read from the disk only when accessed and
+   * can be dropped by the system under memory pressure.
+   */
+  class MEDCouplingRawFile
+  {
+  public:
+    //! size of the header, multiple of the alignment of all the types of values
+    static const std::size_t HEADER_SIZE=64;
+    MEDCOUPLING_EXPORT static void Write(const std::string& fileName, const char *arrayTypeName, const void *values, std::size_t sizeOfValue,
+                                         std::size_t nbOfTuples, std::size_t nbOfCompo, std::int64_t tag=0);
+    MEDCOUPLING_EXPORT static void *Map(const std::string& fileName, const char *arrayTypeName, std::size_t sizeOfValue, bool copyOnWrite,
+                                        std::size_t& nbOfTuples, std::size_t& nbOfCompo, std::int64_t& tag, void *& param);
+    MEDCOUPLING_EXPORT static void Unmap(void *, void *param);
+  };
+}
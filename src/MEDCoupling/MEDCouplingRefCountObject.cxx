@@ -26,11 +26,15 @@
 
 #include <sstream>
 #include <algorithm>
+#include <atomic>
 
 using namespace MEDCoupling;
 
 GlobalDict *GlobalDict::UNIQUE_INSTANCE=0;
 
+//! number of threads used by the multi threaded algorithms of MEDCoupling, see MEDCouplingSetNumberOfThreads
+static std::atomic<int> NUMBER_OF_THREADS(1);
+
 const char *MEDCoupling::MEDCouplingVersionStr()
 {
   return MEDCOUPLING_VERSION_STR;
@@ -86,6 +90,25 @@ bool MEDCoupling::IsCXX11Compiled()
   return true;
 }
 
+/*!
+ * Sets the number of threads used by the multi threaded algorithms of MEDCoupling (for example the evaluation of
+ * expressions in DataArrayDouble::applyFunc). 1, the default, means that everything runs in the calling thread.
+ * A value lower or equal to 0 means as many threads as the hardware supports.
+ * The results do not depend on the number of threads.
+ */
+void MEDCoupling::MEDCouplingSetNumberOfThreads(int nbThreads)
+{
+  NUMBER_OF_THREADS=nbThreads;
+}
+
+/*!
+ * \sa MEDCouplingSetNumberOfThreads
+ */
+int MEDCoupling::MEDCouplingGetNumberOfThreads()
+{
+  return NUMBER_OF_THREADS;
+}
+
 //=
 
 std::string BigMemoryObject::debugHeapMemorySize() const
@@ -286,6 +309,20 @@ void RefCountObjectOnly::incrRef() const
   _cnt++;
 }
 
+/*!
+ * Increments the reference counter, unless it already dropped to 0 because \a this is being destroyed. Used by the registries
+ * keeping instances without owning them, which may find an instance whose last reference is being released by another thread.
+ * \return true if a reference has been taken.
+ */
+bool RefCountObjectOnly::incrRefIfAlive() const
+{
+  int cnt(_cnt.load());
+  while(cnt>0)
+    if(_cnt.compare_exchange_weak(cnt,cnt+1))
+      return true;
+  return false;
+}
+
 int RefCountObjectOnly::getRCValue() const
 {
   return _cnt;
@@ -68,6 +68,8 @@ namespace MEDCoupling
   MEDCOUPLING_EXPORT bool MEDCouplingByteOrder();
   MEDCOUPLING_EXPORT const char *MEDCouplingByteOrderStr();
   MEDCOUPLING_EXPORT bool IsCXX11Compiled();
+  MEDCOUPLING_EXPORT void MEDCouplingSetNumberOfThreads(int nbThreads);
+  MEDCOUPLING_EXPORT int MEDCouplingGetNumberOfThreads();
   
   class MEDCOUPLING_EXPORT BigMemoryObject
   {
@@ -95,6 +97,7 @@ namespace MEDCoupling
   public:
     bool decrRef() const;
     void incrRef() const;
+    bool incrRefIfAlive() const;
     int getRCValue() const;
     RefCountObjectOnly& operator=(const RefCountObjectOnly& other);
   protected:
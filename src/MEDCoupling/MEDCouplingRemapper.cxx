@@ -25,9 +25,12 @@
 #include "MEDCouplingFieldDiscretization.hxx"
 #include "MEDCouplingMappedExtrudedMesh.hxx"
 #include "MEDCouplingCMesh.hxx"
+#include "MEDCouplingUMesh.hxx"
+#include "MEDCouplingSkyLineArray.hxx"
 #include "MEDCouplingNormalizedUnstructuredMesh.txx"
 #include "MEDCouplingNormalizedCartesianMesh.txx"
 #include "MEDCouplingFieldDiscretizationOnNodesFE.hxx"
+#include "MEDCouplingMultiFields.hxx"
 
 #include "Interpolation1D.txx"
 #include "Interpolation2DCurve.hxx"
@@ -41,9 +44,84 @@
 #include "InterpolationCU.txx"
 #include "InterpolationCC.txx"
 
+#include <algorithm>
+#include <fstream>
+#include <cstring>
+#include <limits>
+
 using namespace MEDCoupling;
 
-MEDCouplingRemapper::MEDCouplingRemapper():_src_ft(0),_target_ft(0),_interp_matrix_pol(IK_ONLY_PREFERED),_nature_of_deno(NoNature),_time_deno_update(0)
+namespace
+{
+  //! header of the files written by MEDCouplingRemapper::saveMatrix
+  const char MATRIX_FILE_MAGIC[8]={'M','C','R','E','M','A','P','\0'};
+  const std::int32_t MATRIX_FILE_VERSION=1;
+
+  template<class T>
+  void WriteBinary(std::ostream& os, const T *data, std::size_t nbOfElems)
+  {
+    os.write(reinterpret_cast<const char *>(data),sizeof(T)*nbOfElems);
+  }
+
+  template<class T>
+  void WriteBinary(std::ostream& os, T value)
+  {
+    WriteBinary(os,&value,1);
+  }
+
+  template<class T>
+  void ReadBinary(std::istream& is, T *data, std::size_t nbOfElems, const std::string& fileName)
+  {
+    is.read(reinterpret_cast<char *>(data),sizeof(T)*nbOfElems);
+    if(!is)
+      {
+        std::ostringstream oss; oss << "MEDCouplingRemapper::loadMatrix : file \"" << fileName << "\" is truncated or unreadable !";
+        throw INTERP_KERNEL::Exception(oss.str());
+      }
+  }
+
+  template<class T>
+  T ReadBinary(std::istream& is, const std::string& fileName)
+  {
+    T ret;
+    ReadBinary(is,&ret,1,fileName);
+    return ret;
+  }
+
+  //! number of bytes remaining in \a is, or the max if it can not be known (non seekable stream)
+  std::uint64_t RemainingSize(std::istream& is)
+  {
+    std::istream::pos_type pos(is.tellg());
+    if(pos==std::istream::pos_type(-1))
+      return std::numeric_limits<std::uint64_t>::max();
+    is.seekg(0,std::ios_base::end);
+    std::istream::pos_type end(is.tellg());
+    is.seekg(pos);
+    if(end==std::istream::pos_type(-1) || end<pos)
+      return std::numeric_limits<std::uint64_t>::max();
+    return (std::uint64_t)(end-pos);
+  }
+
+  //! time of the last modification of the nodal connectivity given by \a conn and \a connI
+  std::size_t TimeOfConnectivity(const MEDCoupling::DataArrayIdType *conn, const MEDCoupling::DataArrayIdType *connI)
+  {
+    return std::max(conn->getTimeOfThis(),connI->getTimeOfThis());
+  }
+
+  //! FNV-1a hash of \a nbOfBytes bytes starting at \a data, chained with \a hash
+  std::uint64_t HashBytes(const void *data, std::size_t nbOfBytes, std::uint64_t hash)
+  {
+    const unsigned char *pt(reinterpret_cast<const unsigned char *>(data));
+    for(std::size_t i=0;i<nbOfBytes;i++)
+      {
+        hash^=pt[i];
+        hash*=1099511628211ULL;
+      }
+    return hash;
+  }
+}
+
+MEDCouplingRemapper::MEDCouplingRemapper():_src_ft(0),_target_ft(0),_interp_matrix_pol(IK_ONLY_PREFERED),_nature_of_deno(NoNature),_time_deno_update(std::numeric_limits<std::size_t>::max()),_nb_of_cols(0),_src_time_ref(0),_target_conn_time_ref(0)
 {
 }
 
@@ -95,6 +173,141 @@ int MEDCouplingRemapper::prepareEx(const MEDCouplingFieldTemplate *src, const ME
     return prepareNotInterpKernelOnly();
 }
 
+/*!
+ * Same as MEDCouplingRemapper::prepare but designed for a target mesh that moves or deforms slightly between two calls, as in ALE computations.
+ * If \a this has been prepared by a previous call to prepareIncremental with the same source mesh (not modified since) and the same method,
+ * and if \a targetMesh has the same nodal connectivity than the previous target mesh, only the rows of the matrix relative to the target cells
+ * having at least one node moved by more than \a eps since their row has been computed are computed again. Otherwise the whole matrix is computed
+ * as MEDCouplingRemapper::prepare does.
+ *
+ * The incremental computation is done only for unstructured meshes having the same mesh dimension, with a target field on cells ("P0P0" or "P1P0"),
+ * because the row \a i of the matrix then only depends on the target cell \a i. Only the source cells close to the moved target cells are
+ * intersected again, using the tree of the bounding boxes of the source cells that the source mesh keeps between two calls.
+ * The nodes moved by less than \a eps are not taken into account. As a recomputed row uses the current position of all the nodes of its cell,
+ * whereas the reference position of a node is updated only when it moves by more than \a eps, each row is the one of a target mesh whose nodes
+ * differ from the ones of \a targetMesh by less than 2*\a eps. \a eps equal to 0. gives exactly the matrix MEDCouplingRemapper::prepare would compute.
+ * As everywhere in MEDCoupling, modifications done in place on the source mesh must be notified by a call to declareAsNew.
+ *
+ * \param [in] srcMesh the source mesh.
+ * \param [in] targetMesh the target mesh, typically the previous target mesh with moved nodes.
+ * \param [in] method the interpolation method, see MEDCouplingRemapper::prepare.
+ * \param [in] eps the displacement of a node above which the rows of the cells sharing it are computed again.
+ * \return the number of rows of the matrix that have been computed by this call.
+ *
+ * \sa MEDCouplingRemapper::prepare
+ */
+mcIdType MEDCouplingRemapper::prepareIncremental(const MEDCouplingMesh *srcMesh, const MEDCouplingMesh *targetMesh, const std::string& method, double eps)
+{
+  const MEDCouplingUMesh *trgUMesh(dynamic_cast<const MEDCouplingUMesh *>(targetMesh));
+  if(!isIncrementalPrepareAllowed(srcMesh,trgUMesh,method))
+    {
+      prepare(srcMesh,targetMesh,method);
+      keepTrackOfSupportsForIncrementalPrepare();
+      return getNumberOfRowsOfMatrix();
+    }
+  // nodes moved by more than eps since the computation of the rows of the cells sharing them
+  const DataArrayDouble *coords(trgUMesh->getCoords());
+  std::size_t spaceDim(coords->getNumberOfComponents());
+  mcIdType nbOfNodes(coords->getNumberOfTuples());
+  const double *newPt(coords->begin()),*refPt(_target_coords_ref->begin());
+  std::vector<mcIdType> movedNodes;
+  for(mcIdType i=0;i<nbOfNodes;i++)
+    {
+      double dist2(0.);
+      for(std::size_t j=0;j<spaceDim;j++)
+        dist2+=(newPt[i*spaceDim+j]-refPt[i*spaceDim+j])*(newPt[i*spaceDim+j]-refPt[i*spaceDim+j]);
+      if(dist2>eps*eps)
+        movedNodes.push_back(i);
+    }
+  MCAuto<MEDCouplingFieldTemplate> src,target;
+  BuildFieldTemplatesFrom(srcMesh,targetMesh,method,src,target);
+  if(movedNodes.empty())
+    {
+      _target_ft=target;
+      return 0;
+    }
+  MCAuto<DataArrayIdType> cellsToUpdate(trgUMesh->getCellIdsLyingOnNodes(&movedNodes[0],&movedNodes[0]+movedNodes.size(),false));
+  mcIdType nbOfCellsToUpdate(cellsToUpdate->getNumberOfTuples());
+  MCAuto<MEDCouplingUMesh> partOfTarget(trgUMesh->buildPartOfMySelf(cellsToUpdate->begin(),cellsToUpdate->end(),true));
+  // only the source cells whose bounding box intersects the one of a moved target cell are intersected. They are found with the tree
+  // of the bounding boxes of the source cells kept by the source mesh between two calls (see MEDCouplingUMesh::getCellsInBoundingBoxes),
+  // enlarged as the interpolation kernels do.
+  const MEDCouplingUMesh *srcUMesh(static_cast<const MEDCouplingUMesh *>(srcMesh));
+  MCAuto<DataArrayDouble> trgBBoxes(partOfTarget->getBoundingBoxForBBTree());
+  double adjAbs(std::max(getBoundingBoxAdjustmentAbs(),0.));
+  double *trgBBoxesPtr(trgBBoxes->getPointer());
+  for(std::size_t i=0;i<trgBBoxes->getNbOfElems();i++)
+    trgBBoxesPtr[i]+=(i%2==0?-adjAbs:adjAbs);
+  MCAuto<MEDCouplingSkyLineArray> srcCellsPerTrgCell(srcUMesh->getCellsInBoundingBoxes(trgBBoxes,std::max(getBoundingBoxAdjustment(),0.)));
+  std::vector<mcIdType> srcCells(srcCellsPerTrgCell->getValues(),srcCellsPerTrgCell->getValues()+srcCellsPerTrgCell->getLength());
+  std::sort(srcCells.begin(),srcCells.end());
+  srcCells.erase(std::unique(srcCells.begin(),srcCells.end()),srcCells.end());
+  MCAuto<DataArrayIdType> partIndexArr,partColIdsArr;
+  MCAuto<DataArrayDouble> partValuesArr;
+  if(!srcCells.empty())
+    {
+      MCAuto<MEDCouplingUMesh> partOfSource(srcUMesh->buildPartOfMySelf(&srcCells[0],&srcCells[0]+srcCells.size(),true));
+      MEDCouplingRemapper partRemapper;
+      partRemapper.copyOptions(*this);
+      partRemapper.setInterpolationMatrixPolicy(getInterpolationMatrixPolicy());
+      partRemapper.prepare(partOfSource,partOfTarget,method);
+      partIndexArr=partRemapper._matrix_index; partColIdsArr=partRemapper._matrix_col_ids; partValuesArr=partRemapper._matrix_values;
+      // for a source field on cells the columns are the cells of partOfSource. Coordinates are kept so the node ids are unchanged.
+      if(src->getDiscretization()->getEnum()==ON_CELLS)
+        {
+          partColIdsArr=partColIdsArr->deepCopy();
+          mcIdType *pt(partColIdsArr->getPointer());
+          for(std::size_t i=0;i<partColIdsArr->getNbOfElems();i++)
+            pt[i]=srcCells[pt[i]];
+        }
+    }
+  else
+    {
+      partIndexArr=DataArrayIdType::New(); partIndexArr->alloc(nbOfCellsToUpdate+1,1); partIndexArr->fillWithZero();
+      partColIdsArr=DataArrayIdType::New(); partColIdsArr->alloc(0,1);
+      partValuesArr=DataArrayDouble::New(); partValuesArr->alloc(0,1);
+    }
+  // merge the recomputed rows with the other ones
+  mcIdType nbOfRows(getNumberOfRowsOfMatrix());
+  const mcIdType *oldIndex(_matrix_index->begin()),*oldColIds(_matrix_col_ids->begin()),*partIndex(partIndexArr->begin()),*partColIds(partColIdsArr->begin());
+  const double *oldValues(_matrix_values->begin()),*partValues(partValuesArr->begin());
+  std::vector<mcIdType> rowInPart(nbOfRows,-1);
+  for(mcIdType i=0;i<nbOfCellsToUpdate;i++)
+    rowInPart[cellsToUpdate->getIJ(i,0)]=i;
+  MCAuto<DataArrayIdType> matrixIndex(DataArrayIdType::New()),matrixColIds(DataArrayIdType::New());
+  MCAuto<DataArrayDouble> matrixValues(DataArrayDouble::New());
+  matrixIndex->alloc(nbOfRows+1,1);
+  mcIdType *indexPtr(matrixIndex->getPointer());
+  indexPtr[0]=0;
+  for(mcIdType i=0;i<nbOfRows;i++)
+    indexPtr[i+1]=indexPtr[i]+(rowInPart[i]==-1?oldIndex[i+1]-oldIndex[i]:partIndex[rowInPart[i]+1]-partIndex[rowInPart[i]]);
+  matrixColIds->alloc(indexPtr[nbOfRows],1); matrixValues->alloc(indexPtr[nbOfRows],1);
+  mcIdType *colIdsPtr(matrixColIds->getPointer());
+  double *valuesPtr(matrixValues->getPointer());
+  for(mcIdType i=0;i<nbOfRows;i++)
+    {
+      mcIdType start(oldIndex[i]),stop(oldIndex[i+1]);
+      const mcIdType *colIds(oldColIds);
+      const double *values(oldValues);
+      if(rowInPart[i]!=-1)
+        { start=partIndex[rowInPart[i]]; stop=partIndex[rowInPart[i]+1]; colIds=partColIds; values=partValues; }
+      colIdsPtr=std::copy(colIds+start,colIds+stop,colIdsPtr);
+      valuesPtr=std::copy(values+start,values+stop,valuesPtr);
+    }
+  _target_ft=target;
+  _matrix.clear();
+  _matrix_index=matrixIndex; _matrix_col_ids=matrixColIds; _matrix_values=matrixValues;
+  _deno_multiply.nullify();
+  _deno_reverse_multiply.nullify();
+  // the reference position of the moved nodes is now their current position
+  double *refPtW(_target_coords_ref->getPointer());
+  for(std::vector<mcIdType>::const_iterator it=movedNodes.begin();it!=movedNodes.end();it++)
+    std::copy(newPt+(*it)*spaceDim,newPt+(*it+1)*spaceDim,refPtW+(*it)*spaceDim);
+  keepTrackOfSupportsForIncrementalPrepare();
+  declareAsNew();
+  return nbOfCellsToUpdate;
+}
+
 void MEDCouplingRemapper::setCrudeMatrix(const MEDCouplingMesh *srcMesh, const MEDCouplingMesh *targetMesh, const std::string& method, const std::vector<std::map<mcIdType,double> >& m)
 {
   MCAuto<MEDCouplingFieldTemplate> src,target;
@@ -127,6 +340,71 @@ void MEDCouplingRemapper::setCrudeMatrixEx(const MEDCouplingFieldTemplate *src,
   synchronizeSizeOfSideMatricesAfterMatrixComputation(srcNbElem);
 }
 
+/*!
+ * Saves the matrix computed by MEDCouplingRemapper::prepare (or given by MEDCouplingRemapper::setCrudeMatrix) in the binary file \a fileName,
+ * with the interpolation method, the interpolation options and a fingerprint of the source and target supports.
+ * The matrix can then be reloaded with MEDCouplingRemapper::loadMatrix instead of being computed again, as long as the supports are unchanged.
+ * The file is written with the byte order and the size of identifiers of the current platform.
+ *
+ * \param [in] fileName the name of the file to write. If it exists, it is overwritten.
+ * \sa loadMatrix
+ */
+void MEDCouplingRemapper::saveMatrix(const std::string& fileName) const
+{
+  checkPrepare();
+  std::ofstream ofs(fileName.c_str(),std::ios_base::binary | std::ios_base::trunc);
+  if(!ofs)
+    {
+      std::ostringstream oss; oss << "MEDCouplingRemapper::saveMatrix : unable to open file \"" << fileName << "\" for writing !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  writeMatrix(ofs);
+  ofs.close();
+  if(!ofs)
+    {
+      std::ostringstream oss; oss << "MEDCouplingRemapper::saveMatrix : error while writing file \"" << fileName << "\" !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+}
+
+/*!
+ * Loads a matrix saved by MEDCouplingRemapper::saveMatrix. After this call \a this is in the same state than after the MEDCouplingRemapper::prepare
+ * call which has computed the matrix : same method, same options, same matrix. An exception is thrown if \a srcMesh or \a targetMesh do not
+ * match the supports used to compute the saved matrix.
+ *
+ * \param [in] srcMesh the source mesh, identical to the one given to prepare before saving.
+ * \param [in] targetMesh the target mesh, identical to the one given to prepare before saving.
+ * \param [in] fileName the name of the file written by MEDCouplingRemapper::saveMatrix.
+ * \sa saveMatrix, loadMatrixEx
+ */
+void MEDCouplingRemapper::loadMatrix(const MEDCouplingMesh *srcMesh, const MEDCouplingMesh *targetMesh, const std::string& fileName)
+{
+  std::ifstream ifs(fileName.c_str(),std::ios_base::binary);
+  if(!ifs)
+    {
+      std::ostringstream oss; oss << "MEDCouplingRemapper::loadMatrix : unable to open file \"" << fileName << "\" !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  std::string method(ReadMethodOfMatrix(ifs,fileName));
+  MCAuto<MEDCouplingFieldTemplate> src,target;
+  BuildFieldTemplatesFrom(srcMesh,targetMesh,method,src,target);
+  loadMatrixEx(src,target,fileName);
+}
+
+/*!
+ * Same as MEDCouplingRemapper::loadMatrix with field templates, to be used if the matrix has been computed with MEDCouplingRemapper::prepareEx.
+ */
+void MEDCouplingRemapper::loadMatrixEx(const MEDCouplingFieldTemplate *src, const MEDCouplingFieldTemplate *target, const std::string& fileName)
+{
+  std::ifstream ifs(fileName.c_str(),std::ios_base::binary);
+  if(!ifs)
+    {
+      std::ostringstream oss; oss << "MEDCouplingRemapper::loadMatrix : unable to open file \"" << fileName << "\" !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  readMatrix(ifs,fileName,src,target);
+}
+
 int MEDCouplingRemapper::prepareInterpKernelOnly()
 {
   int meshInterpType=((int)_src_ft->getMesh()->getType()*16)+(int)_target_ft->getMesh()->getType();
@@ -200,6 +478,10 @@ int MEDCouplingRemapper::prepareNotInterpKernelOnly()
  *             cell not intercepted by any source cell is a bug so in this case it is advised to set a huge value (1e300 for example) to \a dftValue to quickly point to the problem. But for users doing parallelism a target cell can
  *             be intercepted by a source cell on a different process. In this case 0. assigned to \a dftValue is more appropriate.
  *
+ * If the array of \b targetField is set, the values are written directly into it : it is neither replaced nor reallocated, and no copy of the
+ * source array is done. So a target array viewing memory owned by the caller (see DataArrayTemplate::useExternalArrayWithRWAccess and
+ * DataArrayTemplate::useExternalArrayWithDeallocator) receives the result in place. Otherwise an array is allocated and set to \b targetField.
+ *
  * \sa transferField
  */
 void MEDCouplingRemapper::transfer(const MEDCouplingFieldDouble *srcField, MEDCouplingFieldDouble *targetField, double dftValue)
@@ -214,6 +496,7 @@ void MEDCouplingRemapper::transfer(const MEDCouplingFieldDouble *srcField, MEDCo
  * If an entity (cell for example) in targetField is not fetched by any entity (cell for example) of \b srcField, the value in targetField is
  * let unchanged.
  * This method requires that \b targetField was fully defined and allocated. If the array is not allocated an exception will be thrown.
+ * As for MEDCoupling::MEDCouplingRemapper::transfer, the values are written in place in the array of \b targetField, without reallocation nor copy.
  * 
  * \param [in] srcField is the source field from which the interpolation will be done. The mesh into \b srcField should be the same than those specified on MEDCoupling::MEDCouplingRemapper::prepare.
  * \param [in,out] targetField the destination field with the allocated array in which only tuples whose entities are fetched by interpolation will be overwritten only.
@@ -307,6 +590,96 @@ MEDCouplingFieldDouble *MEDCouplingRemapper::reverseTransferField(const MEDCoupl
   return ret;
 }
 
+/*!
+ * This method is equivalent to a call to MEDCouplingRemapper::transfer for each pair (\a srcFields[i], \a targetFields[i]), but the matrix is walked only
+ * once for all the fields, and the denominators are computed only once per \ref NatureOfField "nature of field". This is the method to use to transfer
+ * several fields lying on the same support at each time step. The result is exactly the same than with MEDCouplingRemapper::transfer.
+ *
+ * \param [in] srcFields the source fields, lying on the source support given to MEDCouplingRemapper::prepare.
+ * \param [in,out] targetFields the target fields, lying on the target support given to MEDCouplingRemapper::prepare. Their arrays are allocated if needed.
+ * \param [in] dftValue is the value assigned to each target entity not intercepted by any source entity (see MEDCouplingRemapper::transfer).
+ *
+ * \sa transferFields
+ */
+void MEDCouplingRemapper::transferMulti(const std::vector<const MEDCouplingFieldDouble *>& srcFields, const std::vector<MEDCouplingFieldDouble *>& targetFields, double dftValue)
+{
+  std::size_t nbOfFields(srcFields.size());
+  if(nbOfFields!=targetFields.size())
+    {
+      std::ostringstream oss; oss << "MEDCouplingRemapper::transferMulti : there are " << nbOfFields << " source fields and " << targetFields.size() << " target fields !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  std::vector<NatureOfField> natures;
+  for(std::size_t i=0;i<nbOfFields;i++)
+    {
+      if(!srcFields[i] || !targetFields[i])
+        throw INTERP_KERNEL::Exception("MEDCouplingRemapper::transferMulti : input fields must be all not NULL !");
+      checkTransferAndAllocTarget(srcFields[i],targetFields[i],true);
+      if(std::find(natures.begin(),natures.end(),srcFields[i]->getNature())==natures.end())
+        natures.push_back(srcFields[i]->getNature());
+    }
+  for(std::vector<NatureOfField>::const_iterator it=natures.begin();it!=natures.end();it++)
+    {
+      std::vector<const double *> inputPointers;
+      std::vector<int> inputNbOfCompos;
+      std::vector<double *> resPointers;
+      std::size_t firstId(nbOfFields);
+      for(std::size_t i=0;i<nbOfFields;i++)
+        if(srcFields[i]->getNature()==*it)
+          {
+            if(firstId==nbOfFields)
+              firstId=i;
+            inputPointers.push_back(srcFields[i]->getArray()->begin());
+            inputNbOfCompos.push_back((int)srcFields[i]->getNumberOfComponents());
+            resPointers.push_back(targetFields[i]->getArray()->getPointer());
+          }
+      computeDeno(*it,srcFields[firstId],targetFields[firstId]);
+      computeProduct(inputPointers,inputNbOfCompos,true,dftValue,resPointers);
+    }
+}
+
+/*!
+ * Same as MEDCouplingRemapper::transferField for several fields at once (see MEDCouplingRemapper::transferMulti).
+ * \return the target fields, in the same order than \a srcFields, to be deallocated by the caller.
+ *
+ * \sa transferMulti
+ */
+std::vector<MEDCouplingFieldDouble *> MEDCouplingRemapper::transferFields(const std::vector<const MEDCouplingFieldDouble *>& srcFields, double dftValue)
+{
+  checkPrepare();
+  std::size_t nbOfFields(srcFields.size());
+  std::vector< MCAuto<MEDCouplingFieldDouble> > ret(nbOfFields);
+  std::vector<MEDCouplingFieldDouble *> targetFields(nbOfFields);
+  for(std::size_t i=0;i<nbOfFields;i++)
+    {
+      if(!srcFields[i])
+        throw INTERP_KERNEL::Exception("MEDCouplingRemapper::transferFields : presence of NULL source field !");
+      srcFields[i]->checkConsistencyLight();
+      if(_src_ft->getDiscretization()->getStringRepr()!=srcFields[i]->getDiscretization()->getStringRepr())
+        throw INTERP_KERNEL::Exception("Incoherency with prepare call for source field");
+      ret[i]=MEDCouplingFieldDouble::New(*_target_ft,srcFields[i]->getTimeDiscretization());
+      ret[i]->setNature(srcFields[i]->getNature());
+      targetFields[i]=ret[i];
+    }
+  transferMulti(srcFields,targetFields,dftValue);
+  for(std::size_t i=0;i<nbOfFields;i++)
+    {
+      ret[i]->copyAllTinyAttrFrom(srcFields[i]);//perform copy of tiny strings after and not before transfer because the array will be created on transfer
+      targetFields[i]=ret[i].retn();
+    }
+  return targetFields;
+}
+
+/*!
+ * Same as MEDCouplingRemapper::transferFields with the fields of \a srcFields.
+ */
+std::vector<MEDCouplingFieldDouble *> MEDCouplingRemapper::transferFields(const MEDCouplingMultiFields *srcFields, double dftValue)
+{
+  if(!srcFields)
+    throw INTERP_KERNEL::Exception("MEDCouplingRemapper::transferFields : input multi fields is NULL !");
+  return transferFields(srcFields->getFields(),dftValue);
+}
+
 /*!
  * This method does nothing more than inherited INTERP_KERNEL::InterpolationOptions::setOptionInt method. This method
  * is here only for automatic CORBA generators.
@@ -1041,17 +1414,277 @@ void MEDCouplingRemapper::checkPrepare() const
     throw INTERP_KERNEL::Exception("MEDCouplingRemapper::checkPrepare : it appears that MEDCouplingRemapper::prepare(Ex) has not been called !");
   if(!s->getMesh() || !t->getMesh())
     throw INTERP_KERNEL::Exception("MEDCouplingRemapper::checkPrepare : it appears that no all field templates have their mesh set !");
+  if(_matrix_index.isNull())
+    throw INTERP_KERNEL::Exception("MEDCouplingRemapper::checkPrepare : it appears that the matrix has not been computed !");
 }
 
+/*!
+ * Called right after the computation of the crude matrix in \a _matrix. The matrix is converted in compressed sparse row format
+ * (\a _matrix_index, \a _matrix_col_ids, \a _matrix_values) used by the transfers, and the map format is released. It will be
+ * rebuilt only if getCrudeMatrix is called.
+ */
 void MEDCouplingRemapper::synchronizeSizeOfSideMatricesAfterMatrixComputation(mcIdType nbOfColsInMatrix)
 {
-  _deno_multiply.clear();
-  _deno_multiply.resize(_matrix.size());
-  _deno_reverse_multiply.clear();
-  _deno_reverse_multiply.resize(nbOfColsInMatrix);
+  mcIdType nbOfRows(ToIdType(_matrix.size())),nbOfCoeffs(0);
+  for(std::vector<std::map<mcIdType,double> >::const_iterator iter1=_matrix.begin();iter1!=_matrix.end();iter1++)
+    nbOfCoeffs+=ToIdType((*iter1).size());
+  _matrix_index=DataArrayIdType::New(); _matrix_index->alloc(nbOfRows+1,1);
+  _matrix_col_ids=DataArrayIdType::New(); _matrix_col_ids->alloc(nbOfCoeffs,1);
+  _matrix_values=DataArrayDouble::New(); _matrix_values->alloc(nbOfCoeffs,1);
+  mcIdType *indexPtr(_matrix_index->getPointer()),*colIdsPtr(_matrix_col_ids->getPointer());
+  double *valuesPtr(_matrix_values->getPointer());
+  *indexPtr=0;
+  for(std::vector<std::map<mcIdType,double> >::const_iterator iter1=_matrix.begin();iter1!=_matrix.end();iter1++,indexPtr++)
+    {
+      for(std::map<mcIdType,double>::const_iterator iter2=(*iter1).begin();iter2!=(*iter1).end();iter2++)
+        {
+          *colIdsPtr++=(*iter2).first;
+          *valuesPtr++=(*iter2).second;
+        }
+      indexPtr[1]=indexPtr[0]+ToIdType((*iter1).size());
+    }
+  std::vector<std::map<mcIdType,double> >().swap(_matrix);
+  _nb_of_cols=nbOfColsInMatrix;
+  _deno_multiply.nullify();
+  _deno_reverse_multiply.nullify();
+  declareAsNew();
+}
+
+mcIdType MEDCouplingRemapper::getNumberOfRowsOfMatrix() const
+{
+  if(_matrix_index.isNull())
+    return 0;
+  return _matrix_index->getNumberOfTuples()-1;
+}
+
+/*!
+ * Returns true if the matrix of \a this can be updated by MEDCouplingRemapper::prepareIncremental instead of being computed from scratch.
+ */
+bool MEDCouplingRemapper::isIncrementalPrepareAllowed(const MEDCouplingMesh *srcMesh, const MEDCouplingUMesh *targetMesh, const std::string& method) const
+{
+  if(_target_coords_ref.isNull() || _matrix_index.isNull() || !targetMesh || !srcMesh)
+    return false;
+  const MEDCouplingFieldTemplate *s(_src_ft),*t(_target_ft);
+  if(!s || !t || s->getMesh()!=srcMesh || !dynamic_cast<const MEDCouplingUMesh *>(srcMesh))
+    return false;
+  std::string srcMeth,trgMeth;
+  if(checkAndGiveInterpolationMethodStr(srcMeth,trgMeth)!=method)
+    return false;
+  srcMesh->updateTime();
+  if(srcMesh->getTimeOfThis()!=_src_time_ref)
+    return false;
+  const DataArrayDouble *coords(targetMesh->getCoords());
+  const DataArrayIdType *conn(targetMesh->getNodalConnectivity()),*connI(targetMesh->getNodalConnectivityIndex());
+  if(!coords || !conn || !connI)
+    return false;
+  if(coords->getNumberOfTuples()!=_target_coords_ref->getNumberOfTuples() || coords->getNumberOfComponents()!=_target_coords_ref->getNumberOfComponents())
+    return false;
+  if(TimeOfConnectivity(_target_conn_ref,_target_conn_index_ref)!=_target_conn_time_ref)
+    return false;// reference connectivity modified in place
+  if(conn==_target_conn_ref && connI==_target_conn_index_ref)
+    return true;
+  return conn->isEqual(*_target_conn_ref) && connI->isEqual(*_target_conn_index_ref);
+}
+
+/*!
+ * Stores the state of the supports of \a this for a next call to prepareIncremental. Nothing is stored if the matrix can not be updated
+ * row by row. The reference coordinates of the target nodes are set only if they are not already set.
+ */
+void MEDCouplingRemapper::keepTrackOfSupportsForIncrementalPrepare()
+{
+  const MEDCouplingPointSet *src(dynamic_cast<const MEDCouplingPointSet *>(_src_ft->getMesh()));
+  const MEDCouplingUMesh *trg(dynamic_cast<const MEDCouplingUMesh *>(_target_ft->getMesh()));
+  std::string srcMeth,trgMeth;
+  checkAndGiveInterpolationMethodStr(srcMeth,trgMeth);
+  if(!src || !trg || trgMeth!="P0" || (srcMeth!="P0" && srcMeth!="P1") || src->getMeshDimension()!=trg->getMeshDimension())
+    return ;
+  if(!trg->getCoords() || !trg->getNodalConnectivity() || !trg->getNodalConnectivityIndex())
+    return ;
+  src->updateTime();
+  _src_time_ref=src->getTimeOfThis();
+  if(_target_coords_ref.isNull())
+    _target_coords_ref=trg->getCoords()->deepCopy();
+  _target_conn_ref.takeRef(const_cast<DataArrayIdType *>(trg->getNodalConnectivity()));
+  _target_conn_index_ref.takeRef(const_cast<DataArrayIdType *>(trg->getNodalConnectivityIndex()));
+  _target_conn_time_ref=TimeOfConnectivity(_target_conn_ref,_target_conn_index_ref);
+}
+
+/*!
+ * Reads the header of a file written by MEDCouplingRemapper::saveMatrix and returns the interpolation method stored in it.
+ * \a is is left positioned after the method.
+ */
+std::string MEDCouplingRemapper::ReadMethodOfMatrix(std::istream& is, const std::string& fileName)
+{
+  char magic[sizeof(MATRIX_FILE_MAGIC)];
+  ReadBinary(is,magic,sizeof(MATRIX_FILE_MAGIC),fileName);
+  if(std::memcmp(magic,MATRIX_FILE_MAGIC,sizeof(MATRIX_FILE_MAGIC))!=0)
+    {
+      std::ostringstream oss; oss << "MEDCouplingRemapper::loadMatrix : file \"" << fileName << "\" has not been written by MEDCouplingRemapper::saveMatrix !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  std::int32_t version(ReadBinary<std::int32_t>(is,fileName)),idSize(ReadBinary<std::int32_t>(is,fileName));
+  if(version!=MATRIX_FILE_VERSION)
+    {
+      std::ostringstream oss; oss << "MEDCouplingRemapper::loadMatrix : file \"" << fileName << "\" has version " << version << " whereas version " << MATRIX_FILE_VERSION << " is expected !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  if(idSize!=(std::int32_t)sizeof(mcIdType))
+    {
+      std::ostringstream oss; oss << "MEDCouplingRemapper::loadMatrix : file \"" << fileName << "\" has been written with " << 8*idSize << " bits identifiers whereas this version of MEDCoupling uses " << 8*sizeof(mcIdType) << " bits identifiers !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  std::int32_t methodSize(ReadBinary<std::int32_t>(is,fileName));
+  if(methodSize<0 || methodSize>1024)
+    {
+      std::ostringstream oss; oss << "MEDCouplingRemapper::loadMatrix : file \"" << fileName << "\" is corrupted !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  std::string ret(methodSize,' ');
+  if(methodSize>0)
+    ReadBinary(is,&ret[0],methodSize,fileName);
+  return ret;
+}
+
+void MEDCouplingRemapper::writeMatrix(std::ostream& os) const
+{
+  std::string srcMeth,trgMeth;
+  std::string method(checkAndGiveInterpolationMethodStr(srcMeth,trgMeth));
+  WriteBinary(os,MATRIX_FILE_MAGIC,sizeof(MATRIX_FILE_MAGIC));
+  WriteBinary(os,MATRIX_FILE_VERSION);
+  WriteBinary(os,(std::int32_t)sizeof(mcIdType));
+  WriteBinary(os,(std::int32_t)method.size());
+  WriteBinary(os,method.c_str(),method.size());
+  // options
+  WriteBinary(os,(std::int32_t)getPrintLevel());
+  WriteBinary(os,(std::int32_t)getIntersectionType());
+  WriteBinary(os,getPrecision());
+  WriteBinary(os,getMedianPlane());
+  WriteBinary(os,(std::int32_t)getDoRotate());
+  WriteBinary(os,getBoundingBoxAdjustment());
+  WriteBinary(os,getBoundingBoxAdjustmentAbs());
+  WriteBinary(os,getMaxDistance3DSurfIntersect());
+  WriteBinary(os,getMinDotBtwPlane3DSurfIntersect());
+  WriteBinary(os,(std::int32_t)getOrientation());
+  WriteBinary(os,(std::int32_t)getMeasureAbsStatus());
+  WriteBinary(os,(std::int32_t)getSplittingPolicy());
+  WriteBinary(os,(std::int32_t)getNbThreads());
+  WriteBinary(os,(std::int32_t)_interp_matrix_pol);
+  // supports
+  WriteBinary(os,ComputeFingerPrint(_src_ft));
+  WriteBinary(os,ComputeFingerPrint(_target_ft));
+  // matrix
+  WriteBinary(os,getNumberOfRowsOfMatrix());
+  WriteBinary(os,_nb_of_cols);
+  WriteBinary(os,_matrix_values->getNumberOfTuples());
+  WriteBinary(os,_matrix_index->begin(),_matrix_index->getNbOfElems());
+  WriteBinary(os,_matrix_col_ids->begin(),_matrix_col_ids->getNbOfElems());
+  WriteBinary(os,_matrix_values->begin(),_matrix_values->getNbOfElems());
+}
+
+/*!
+ * Reads the matrix of \a is computed on the supports \a src and \a target. \a this is left unchanged if \a is is rejected : \a src,
+ * \a target, the options and the matrix are set only once the whole file has been checked.
+ */
+void MEDCouplingRemapper::readMatrix(std::istream& is, const std::string& fileName, const MEDCouplingFieldTemplate *src, const MEDCouplingFieldTemplate *target)
+{
+  if(!src || !target)
+    throw INTERP_KERNEL::Exception("MEDCouplingRemapper::loadMatrix : presence of NULL input pointer !");
+  if(!src->getMesh() || !target->getMesh())
+    throw INTERP_KERNEL::Exception("MEDCouplingRemapper::loadMatrix : presence of NULL mesh pointer in given field template !");
+  std::string method(ReadMethodOfMatrix(is,fileName)),srcMeth(src->getDiscretization()->getRepr()),trgMeth(target->getDiscretization()->getRepr());
+  if(method!=BuildMethodFrom(srcMeth,trgMeth))
+    {
+      std::ostringstream oss; oss << "MEDCouplingRemapper::loadMatrix : file \"" << fileName << "\" contains a matrix for method \"" << method << "\" whereas given supports are for method \"" << BuildMethodFrom(srcMeth,trgMeth) << "\" !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  // options
+  std::int32_t printLevel(ReadBinary<std::int32_t>(is,fileName)),intersectionType(ReadBinary<std::int32_t>(is,fileName));
+  double precision(ReadBinary<double>(is,fileName)),medianPlane(ReadBinary<double>(is,fileName));
+  std::int32_t doRotate(ReadBinary<std::int32_t>(is,fileName));
+  double bbAdj(ReadBinary<double>(is,fileName)),bbAdjAbs(ReadBinary<double>(is,fileName));
+  double maxDist3DSurf(ReadBinary<double>(is,fileName)),minDot3DSurf(ReadBinary<double>(is,fileName));
+  std::int32_t orientation(ReadBinary<std::int32_t>(is,fileName)),measureAbs(ReadBinary<std::int32_t>(is,fileName));
+  std::int32_t splittingPolicy(ReadBinary<std::int32_t>(is,fileName)),nbThreads(ReadBinary<std::int32_t>(is,fileName));
+  std::int32_t matrixPolicy(ReadBinary<std::int32_t>(is,fileName));
+  // supports
+  std::uint64_t srcFingerPrint(ReadBinary<std::uint64_t>(is,fileName)),trgFingerPrint(ReadBinary<std::uint64_t>(is,fileName));
+  if(srcFingerPrint!=ComputeFingerPrint(src) || trgFingerPrint!=ComputeFingerPrint(target))
+    {
+      std::ostringstream oss; oss << "MEDCouplingRemapper::loadMatrix : the matrix in file \"" << fileName << "\" has been computed on " << (srcFingerPrint!=ComputeFingerPrint(src)?"a source":"a target");
+      oss << " support different from the given one !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  // matrix
+  mcIdType nbOfRows(ReadBinary<mcIdType>(is,fileName)),nbOfCols(ReadBinary<mcIdType>(is,fileName)),nbOfCoeffs(ReadBinary<mcIdType>(is,fileName));
+  std::uint64_t remaining(RemainingSize(is));
+  if(nbOfRows!=target->getNumberOfTuplesExpected() || nbOfCols!=src->getNumberOfTuplesExpected() || nbOfCoeffs<0 || matrixPolicy<0 || matrixPolicy>3
+     || (std::uint64_t)nbOfRows+1>remaining/sizeof(mcIdType) || (std::uint64_t)nbOfCoeffs>remaining/(sizeof(mcIdType)+sizeof(double)))
+    {
+      std::ostringstream oss; oss << "MEDCouplingRemapper::loadMatrix : file \"" << fileName << "\" is corrupted !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  MCAuto<DataArrayIdType> matrixIndex(DataArrayIdType::New()),matrixColIds(DataArrayIdType::New());
+  MCAuto<DataArrayDouble> matrixValues(DataArrayDouble::New());
+  matrixIndex->alloc(nbOfRows+1,1); matrixColIds->alloc(nbOfCoeffs,1); matrixValues->alloc(nbOfCoeffs,1);
+  ReadBinary(is,matrixIndex->getPointer(),nbOfRows+1,fileName);
+  ReadBinary(is,matrixColIds->getPointer(),nbOfCoeffs,fileName);
+  ReadBinary(is,matrixValues->getPointer(),nbOfCoeffs,fileName);
+  const mcIdType *indexPtr(matrixIndex->begin());
+  bool isOK(indexPtr[0]==0 && indexPtr[nbOfRows]==nbOfCoeffs);
+  for(mcIdType i=0;i<nbOfRows && isOK;i++)
+    isOK=indexPtr[i]<=indexPtr[i+1];
+  for(const mcIdType *pt=matrixColIds->begin();pt!=matrixColIds->end() && isOK;pt++)
+    isOK=*pt>=0 && *pt<nbOfCols;
+  if(!isOK)
+    {
+      std::ostringstream oss; oss << "MEDCouplingRemapper::loadMatrix : file \"" << fileName << "\" is corrupted !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  restartUsing(src,target);
+  setPrintLevel(printLevel);
+  setIntersectionType((INTERP_KERNEL::IntersectionType)intersectionType);
+  setPrecision(precision);
+  setMedianPlane(medianPlane);
+  setDoRotate(doRotate!=0);
+  setBoundingBoxAdjustment(bbAdj);
+  setBoundingBoxAdjustmentAbs(bbAdjAbs);
+  setMaxDistance3DSurfIntersect(maxDist3DSurf);
+  setMinDotBtwPlane3DSurfIntersect(minDot3DSurf);
+  setOrientation(orientation);
+  setMeasureAbsStatus(measureAbs!=0);
+  setSplittingPolicy((INTERP_KERNEL::SplittingPolicy)splittingPolicy);
+  setNbThreads(nbThreads);
+  setInterpolationMatrixPolicy(matrixPolicy);
+  _matrix_index=matrixIndex; _matrix_col_ids=matrixColIds; _matrix_values=matrixValues;
+  _nb_of_cols=nbOfCols;
   declareAsNew();
 }
 
+/*!
+ * Returns a hash of the spatial discretization and of the mesh of \a ft, used to check that a saved matrix is reloaded on the same supports.
+ */
+std::uint64_t MEDCouplingRemapper::ComputeFingerPrint(const MEDCouplingFieldTemplate *ft)
+{
+  std::uint64_t ret(14695981039346656037ULL);
+  std::string repr(ft->getDiscretization()->getStringRepr());
+  ret=HashBytes(repr.c_str(),repr.size(),ret);
+  mcIdType nbOfTuples(ft->getNumberOfTuplesExpected());
+  ret=HashBytes(&nbOfTuples,sizeof(mcIdType),ret);
+  const MEDCouplingMesh *mesh(ft->getMesh());
+  std::int32_t meshType((std::int32_t)mesh->getType());
+  ret=HashBytes(&meshType,sizeof(std::int32_t),ret);
+  DataArrayIdType *a1(0);
+  DataArrayDouble *a2(0);
+  mesh->serialize(a1,a2);
+  MCAuto<DataArrayIdType> a1Safe(a1);
+  MCAuto<DataArrayDouble> a2Safe(a2);
+  if(a1 && a1->isAllocated())
+    ret=HashBytes(a1->begin(),sizeof(mcIdType)*a1->getNbOfElems(),ret);
+  if(a2 && a2->isAllocated())
+    ret=HashBytes(a2->begin(),sizeof(double)*a2->getNbOfElems(),ret);
+  return ret;
+}
+
 /*!
  * This method builds a code considering already set field discretization int \a this : \a _src_ft and \a _target_ft.
  * This method returns 3 information (2 in output parameters and 1 in return).
@@ -1097,8 +1730,15 @@ void MEDCouplingRemapper::releaseData(bool matrixSuppression)
   if(matrixSuppression)
     {
       _matrix.clear();
-      _deno_multiply.clear();
-      _deno_reverse_multiply.clear();
+      _matrix_index.nullify();
+      _matrix_col_ids.nullify();
+      _matrix_values.nullify();
+      _nb_of_cols=0;
+      _deno_multiply.nullify();
+      _deno_reverse_multiply.nullify();
+      _target_coords_ref.nullify();
+      _target_conn_ref.nullify();
+      _target_conn_index_ref.nullify();
     }
 }
 
@@ -1114,6 +1754,19 @@ void MEDCouplingRemapper::restartUsing(const MEDCouplingFieldTemplate *src, cons
 }
 
 void MEDCouplingRemapper::transferUnderground(const MEDCouplingFieldDouble *srcField, MEDCouplingFieldDouble *targetField, bool isDftVal, double dftValue)
+{
+  checkTransferAndAllocTarget(srcField,targetField,isDftVal);
+  computeDeno(srcField->getNature(),srcField,targetField);
+  double *resPointer(targetField->getArray()->getPointer());
+  const double *inputPointer(srcField->getArray()->getConstPointer());
+  computeProduct(std::vector<const double *>(1,inputPointer),std::vector<int>(1,(int)srcField->getNumberOfComponents()),isDftVal,dftValue,std::vector<double *>(1,resPointer));
+}
+
+/*!
+ * Checks that \a srcField and \a targetField are compatible with the prepared matrix. If the array of \a targetField is not allocated, it is
+ * allocated here (only allowed if \a isDftVal is true).
+ */
+void MEDCouplingRemapper::checkTransferAndAllocTarget(const MEDCouplingFieldDouble *srcField, MEDCouplingFieldDouble *targetField, bool isDftVal) const
 {
   if(!srcField || !targetField)
     throw INTERP_KERNEL::Exception("MEDCouplingRemapper::transferUnderground : srcField or targetField is NULL !");
@@ -1148,10 +1801,6 @@ void MEDCouplingRemapper::transferUnderground(const MEDCouplingFieldDouble *srcF
       tmp->alloc(targetField->getNumberOfTuples(),srcNbOfCompo);
       targetField->setArray(tmp);
     }
-  computeDeno(srcField->getNature(),srcField,targetField);
-  double *resPointer(targetField->getArray()->getPointer());
-  const double *inputPointer(srcField->getArray()->getConstPointer());
-  computeProduct(inputPointer,(int)srcNbOfCompo,isDftVal,dftValue,resPointer);
 }
 
 void MEDCouplingRemapper::computeDeno(NatureOfField nat, const MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *trgField)
@@ -1167,11 +1816,15 @@ void MEDCouplingRemapper::computeDeno(NatureOfField nat, const MEDCouplingFieldD
 void MEDCouplingRemapper::computeDenoFromScratch(NatureOfField nat, const MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *trgField)
 {
   _nature_of_deno=nat;
+  mcIdType nbOfRows(getNumberOfRowsOfMatrix()),nbOfCoeffs(_matrix_values->getNumberOfTuples());
+  const mcIdType *indexPtr(_matrix_index->begin()),*colIdsPtr(_matrix_col_ids->begin());
+  _deno_multiply=DataArrayDouble::New(); _deno_multiply->alloc(nbOfCoeffs,1);
+  _deno_reverse_multiply=DataArrayDouble::New(); _deno_reverse_multiply->alloc(nbOfCoeffs,1);
   switch(_nature_of_deno)
   {
     case IntensiveMaximum:
       {
-        ComputeRowSumAndColSum(_matrix,_deno_multiply,_deno_reverse_multiply);
+        ComputeRowSumAndColSum(_matrix_index,_matrix_col_ids,_matrix_values,_nb_of_cols,_deno_multiply,_deno_reverse_multiply);
         break;
       }
     case ExtensiveMaximum:
@@ -1190,12 +1843,12 @@ void MEDCouplingRemapper::computeDenoFromScratch(NatureOfField nat, const MEDCou
             double *denoPtr2=deno->getArray()->getPointer();
             denoPtr2[0]=std::accumulate(denoRPtr,denoRPtr+denoR->getNumberOfTuples(),0.);
           }
-        int idx=0;
-        for(std::vector<std::map<mcIdType,double> >::const_iterator iter1=_matrix.begin();iter1!=_matrix.end();iter1++,idx++)
-          for(std::map<mcIdType,double>::const_iterator iter2=(*iter1).begin();iter2!=(*iter1).end();iter2++)
+        double *denoMultPtr(_deno_multiply->getPointer()),*denoRevMultPtr(_deno_reverse_multiply->getPointer());
+        for(mcIdType idx=0;idx<nbOfRows;idx++)
+          for(mcIdType k=indexPtr[idx];k<indexPtr[idx+1];k++)
             {
-              _deno_multiply[idx][(*iter2).first]=denoPtr[(*iter2).first];
-              _deno_reverse_multiply[(*iter2).first][idx]=denoRPtr[idx];
+              denoMultPtr[k]=denoPtr[colIdsPtr[k]];
+              denoRevMultPtr[k]=denoRPtr[idx];
             }
         deno->decrRef();
         denoR->decrRef();
@@ -1203,7 +1856,7 @@ void MEDCouplingRemapper::computeDenoFromScratch(NatureOfField nat, const MEDCou
       }
     case ExtensiveConservation:
       {
-        ComputeColSumAndRowSum(_matrix,_deno_multiply,_deno_reverse_multiply);
+        ComputeRowSumAndColSum(_matrix_index,_matrix_col_ids,_matrix_values,_nb_of_cols,_deno_reverse_multiply,_deno_multiply);
         break;
       }
     case IntensiveConservation:
@@ -1222,12 +1875,12 @@ void MEDCouplingRemapper::computeDenoFromScratch(NatureOfField nat, const MEDCou
             double *denoPtr2=deno->getArray()->getPointer();
             denoPtr2[0]=std::accumulate(denoRPtr,denoRPtr+denoR->getNumberOfTuples(),0.);
           }
-        mcIdType idx=0;
-        for(std::vector<std::map<mcIdType,double> >::const_iterator iter1=_matrix.begin();iter1!=_matrix.end();iter1++,idx++)
-          for(std::map<mcIdType,double>::const_iterator iter2=(*iter1).begin();iter2!=(*iter1).end();iter2++)
+        double *denoMultPtr(_deno_multiply->getPointer()),*denoRevMultPtr(_deno_reverse_multiply->getPointer());
+        for(mcIdType idx=0;idx<nbOfRows;idx++)
+          for(mcIdType k=indexPtr[idx];k<indexPtr[idx+1];k++)
             {
-              _deno_multiply[idx][(*iter2).first]=denoPtr[idx];
-              _deno_reverse_multiply[(*iter2).first][idx]=denoRPtr[(*iter2).first];
+              denoMultPtr[k]=denoPtr[idx];
+              denoRevMultPtr[k]=denoRPtr[colIdsPtr[k]];
             }
         deno->decrRef();
         denoR->decrRef();
@@ -1236,49 +1889,65 @@ void MEDCouplingRemapper::computeDenoFromScratch(NatureOfField nat, const MEDCou
     case NoNature:
       throw INTERP_KERNEL::Exception("No nature specified ! Select one !");
   }
+  // the denominators made of the measures of the meshes are recomputed at each transfer, as the meshes may have been modified in place
+  if(nat==IntensiveMaximum || nat==ExtensiveConservation)
+    _time_deno_update=getTimeOfThis();
+  else
+    _time_deno_update=std::numeric_limits<std::size_t>::max();
 }
 
-void MEDCouplingRemapper::computeProduct(const double *inputPointer, int inputNbOfCompo, bool isDftVal, double dftValue, double *resPointer)
+/*!
+ * Applies the matrix to all the input arrays at once : the coefficients are walked only once and each of them is applied to all the arrays.
+ * For each array, the operations are done in the same order than for a single array, so that results do not depend on the number of arrays.
+ */
+void MEDCouplingRemapper::computeProduct(const std::vector<const double *>& inputPointers, const std::vector<int>& inputNbOfCompos, bool isDftVal, double dftValue, const std::vector<double *>& resPointers)
 {
-  int idx=0;
-  double *tmp=new double[inputNbOfCompo];
-  for(std::vector<std::map<mcIdType,double> >::const_iterator iter1=_matrix.begin();iter1!=_matrix.end();iter1++,idx++)
+  std::size_t nbOfArrays(inputPointers.size());
+  mcIdType nbOfRows(getNumberOfRowsOfMatrix());
+  const mcIdType *indexPtr(_matrix_index->begin()),*colIdsPtr(_matrix_col_ids->begin());
+  const double *valuesPtr(_matrix_values->begin()),*denoPtr(_deno_multiply->begin());
+  for(mcIdType idx=0;idx<nbOfRows;idx++)
     {
-      if((*iter1).empty())
+      bool isEmptyRow(indexPtr[idx]==indexPtr[idx+1]);
+      if(isEmptyRow && !isDftVal)
+        continue;
+      for(std::size_t i=0;i<nbOfArrays;i++)
+        std::fill(resPointers[i]+idx*inputNbOfCompos[i],resPointers[i]+(idx+1)*inputNbOfCompos[i],isEmptyRow?dftValue:0.);
+      for(mcIdType k=indexPtr[idx];k<indexPtr[idx+1];k++)
         {
-          if(isDftVal)
-            std::fill(resPointer+idx*inputNbOfCompo,resPointer+(idx+1)*inputNbOfCompo,dftValue);
-          continue;
-        }
-      else
-        std::fill(resPointer+idx*inputNbOfCompo,resPointer+(idx+1)*inputNbOfCompo,0.);
-      std::map<mcIdType,double>::const_iterator iter3=_deno_multiply[idx].begin();
-      for(std::map<mcIdType,double>::const_iterator iter2=(*iter1).begin();iter2!=(*iter1).end();iter2++,iter3++)
-        {
-          std::transform(inputPointer+(*iter2).first*inputNbOfCompo,inputPointer+((*iter2).first+1)*inputNbOfCompo,tmp,std::bind(std::multiplies<double>(),std::placeholders::_1,(*iter2).second/(*iter3).second));
-          std::transform(tmp,tmp+inputNbOfCompo,resPointer+idx*inputNbOfCompo,resPointer+idx*inputNbOfCompo,std::plus<double>());
+          double coeff(valuesPtr[k]/denoPtr[k]);
+          for(std::size_t i=0;i<nbOfArrays;i++)
+            {
+              int nbOfCompo(inputNbOfCompos[i]);
+              const double *inputRow(inputPointers[i]+colIdsPtr[k]*nbOfCompo);
+              double *resRow(resPointers[i]+idx*nbOfCompo);
+              for(int j=0;j<nbOfCompo;j++)
+                resRow[j]+=inputRow[j]*coeff;
+            }
         }
     }
-  delete [] tmp;
 }
 
 void MEDCouplingRemapper::computeReverseProduct(const double *inputPointer, int inputNbOfCompo, double dftValue, double *resPointer)
 {
-  std::vector<bool> isReached(_deno_reverse_multiply.size(),false);
-  mcIdType idx=0;
-  double *tmp=new double[inputNbOfCompo];
-  std::fill(resPointer,resPointer+inputNbOfCompo*_deno_reverse_multiply.size(),0.);
-  for(std::vector<std::map<mcIdType,double> >::const_iterator iter1=_matrix.begin();iter1!=_matrix.end();iter1++,idx++)
+  std::vector<bool> isReached(_nb_of_cols,false);
+  mcIdType nbOfRows(getNumberOfRowsOfMatrix());
+  const mcIdType *indexPtr(_matrix_index->begin()),*colIdsPtr(_matrix_col_ids->begin());
+  const double *valuesPtr(_matrix_values->begin()),*denoPtr(_deno_reverse_multiply->begin());
+  std::fill(resPointer,resPointer+inputNbOfCompo*_nb_of_cols,0.);
+  for(mcIdType idx=0;idx<nbOfRows;idx++)
     {
-      for(std::map<mcIdType,double>::const_iterator iter2=(*iter1).begin();iter2!=(*iter1).end();iter2++)
+      const double *inputRow(inputPointer+idx*inputNbOfCompo);
+      for(mcIdType k=indexPtr[idx];k<indexPtr[idx+1];k++)
         {
-          isReached[(*iter2).first]=true;
-          std::transform(inputPointer+idx*inputNbOfCompo,inputPointer+(idx+1)*inputNbOfCompo,tmp,std::bind(std::multiplies<double>(),std::placeholders::_1,(*iter2).second/_deno_reverse_multiply[(*iter2).first][idx]));
-          std::transform(tmp,tmp+inputNbOfCompo,resPointer+((*iter2).first)*inputNbOfCompo,resPointer+((*iter2).first)*inputNbOfCompo,std::plus<double>());
+          isReached[colIdsPtr[k]]=true;
+          double coeff(valuesPtr[k]/denoPtr[k]);
+          double *resRow(resPointer+colIdsPtr[k]*inputNbOfCompo);
+          for(int j=0;j<inputNbOfCompo;j++)
+            resRow[j]+=inputRow[j]*coeff;
         }
     }
-  delete [] tmp;
-  idx=0;
+  mcIdType idx=0;
   for(std::vector<bool>::const_iterator iter3=isReached.begin();iter3!=isReached.end();iter3++,idx++)
     if(!*iter3)
       std::fill(resPointer+idx*inputNbOfCompo,resPointer+(idx+1)*inputNbOfCompo,dftValue);
@@ -1293,52 +1962,31 @@ void MEDCouplingRemapper::ReverseMatrix(const std::vector<std::map<mcIdType,doub
       matOut[(*iter2).first][id]=(*iter2).second;
 }
 
-void MEDCouplingRemapper::ComputeRowSumAndColSum(const std::vector<std::map<mcIdType,double> >& matrixDeno,
-                                                 std::vector<std::map<mcIdType,double> >& deno, std::vector<std::map<mcIdType,double> >& denoReverse)
+/*!
+ * Computes, for each coefficient (i,j) of the CSR matrix, the sum of the row i in \a rowSum and the sum of the column j in \a colSum.
+ * \a rowSum and \a colSum are expected to be allocated with one tuple per coefficient.
+ */
+void MEDCouplingRemapper::ComputeRowSumAndColSum(const DataArrayIdType *matrixIndex, const DataArrayIdType *matrixColIds, const DataArrayDouble *matrixValues, mcIdType nbOfCols,
+                                                 DataArrayDouble *rowSum, DataArrayDouble *colSum)
 {
-  std::map<mcIdType,double> values;
-  mcIdType idx=0;
-  for(std::vector<std::map<mcIdType,double> >::const_iterator iter1=matrixDeno.begin();iter1!=matrixDeno.end();iter1++,idx++)
+  mcIdType nbOfRows(matrixIndex->getNumberOfTuples()-1);
+  const mcIdType *indexPtr(matrixIndex->begin()),*colIdsPtr(matrixColIds->begin());
+  const double *valuesPtr(matrixValues->begin());
+  double *rowSumPtr(rowSum->getPointer()),*colSumPtr(colSum->getPointer());
+  std::vector<double> values(nbOfCols,0.);
+  for(mcIdType idx=0;idx<nbOfRows;idx++)
     {
       double sum=0.;
-      for(std::map<mcIdType,double>::const_iterator iter2=(*iter1).begin();iter2!=(*iter1).end();iter2++)
+      for(mcIdType k=indexPtr[idx];k<indexPtr[idx+1];k++)
         {
-          sum+=(*iter2).second;
-          values[(*iter2).first]+=(*iter2).second;
+          sum+=valuesPtr[k];
+          values[colIdsPtr[k]]+=valuesPtr[k];
         }
-      for(std::map<mcIdType,double>::const_iterator iter2=(*iter1).begin();iter2!=(*iter1).end();iter2++)
-        deno[idx][(*iter2).first]=sum;
-    }
-  idx=0;
-  for(std::vector<std::map<mcIdType,double> >::const_iterator iter1=matrixDeno.begin();iter1!=matrixDeno.end();iter1++,idx++)
-    {
-      for(std::map<mcIdType,double>::const_iterator iter2=(*iter1).begin();iter2!=(*iter1).end();iter2++)
-        denoReverse[(*iter2).first][idx]=values[(*iter2).first];
-    }
-}
-
-void MEDCouplingRemapper::ComputeColSumAndRowSum(const std::vector<std::map<mcIdType,double> >& matrixDeno,
-                                                 std::vector<std::map<mcIdType,double> >& deno, std::vector<std::map<mcIdType,double> >& denoReverse)
-{
-  std::map<mcIdType,double> values;
-  mcIdType idx=0;
-  for(std::vector<std::map<mcIdType,double> >::const_iterator iter1=matrixDeno.begin();iter1!=matrixDeno.end();iter1++,idx++)
-    {
-      double sum=0.;
-      for(std::map<mcIdType,double>::const_iterator iter2=(*iter1).begin();iter2!=(*iter1).end();iter2++)
-        {
-          sum+=(*iter2).second;
-          values[(*iter2).first]+=(*iter2).second;
-        }
-      for(std::map<mcIdType,double>::const_iterator iter2=(*iter1).begin();iter2!=(*iter1).end();iter2++)
-        denoReverse[(*iter2).first][idx]=sum;
-    }
-  idx=0;
-  for(std::vector<std::map<mcIdType,double> >::const_iterator iter1=matrixDeno.begin();iter1!=matrixDeno.end();iter1++,idx++)
-    {
-      for(std::map<mcIdType,double>::const_iterator iter2=(*iter1).begin();iter2!=(*iter1).end();iter2++)
-        deno[idx][(*iter2).first]=values[(*iter2).first];
+      std::fill(rowSumPtr+indexPtr[idx],rowSumPtr+indexPtr[idx+1],sum);
     }
+  mcIdType nbOfCoeffs(matrixColIds->getNumberOfTuples());
+  for(mcIdType k=0;k<nbOfCoeffs;k++)
+    colSumPtr[k]=values[colIdsPtr[k]];
 }
 
 void MEDCouplingRemapper::buildFinalInterpolationMatrixByConvolution(const std::vector< std::map<mcIdType,double> >& m1D,
@@ -1379,8 +2027,22 @@ void MEDCouplingRemapper::PrintMatrix(const std::vector<std::map<mcIdType,double
     }
 }
 
+/*!
+ * Returns the crude matrix (without denominators) in map format, one map per row. The transfers work on a compressed sparse row
+ * format of this matrix, so the map format is built on demand at the first call and kept until the next computation of the matrix.
+ */
 const std::vector<std::map<mcIdType,double> >& MEDCouplingRemapper::getCrudeMatrix() const
 {
+  mcIdType nbOfRows(getNumberOfRowsOfMatrix());
+  if(ToIdType(_matrix.size())!=nbOfRows)
+    {
+      const mcIdType *indexPtr(_matrix_index->begin()),*colIdsPtr(_matrix_col_ids->begin());
+      const double *valuesPtr(_matrix_values->begin());
+      _matrix.resize(nbOfRows);
+      for(mcIdType idx=0;idx<nbOfRows;idx++)
+        for(mcIdType k=indexPtr[idx];k<indexPtr[idx+1];k++)
+          _matrix[idx].insert(_matrix[idx].end(),std::pair<mcIdType,double>(colIdsPtr[k],valuesPtr[k]));
+    }
   return _matrix;
 }
 
@@ -1389,7 +2051,7 @@ const std::vector<std::map<mcIdType,double> >& MEDCouplingRemapper::getCrudeMatr
  */
 mcIdType MEDCouplingRemapper::getNumberOfColsOfMatrix() const
 {
-  return ToIdType(_deno_reverse_multiply.size());
+  return _nb_of_cols;
 }
 
 /*!
@@ -1407,21 +2069,37 @@ mcIdType MEDCouplingRemapper::getNumberOfColsOfMatrix() const
 int MEDCouplingRemapper::nullifiedTinyCoeffInCrudeMatrixAbs(double maxValAbs)
 {
   int ret=0;
-  std::vector<std::map<mcIdType,double> > matrixNew(_matrix.size());
-  mcIdType i=0;
-  for(std::vector<std::map<mcIdType,double> >::const_iterator it1=_matrix.begin();it1!=_matrix.end();it1++,i++)
+  mcIdType nbOfRows(getNumberOfRowsOfMatrix());
+  if(nbOfRows==0)
+    return ret;
+  mcIdType *indexPtr(_matrix_index->getPointer()),*colIdsPtr(_matrix_col_ids->getPointer());
+  double *valuesPtr(_matrix_values->getPointer());
+  mcIdType newK(0);
+  for(mcIdType idx=0;idx<nbOfRows;idx++)
     {
-      std::map<mcIdType,double>& rowNew=matrixNew[i];
-      for(std::map<mcIdType,double>::const_iterator it2=(*it1).begin();it2!=(*it1).end();it2++)
+      mcIdType start(indexPtr[idx]),stop(indexPtr[idx+1]);
+      indexPtr[idx]=newK;
+      for(mcIdType k=start;k<stop;k++)
         {
-          if(fabs((*it2).second)>maxValAbs)
-            rowNew[(*it2).first]=(*it2).second;
+          if(fabs(valuesPtr[k])>maxValAbs)
+            {
+              colIdsPtr[newK]=colIdsPtr[k];
+              valuesPtr[newK++]=valuesPtr[k];
+            }
           else
             ret++;
         }
     }
+  indexPtr[nbOfRows]=newK;
   if(ret>0)
-    _matrix=matrixNew;
+    {
+      _matrix_col_ids->reAlloc(newK);
+      _matrix_values->reAlloc(newK);
+      _matrix.clear();
+      _deno_multiply.nullify();
+      _deno_reverse_multiply.nullify();
+      declareAsNew();
+    }
   return ret;
 }
 
@@ -1456,9 +2134,10 @@ int MEDCouplingRemapper::nullifiedTinyCoeffInCrudeMatrix(double scaleFactor)
 double MEDCouplingRemapper::getMaxValueInCrudeMatrix() const
 {
   double ret=0.;
-  for(std::vector<std::map<mcIdType,double> >::const_iterator it1=_matrix.begin();it1!=_matrix.end();it1++)
-    for(std::map<mcIdType,double>::const_iterator it2=(*it1).begin();it2!=(*it1).end();it2++)
-      if(fabs((*it2).second)>ret)
-        ret=fabs((*it2).second);
+  if(_matrix_values.isNull())
+    return ret;
+  for(const double *it=_matrix_values->begin();it!=_matrix_values->end();it++)
+    if(fabs(*it)>ret)
+      ret=fabs(*it);
   return ret;
 }
@@ -27,17 +27,22 @@
 #include "MEDCouplingNatureOfField.hxx"
 #include "MCType.hxx"
 #include "MCAuto.hxx"
+#include "MEDCouplingMemArray.hxx"
 
 #include "InterpKernelException.hxx"
 
 #include <map>
 #include <vector>
+#include <iosfwd>
+#include <cstdint>
 
 namespace MEDCoupling
 {
   class MEDCouplingMesh;
+  class MEDCouplingUMesh;
   class MEDCouplingFieldDouble;
   class MEDCouplingFieldTemplate;
+  class MEDCouplingMultiFields;
 }
 
 namespace MEDCoupling
@@ -57,13 +62,20 @@ namespace MEDCoupling
     MEDCOUPLINGREMAPPER_EXPORT ~MEDCouplingRemapper();
     MEDCOUPLINGREMAPPER_EXPORT int prepare(const MEDCouplingMesh *srcMesh, const MEDCouplingMesh *targetMesh, const std::string& method);
     MEDCOUPLINGREMAPPER_EXPORT int prepareEx(const MEDCouplingFieldTemplate *src, const MEDCouplingFieldTemplate *target);
+    MEDCOUPLINGREMAPPER_EXPORT mcIdType prepareIncremental(const MEDCouplingMesh *srcMesh, const MEDCouplingMesh *targetMesh, const std::string& method, double eps);
     MEDCOUPLINGREMAPPER_EXPORT void setCrudeMatrix(const MEDCouplingMesh *srcMesh, const MEDCouplingMesh *targetMesh, const std::string& method, const std::vector<std::map<mcIdType,double> >& m);
     MEDCOUPLINGREMAPPER_EXPORT void setCrudeMatrixEx(const MEDCouplingFieldTemplate *src, const MEDCouplingFieldTemplate *target, const std::vector<std::map<mcIdType,double> >& m);
+    MEDCOUPLINGREMAPPER_EXPORT void saveMatrix(const std::string& fileName) const;
+    MEDCOUPLINGREMAPPER_EXPORT void loadMatrix(const MEDCouplingMesh *srcMesh, const MEDCouplingMesh *targetMesh, const std::string& fileName);
+    MEDCOUPLINGREMAPPER_EXPORT void loadMatrixEx(const MEDCouplingFieldTemplate *src, const MEDCouplingFieldTemplate *target, const std::string& fileName);
     MEDCOUPLINGREMAPPER_EXPORT void transfer(const MEDCouplingFieldDouble *srcField, MEDCouplingFieldDouble *targetField, double dftValue);
     MEDCOUPLINGREMAPPER_EXPORT void partialTransfer(const MEDCouplingFieldDouble *srcField, MEDCouplingFieldDouble *targetField);
     MEDCOUPLINGREMAPPER_EXPORT void reverseTransfer(MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *targetField, double dftValue);
     MEDCOUPLINGREMAPPER_EXPORT MEDCouplingFieldDouble *transferField(const MEDCouplingFieldDouble *srcField, double dftValue);
     MEDCOUPLINGREMAPPER_EXPORT MEDCouplingFieldDouble *reverseTransferField(const MEDCouplingFieldDouble *targetField, double dftValue);
+    MEDCOUPLINGREMAPPER_EXPORT void transferMulti(const std::vector<const MEDCouplingFieldDouble *>& srcFields, const std::vector<MEDCouplingFieldDouble *>& targetFields, double dftValue);
+    MEDCOUPLINGREMAPPER_EXPORT std::vector<MEDCouplingFieldDouble *> transferFields(const std::vector<const MEDCouplingFieldDouble *>& srcFields, double dftValue);
+    MEDCOUPLINGREMAPPER_EXPORT std::vector<MEDCouplingFieldDouble *> transferFields(const MEDCouplingMultiFields *srcFields, double dftValue);
     MEDCOUPLINGREMAPPER_EXPORT bool setOptionInt(const std::string& key, int value);
     MEDCOUPLINGREMAPPER_EXPORT bool setOptionDouble(const std::string& key, double value);
     MEDCOUPLINGREMAPPER_EXPORT bool setOptionString(const std::string& key, const std::string& value);
@@ -97,13 +109,21 @@ namespace MEDCoupling
     void updateTime() const;
     void checkPrepare() const;
     void synchronizeSizeOfSideMatricesAfterMatrixComputation(mcIdType nbOfColsInMatrix);
+    mcIdType getNumberOfRowsOfMatrix() const;
+    bool isIncrementalPrepareAllowed(const MEDCouplingMesh *srcMesh, const MEDCouplingUMesh *targetMesh, const std::string& method) const;
+    void keepTrackOfSupportsForIncrementalPrepare();
+    void writeMatrix(std::ostream& os) const;
+    void readMatrix(std::istream& is, const std::string& fileName, const MEDCouplingFieldTemplate *src, const MEDCouplingFieldTemplate *target);
+    static std::string ReadMethodOfMatrix(std::istream& is, const std::string& fileName);
+    static std::uint64_t ComputeFingerPrint(const MEDCouplingFieldTemplate *ft);
     std::string checkAndGiveInterpolationMethodStr(std::string& srcMeth, std::string& trgMeth) const;
     void releaseData(bool matrixSuppression);
     void restartUsing(const MEDCouplingFieldTemplate *src, const MEDCouplingFieldTemplate *target);
     void transferUnderground(const MEDCouplingFieldDouble *srcField, MEDCouplingFieldDouble *targetField, bool isDftVal, double dftValue);
+    void checkTransferAndAllocTarget(const MEDCouplingFieldDouble *srcField, MEDCouplingFieldDouble *targetField, bool isDftVal) const;
     void computeDeno(NatureOfField nat, const MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *trgField);
     void computeDenoFromScratch(NatureOfField nat, const MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *trgField);
-    void computeProduct(const double *inputPointer, int inputNbOfCompo, bool isDftVal, double dftValue, double *resPointer);
+    void computeProduct(const std::vector<const double *>& inputPointers, const std::vector<int>& inputNbOfCompos, bool isDftVal, double dftValue, const std::vector<double *>& resPointers);
     void computeReverseProduct(const double *inputPointer, int inputNbOfCompo, double dftValue, double *resPointer);
     void buildFinalInterpolationMatrixByConvolution(const std::vector< std::map<mcIdType,double> >& m1D,
                                                     const std::vector< std::map<mcIdType,double> >& m2D,
@@ -111,19 +131,30 @@ namespace MEDCoupling
                                                     const mcIdType *corrCellIdTrg);
     static void ReverseMatrix(const std::vector<std::map<mcIdType,double> >& matIn, mcIdType nbColsMatIn,
                               std::vector<std::map<mcIdType,double> >& matOut);
-    static void ComputeRowSumAndColSum(const std::vector<std::map<mcIdType,double> >& matrixDeno,
-                                       std::vector<std::map<mcIdType,double> >& deno, std::vector<std::map<mcIdType,double> >& denoReverse);
-    static void ComputeColSumAndRowSum(const std::vector<std::map<mcIdType,double> >& matrixDeno,
-                                       std::vector<std::map<mcIdType,double> >& deno, std::vector<std::map<mcIdType,double> >& denoReverse);
+    static void ComputeRowSumAndColSum(const DataArrayIdType *matrixIndex, const DataArrayIdType *matrixColIds, const DataArrayDouble *matrixValues, mcIdType nbOfCols,
+                                       DataArrayDouble *rowSum, DataArrayDouble *colSum);
   private:
     MCAuto<MEDCouplingFieldTemplate> _src_ft;
     MCAuto<MEDCouplingFieldTemplate> _target_ft;
     InterpolationMatrixPolicy _interp_matrix_pol;
     NatureOfField _nature_of_deno;
-    unsigned int _time_deno_update;
-    std::vector<std::map<mcIdType,double> > _matrix;
-    std::vector<std::map<mcIdType,double> > _deno_multiply;
-    std::vector<std::map<mcIdType,double> > _deno_reverse_multiply;
+    std::size_t _time_deno_update;
+    //! crude matrix in map format : filled by the prepare methods, then kept only as a cache for getCrudeMatrix
+    mutable std::vector<std::map<mcIdType,double> > _matrix;
+    //! crude matrix in compressed sparse row format, column ids sorted in each row : used for the transfers
+    MCAuto<DataArrayIdType> _matrix_index;
+    MCAuto<DataArrayIdType> _matrix_col_ids;
+    MCAuto<DataArrayDouble> _matrix_values;
+    mcIdType _nb_of_cols;
+    //! denominators of the coefficients of the CSR matrix, for transfer and for reverseTransfer
+    MCAuto<DataArrayDouble> _deno_multiply;
+    MCAuto<DataArrayDouble> _deno_reverse_multiply;
+    //! state of the supports for which the rows of the matrix have been computed, used by prepareIncremental
+    std::size_t _src_time_ref;
+    MCAuto<DataArrayDouble> _target_coords_ref;
+    MCAuto<DataArrayIdType> _target_conn_ref;
+    MCAuto<DataArrayIdType> _target_conn_index_ref;
+    std::size_t _target_conn_time_ref;
   };
 }
 
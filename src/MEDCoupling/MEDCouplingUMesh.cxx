@@ -29,6 +29,7 @@
 #include "PointLocatorAlgos.txx"
 #include "BBTree.txx"
 #include "BBTreeDst.txx"
+#include "BBTreeFlat.txx"
 #include "SplitterTetra.hxx"
 #include "DiameterCalculator.hxx"
 #include "DirectedBoundingBox.hxx"
@@ -42,6 +43,8 @@
 #include "InterpKernelGeo2DEdgeArcCircle.hxx"
 #include "InterpKernelGeo2DQuadraticPolygon.hxx"
 #include "OrientationInverter.hxx"
+#include "MEDCouplingParallelAlgorithms.txx"
+#include "InterpKernelThreads.hxx"
 #include "MEDCouplingUMesh_internal.hxx"
 
 #include <sstream>
@@ -128,6 +131,13 @@ void MEDCouplingUMesh::shallowCopyConnectivityFrom(const MEDCouplingPointSet *ot
 std::size_t MEDCouplingUMesh::getHeapMemorySizeWithoutChildren() const
 {
   std::size_t ret(MEDCouplingPointSet::getHeapMemorySizeWithoutChildren());
+  std::lock_guard<std::mutex> lock(_cell_locator_mutex);
+  if(_cell_locator)
+    ret+=_cell_locator->getHeapMemorySize();
+  if(_cell_locator_dst)
+    ret+=_cell_locator_dst->getHeapMemorySize();
+  if(_cell_locator_bb)
+    ret+=_cell_locator_bb->getHeapMemorySize();
   return ret;
 }
 
@@ -594,7 +604,7 @@ void MEDCouplingUMesh::checkFastEquivalWith(const MEDCouplingMesh *other, double
 
 /*!
  * Returns the reverse nodal connectivity. The reverse nodal connectivity enumerates
- * cells each node belongs to.
+ * cells each node belongs to. The computation uses MEDCouplingGetNumberOfThreads() threads.
  * \warning For speed reasons, this method does not check if node ids in the nodal
  *          connectivity correspond to the size of node coordinates array.
  * \param [in,out] revNodal - an array holding ids of cells sharing each node.
@@ -618,34 +628,7 @@ void MEDCouplingUMesh::checkFastEquivalWith(const MEDCouplingMesh *other, double
 void MEDCouplingUMesh::getReverseNodalConnectivity(DataArrayIdType *revNodal, DataArrayIdType *revNodalIndx) const
 {
   checkFullyDefined();
-  mcIdType nbOfNodes(getNumberOfNodes());
-  mcIdType *revNodalIndxPtr=(mcIdType *)malloc((nbOfNodes+1)*sizeof(mcIdType));
-  revNodalIndx->useArray(revNodalIndxPtr,true,DeallocType::C_DEALLOC,nbOfNodes+1,1);
-  std::fill(revNodalIndxPtr,revNodalIndxPtr+nbOfNodes+1,0);
-  const mcIdType *conn(_nodal_connec->begin()),*connIndex(_nodal_connec_index->begin());
-  mcIdType nbOfCells(getNumberOfCells()),nbOfEltsInRevNodal(0);
-  for(mcIdType eltId=0;eltId<nbOfCells;eltId++)
-    {
-      const mcIdType *strtNdlConnOfCurCell(conn+connIndex[eltId]+1),*endNdlConnOfCurCell(conn+connIndex[eltId+1]);
-      for(const mcIdType *iter=strtNdlConnOfCurCell;iter!=endNdlConnOfCurCell;iter++)
-        if(*iter>=0)//for polyhedrons
-          {
-            nbOfEltsInRevNodal++;
-            revNodalIndxPtr[(*iter)+1]++;
-          }
-    }
-  std::transform(revNodalIndxPtr+1,revNodalIndxPtr+nbOfNodes+1,revNodalIndxPtr,revNodalIndxPtr+1,std::plus<mcIdType>());
-  mcIdType *revNodalPtr=(mcIdType *)malloc(nbOfEltsInRevNodal*sizeof(mcIdType));
-  revNodal->useArray(revNodalPtr,true,DeallocType::C_DEALLOC,nbOfEltsInRevNodal,1);
-  std::fill(revNodalPtr,revNodalPtr+nbOfEltsInRevNodal,-1);
-  for(mcIdType eltId=0;eltId<nbOfCells;eltId++)
-    {
-      const mcIdType *strtNdlConnOfCurCell=conn+connIndex[eltId]+1;
-      const mcIdType *endNdlConnOfCurCell=conn+connIndex[eltId+1];
-      for(const mcIdType *iter=strtNdlConnOfCurCell;iter!=endNdlConnOfCurCell;iter++)
-        if(*iter>=0)//for polyhedrons
-          *std::find_if(revNodalPtr+revNodalIndxPtr[*iter],revNodalPtr+revNodalIndxPtr[*iter+1],std::bind(std::equal_to<mcIdType>(),std::placeholders::_1,-1))=eltId;
-    }
+  ComputeReverseNodalConnectivity(_nodal_connec->begin(),_nodal_connec_index->begin(),getNumberOfCells(),getNumberOfNodes(),revNodal,revNodalIndx);
 }
 
 /*!
@@ -656,6 +639,7 @@ void MEDCouplingUMesh::getReverseNodalConnectivity(DataArrayIdType *revNodal, Da
  * i.e. enumerate cells of the result mesh bounding each cell of \a this mesh. The
  * arrays \a revDesc and \a revDescIndx (\ref numbering-indirect) describe the reverse descending connectivity,
  * i.e. enumerate cells of  \a this mesh bounded by each cell of the result mesh.
+ * The computation uses MEDCouplingGetNumberOfThreads() threads.
  * \warning For speed reasons, this method does not check if node ids in the nodal
  *          connectivity correspond to the size of node coordinates array.
  * \warning Cells of the result mesh are \b not sorted by geometric type, hence,
@@ -2946,6 +2930,8 @@ void MEDCouplingUMesh::renumberCells(const mcIdType *old2NewBg, bool check)
 
 /*!
  * Finds cells whose bounding boxes intersect a given bounding box.
+ * A tree of the bounding boxes of the cells is built at the first call and kept by \a this for the next calls with the same \a eps,
+ * until \a this is modified. To answer many boxes at once, see getCellsInBoundingBoxes.
  *  \param [in] bbox - an array defining the bounding box via coordinates of its
  *         extremum points in "no interlace" mode, i.e. xMin, xMax, yMin, yMax, zMin,
  *         zMax (if in 3D).
@@ -2971,41 +2957,21 @@ DataArrayIdType *MEDCouplingUMesh::getCellsInBoundingBox(const double *bbox, dou
       elems->pushBackSilent(0);
       return elems.retn();
     }
-  int dim=getSpaceDimension();
-  INTERP_KERNEL::AutoPtr<double> elem_bb=new double[2*dim];
-  const mcIdType* conn      = getNodalConnectivity()->getConstPointer();
-  const mcIdType* conn_index= getNodalConnectivityIndex()->getConstPointer();
-  const double* coords = getCoords()->getConstPointer();
-  mcIdType nbOfCells=getNumberOfCells();
-  for ( mcIdType ielem=0; ielem<nbOfCells;ielem++ )
-    {
-      for (int i=0; i<dim; i++)
-        {
-          elem_bb[i*2]=std::numeric_limits<double>::max();
-          elem_bb[i*2+1]=-std::numeric_limits<double>::max();
-        }
-
-      for (mcIdType inode=conn_index[ielem]+1; inode<conn_index[ielem+1]; inode++)//+1 due to offset of cell type.
-        {
-          mcIdType node= conn[inode];
-          if(node>=0)//avoid polyhedron separator
-            {
-              for (int idim=0; idim<dim; idim++)
-                {
-                  if ( coords[node*dim+idim] < elem_bb[idim*2] )
-                    {
-                      elem_bb[idim*2] = coords[node*dim+idim] ;
-                    }
-                  if ( coords[node*dim+idim] > elem_bb[idim*2+1] )
-                    {
-                      elem_bb[idim*2+1] = coords[node*dim+idim] ;
-                    }
-                }
-            }
-        }
-      if (intersectsBoundingBox(elem_bb, bbox, dim, eps))
-        elems->pushBackSilent(ielem);
-    }
+  std::shared_ptr<const MEDCouplingUMeshCellLocator> locator(getCellLocatorForBoundingBoxes(eps));
+  std::vector<mcIdType> cells;
+  switch(getSpaceDimension())
+  {
+    case 3:
+      static_cast<const MEDCouplingUMeshBoundingBoxLocator<3>&>(*locator).getCellsInBoundingBox(bbox,cells);
+      break;
+    case 2:
+      static_cast<const MEDCouplingUMeshBoundingBoxLocator<2>&>(*locator).getCellsInBoundingBox(bbox,cells);
+      break;
+    case 1:
+      static_cast<const MEDCouplingUMeshBoundingBoxLocator<1>&>(*locator).getCellsInBoundingBox(bbox,cells);
+      break;
+  }
+  elems->insertAtTheEnd(cells.begin(),cells.end());
   return elems.retn();
 }
 
@@ -3013,6 +2979,7 @@ DataArrayIdType *MEDCouplingUMesh::getCellsInBoundingBox(const double *bbox, dou
  * Given a boundary box 'bbox' returns elements 'elems' contained in this 'bbox' or touching 'bbox' (within 'eps' distance).
  * Warning 'elems' is incremented during the call so if elems is not empty before call returned elements will be
  * added in 'elems' parameter.
+ * As for the other overload, the tree of the bounding boxes of the cells is kept by \a this between the calls.
  */
 DataArrayIdType *MEDCouplingUMesh::getCellsInBoundingBox(const INTERP_KERNEL::DirectedBoundingBox& bbox, double eps)
 {
@@ -3022,42 +2989,92 @@ DataArrayIdType *MEDCouplingUMesh::getCellsInBoundingBox(const INTERP_KERNEL::Di
       elems->pushBackSilent(0);
       return elems.retn();
     }
-  int dim=getSpaceDimension();
-  INTERP_KERNEL::AutoPtr<double> elem_bb=new double[2*dim];
-  const mcIdType* conn      = getNodalConnectivity()->getConstPointer();
-  const mcIdType* conn_index= getNodalConnectivityIndex()->getConstPointer();
-  const double* coords = getCoords()->getConstPointer();
-  mcIdType nbOfCells=getNumberOfCells();
-  for ( mcIdType ielem=0; ielem<nbOfCells;ielem++ )
-    {
-      for (int i=0; i<dim; i++)
-        {
-          elem_bb[i*2]=std::numeric_limits<double>::max();
-          elem_bb[i*2+1]=-std::numeric_limits<double>::max();
-        }
+  std::shared_ptr<const MEDCouplingUMeshCellLocator> locator(getCellLocatorForBoundingBoxes(eps));
+  std::vector<mcIdType> cells;
+  switch(getSpaceDimension())
+  {
+    case 3:
+      static_cast<const MEDCouplingUMeshBoundingBoxLocator<3>&>(*locator).getCellsInBoundingBox(bbox,cells);
+      break;
+    case 2:
+      static_cast<const MEDCouplingUMeshBoundingBoxLocator<2>&>(*locator).getCellsInBoundingBox(bbox,cells);
+      break;
+    case 1:
+      static_cast<const MEDCouplingUMeshBoundingBoxLocator<1>&>(*locator).getCellsInBoundingBox(bbox,cells);
+      break;
+  }
+  elems->insertAtTheEnd(cells.begin(),cells.end());
+  return elems.retn();
+}
 
-      for (mcIdType inode=conn_index[ielem]+1; inode<conn_index[ielem+1]; inode++)//+1 due to offset of cell type.
+/*!
+ * Batched version of getCellsInBoundingBox : finds, for each bounding box in \a bboxes, the cells whose bounding boxes intersect it.
+ * The boxes are dealt to MEDCouplingGetNumberOfThreads() threads.
+ *  \param [in] bboxes - the bounding boxes, one per tuple, each having 2*spaceDim components xMin, xMax, yMin, yMax, zMin, zMax (if in 3D).
+ *  \param [in] eps - a factor used to increase size of the bounding box of cell, as in getCellsInBoundingBox.
+ *  \return MEDCouplingSkyLineArray * - a new instance in which the pack \a i holds the sorted ids of the cells found for the box \a i.
+ *         The caller is to delete this array using decrRef() as it is no more needed.
+ *  \throw If the coordinates array is not set.
+ *  \throw If the nodal connectivity of cells is not defined.
+ *  \throw If \a bboxes is not allocated or if its number of components is not 2*spaceDim.
+ *  \sa getCellsInBoundingBox
+ */
+MEDCouplingSkyLineArray *MEDCouplingUMesh::getCellsInBoundingBoxes(const DataArrayDouble *bboxes, double eps) const
+{
+  if(!bboxes)
+    throw INTERP_KERNEL::Exception("MEDCouplingUMesh::getCellsInBoundingBoxes : input array of bounding boxes is NULL !");
+  bboxes->checkAllocated();
+  mcIdType nbOfBoxes(bboxes->getNumberOfTuples());
+  MCAuto<DataArrayIdType> index(DataArrayIdType::New()),value(DataArrayIdType::New());
+  if(getMeshDimension()==-1)
+    {
+      index->alloc(nbOfBoxes+1,1); index->iota();
+      value->alloc(nbOfBoxes,1); value->fillWithZero();
+      return MEDCouplingSkyLineArray::New(index,value);
+    }
+  int spaceDim(getSpaceDimension());
+  if(bboxes->getNumberOfComponents()!=2*(std::size_t)spaceDim)
+    {
+      std::ostringstream oss; oss << "MEDCouplingUMesh::getCellsInBoundingBoxes : invalid number of components of input array of bounding boxes ! Expected " << 2*spaceDim << " having " << bboxes->getNumberOfComponents() << " !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  std::shared_ptr<const MEDCouplingUMeshCellLocator> locator(getCellLocatorForBoundingBoxes(eps));
+  const double *bboxesPtr(bboxes->begin());
+  index->alloc(nbOfBoxes+1,1); index->setIJ(0,0,0);
+  mcIdType *indexPtr(index->getPointer());
+  unsigned int nbThreads(INTERP_KERNEL::EffectiveNumberOfThreads(MEDCouplingGetNumberOfThreads()));
+  std::size_t nbOfChunks(nbThreads==1?1:std::min((std::size_t)nbOfBoxes,nbThreads*INTERP_KERNEL::NB_OF_CHUNKS_PER_THREAD));
+  std::vector< std::vector<mcIdType> > valueOfChunks(nbOfChunks);
+  INTERP_KERNEL::ParallelForEachChunk(nbThreads,nbOfChunks,[&](unsigned int, std::size_t chunkId)
+    {
+      mcIdType start,stop;
+      INTERP_KERNEL::ChunkBounds(nbOfBoxes,nbOfChunks,chunkId,start,stop);
+      std::vector<mcIdType> cells;
+      for(mcIdType i=start;i<stop;i++)
         {
-          mcIdType node= conn[inode];
-          if(node>=0)//avoid polyhedron separator
-            {
-              for (int idim=0; idim<dim; idim++)
-                {
-                  if ( coords[node*dim+idim] < elem_bb[idim*2] )
-                    {
-                      elem_bb[idim*2] = coords[node*dim+idim] ;
-                    }
-                  if ( coords[node*dim+idim] > elem_bb[idim*2+1] )
-                    {
-                      elem_bb[idim*2+1] = coords[node*dim+idim] ;
-                    }
-                }
-            }
+          const double *bbox(bboxesPtr+2*spaceDim*i);
+          switch(spaceDim)
+          {
+            case 3:
+              static_cast<const MEDCouplingUMeshBoundingBoxLocator<3>&>(*locator).getCellsInBoundingBox(bbox,cells);
+              break;
+            case 2:
+              static_cast<const MEDCouplingUMeshBoundingBoxLocator<2>&>(*locator).getCellsInBoundingBox(bbox,cells);
+              break;
+            case 1:
+              static_cast<const MEDCouplingUMeshBoundingBoxLocator<1>&>(*locator).getCellsInBoundingBox(bbox,cells);
+              break;
+          }
+          indexPtr[i+1]=(mcIdType)cells.size();
+          valueOfChunks[chunkId].insert(valueOfChunks[chunkId].end(),cells.begin(),cells.end());
         }
-      if(intersectsBoundingBox(bbox, elem_bb, dim, eps))
-        elems->pushBackSilent(ielem);
-    }
-  return elems.retn();
+    });
+  std::partial_sum(indexPtr,indexPtr+nbOfBoxes+1,indexPtr);
+  value->alloc(indexPtr[nbOfBoxes],1);
+  mcIdType *valuePtr(value->getPointer());
+  for(std::vector< std::vector<mcIdType> >::const_iterator it=valueOfChunks.begin();it!=valueOfChunks.end();it++)
+    valuePtr=std::copy((*it).begin(),(*it).end(),valuePtr);
+  return MEDCouplingSkyLineArray::New(index,value);
 }
 
 /*!
@@ -4283,44 +4300,160 @@ DataArrayDouble *MEDCouplingUMesh::distanceToPoints(const DataArrayDouble *pts,
   MCAuto<DataArrayIdType> ret1=DataArrayIdType::New(); ret1->alloc(nbOfPts,1);
   const mcIdType *nc=_nodal_connec->begin(),*ncI=_nodal_connec_index->begin(); const double *coords=_coords->begin();
   double *ret0Ptr=ret0->getPointer(); mcIdType *ret1Ptr=ret1->getPointer(); const double *ptsPtr=pts->begin();
+  std::shared_ptr<const MEDCouplingUMeshCellLocator> locator(getCellLocatorForDistance());
+  unsigned int nbThreads(INTERP_KERNEL::EffectiveNumberOfThreads(MEDCouplingGetNumberOfThreads()));
+  std::size_t nbOfChunks(nbThreads==1?1:std::min((std::size_t)nbOfPts,nbThreads*INTERP_KERNEL::NB_OF_CHUNKS_PER_THREAD));
+  INTERP_KERNEL::ParallelForEachChunk(nbThreads,nbOfChunks,[&](unsigned int, std::size_t chunkId)
+    {
+      mcIdType start,stop;
+      INTERP_KERNEL::ChunkBounds(nbOfPts,nbOfChunks,chunkId,start,stop);
+      std::vector<mcIdType> elems;
+      for(mcIdType i=start;i<stop;i++)
+        {
+          const double *pt(ptsPtr+i*spaceDim);
+          double x=std::numeric_limits<double>::max();
+          elems.clear();
+          if(spaceDim==3)
+            {
+              const BBTreeDst<3>& myTree(static_cast<const MEDCouplingUMeshDistanceLocator<3>&>(*locator).getTree());
+              myTree.getMinDistanceOfMax(pt,x);
+              myTree.getElemsWhoseMinDistanceToPtSmallerThan(pt,x,elems);
+              DistanceToPoint3DSurfAlg(pt,&elems[0],&elems[0]+elems.size(),coords,nc,ncI,ret0Ptr[i],ret1Ptr[i]);
+            }
+          else
+            {
+              const BBTreeDst<2>& myTree(static_cast<const MEDCouplingUMeshDistanceLocator<2>&>(*locator).getTree());
+              myTree.getMinDistanceOfMax(pt,x);
+              myTree.getElemsWhoseMinDistanceToPtSmallerThan(pt,x,elems);
+              DistanceToPoint2DCurveAlg(pt,&elems[0],&elems[0]+elems.size(),coords,nc,ncI,ret0Ptr[i],ret1Ptr[i]);
+            }
+        }
+    });
+  cellIds=ret1.retn();
+  return ret0.retn();
+}
+
+/// @cond INTERNAL
+
+/*!
+ * Returns the tree of the bounding boxes of the cells used by getCellsContainingPoints with the precision \a eps. The tree is kept by \a this
+ * and reused by the next calls with the same precision, until \a this is modified (i.e. its time label changes). So, as for the other caches
+ * of MEDCoupling, declareAsNew has to be called on an array modified in place.
+ * The returned instance is never modified, so it can be used by several threads while \a this builds another one.
+ */
+std::shared_ptr<const MEDCouplingUMeshCellLocator> MEDCouplingUMesh::getCellLocator(double eps) const
+{
+  updateTime();
+  std::size_t meshTime(getTimeOfThis());
+  std::lock_guard<std::mutex> lock(_cell_locator_mutex);
+  if(_cell_locator && _cell_locator->isValidFor(meshTime,eps))
+    return _cell_locator;
+  _cell_locator.reset();
+  MCAuto<DataArrayDouble> bboxArr(getBoundingBoxForBBTree(eps));
+  switch(getSpaceDimension())
+  {
+    case 3:
+      _cell_locator=std::make_shared< MEDCouplingUMeshPointLocator<3> >(meshTime,eps,bboxArr);
+      break;
+    case 2:
+      _cell_locator=std::make_shared< MEDCouplingUMeshPointLocator<2> >(meshTime,eps,bboxArr);
+      break;
+    case 1:
+      _cell_locator=std::make_shared< MEDCouplingUMeshPointLocator<1> >(meshTime,eps,bboxArr);
+      break;
+    default:
+      throw INTERP_KERNEL::Exception("MEDCouplingUMesh::getCellLocator : only spacedim 1, 2 and 3 supported !");
+  }
+  return _cell_locator;
+}
+
+/*!
+ * Same as getCellLocator for the tree used by distanceToPoints.
+ */
+std::shared_ptr<const MEDCouplingUMeshCellLocator> MEDCouplingUMesh::getCellLocatorForDistance() const
+{
+  updateTime();
+  std::size_t meshTime(getTimeOfThis());
+  std::lock_guard<std::mutex> lock(_cell_locator_mutex);
+  if(_cell_locator_dst && _cell_locator_dst->isValidFor(meshTime,0.))
+    return _cell_locator_dst;
+  _cell_locator_dst.reset();
   MCAuto<DataArrayDouble> bboxArr(getBoundingBoxForBBTree());
-  const double *bbox(bboxArr->begin());
-  switch(spaceDim)
+  switch(getSpaceDimension())
   {
     case 3:
-      {
-        BBTreeDst<3> myTree(bbox,0,0,nbCells);
-        for(mcIdType i=0;i<nbOfPts;i++,ret0Ptr++,ret1Ptr++,ptsPtr+=3)
-          {
-            double x=std::numeric_limits<double>::max();
-            std::vector<mcIdType> elems;
-            myTree.getMinDistanceOfMax(ptsPtr,x);
-            myTree.getElemsWhoseMinDistanceToPtSmallerThan(ptsPtr,x,elems);
-            DistanceToPoint3DSurfAlg(ptsPtr,&elems[0],&elems[0]+elems.size(),coords,nc,ncI,*ret0Ptr,*ret1Ptr);
-          }
-        break;
-      }
+      _cell_locator_dst=std::make_shared< MEDCouplingUMeshDistanceLocator<3> >(meshTime,bboxArr);
+      break;
     case 2:
-      {
-        BBTreeDst<2> myTree(bbox,0,0,nbCells);
-        for(mcIdType i=0;i<nbOfPts;i++,ret0Ptr++,ret1Ptr++,ptsPtr+=2)
-          {
-            double x=std::numeric_limits<double>::max();
-            std::vector<mcIdType> elems;
-            myTree.getMinDistanceOfMax(ptsPtr,x);
-            myTree.getElemsWhoseMinDistanceToPtSmallerThan(ptsPtr,x,elems);
-            DistanceToPoint2DCurveAlg(ptsPtr,&elems[0],&elems[0]+elems.size(),coords,nc,ncI,*ret0Ptr,*ret1Ptr);
-          }
-        break;
-      }
+      _cell_locator_dst=std::make_shared< MEDCouplingUMeshDistanceLocator<2> >(meshTime,bboxArr);
+      break;
     default:
-      throw INTERP_KERNEL::Exception("MEDCouplingUMesh::distanceToPoints : only spacedim 2 and 3 supported !");
+      throw INTERP_KERNEL::Exception("MEDCouplingUMesh::getCellLocatorForDistance : only spacedim 2 and 3 supported !");
   }
-  cellIds=ret1.retn();
-  return ret0.retn();
+  return _cell_locator_dst;
 }
 
-/// @cond INTERNAL
+/*!
+ * Same as getCellLocator for the tree used by getCellsInBoundingBox and getCellsInBoundingBoxes with the factor \a eps.
+ */
+std::shared_ptr<const MEDCouplingUMeshCellLocator> MEDCouplingUMesh::getCellLocatorForBoundingBoxes(double eps) const
+{
+  checkFullyDefined();
+  updateTime();
+  std::size_t meshTime(getTimeOfThis());
+  std::lock_guard<std::mutex> lock(_cell_locator_mutex);
+  if(_cell_locator_bb && _cell_locator_bb->isValidFor(meshTime,eps))
+    return _cell_locator_bb;
+  _cell_locator_bb.reset();
+  int spaceDim(getSpaceDimension());
+  mcIdType nbOfCells(getNumberOfCells());
+  const mcIdType *conn(_nodal_connec->begin()),*connI(_nodal_connec_index->begin());
+  const double *coords(_coords->begin());
+  MCAuto<DataArrayDouble> bboxArr(DataArrayDouble::New()); bboxArr->alloc(nbOfCells,2*spaceDim);
+  double *bbox(bboxArr->getPointer());
+  for(mcIdType ielem=0;ielem<nbOfCells;ielem++,bbox+=2*spaceDim)
+    {
+      for(int i=0;i<spaceDim;i++)
+        {
+          bbox[i*2]=std::numeric_limits<double>::max();
+          bbox[i*2+1]=-std::numeric_limits<double>::max();
+        }
+      for(mcIdType inode=connI[ielem]+1;inode<connI[ielem+1];inode++)//+1 due to offset of cell type.
+        {
+          mcIdType node(conn[inode]);
+          if(node>=0)//avoid polyhedron separator
+            for(int idim=0;idim<spaceDim;idim++)
+              {
+                bbox[idim*2]=std::min(bbox[idim*2],coords[node*spaceDim+idim]);
+                bbox[idim*2+1]=std::max(bbox[idim*2+1],coords[node*spaceDim+idim]);
+              }
+        }
+      // same enlargement than intersectsBoundingBox
+      double deltamax(0.);
+      for(int i=0;i<spaceDim;i++)
+        deltamax=std::max(deltamax,bbox[2*i+1]-bbox[2*i]);
+      for(int i=0;i<spaceDim;i++)
+        {
+          bbox[i*2]=bbox[i*2]-deltamax*eps;
+          bbox[i*2+1]=bbox[i*2+1]+deltamax*eps;
+        }
+    }
+  switch(spaceDim)
+  {
+    case 3:
+      _cell_locator_bb=std::make_shared< MEDCouplingUMeshBoundingBoxLocator<3> >(meshTime,eps,bboxArr);
+      break;
+    case 2:
+      _cell_locator_bb=std::make_shared< MEDCouplingUMeshBoundingBoxLocator<2> >(meshTime,eps,bboxArr);
+      break;
+    case 1:
+      _cell_locator_bb=std::make_shared< MEDCouplingUMeshBoundingBoxLocator<1> >(meshTime,eps,bboxArr);
+      break;
+    default:
+      throw INTERP_KERNEL::Exception("MEDCouplingUMesh::getCellLocatorForBoundingBoxes : only spacedim 1, 2 and 3 supported !");
+  }
+  return _cell_locator_bb;
+}
 
 /// @endcond
 
@@ -6971,6 +7104,52 @@ DataArrayDouble *MEDCouplingUMesh::computePlaneEquationOf3DFaces() const
   return ret.retn();
 }
 
+/*!
+ * Writes the coordinates and the nodal connectivity of \a this in the raw binary files \a prefix.coords, \a prefix.conn and \a prefix.conni
+ * (see DataArrayTemplate::writeRawFile), together with the mesh dimension and the geometric types of the cells.
+ * The mesh can then be reopened at once, whatever its size, by MEDCouplingUMesh::LoadFromRawFiles. The name, the description, the time and
+ * the components info of the coordinates are not written.
+ *  \param [in] prefix - the path of the files to write, without extension.
+ *  \throw If the coordinates or the nodal connectivity of \a this are not set.
+ *  \throw If a file cannot be written.
+ */
+void MEDCouplingUMesh::writeRawFiles(const std::string& prefix) const
+{
+  checkFullyDefined();
+  std::int64_t types(0);
+  for(std::set<INTERP_KERNEL::NormalizedCellType>::const_iterator it=_types.begin();it!=_types.end();it++)
+    types|=(std::int64_t)1 << (int)*it;
+  _coords->writeRawFile(prefix+".coords");
+  _nodal_connec->writeRawFile(prefix+".conn",_mesh_dim);
+  _nodal_connec_index->writeRawFile(prefix+".conni",types);
+}
+
+/*!
+ * Builds a mesh whose coordinates and nodal connectivity are mapped in memory from the raw binary files written by MEDCouplingUMesh::writeRawFiles
+ * (see DataArrayTemplate::useMappedRawFile). Nothing is read or scanned at this point : the arrays are loaded by the system as they are accessed
+ * by the algorithms, and can be dropped from memory under pressure, which allows to work on meshes larger than the memory.
+ *  \param [in] prefix - the path of the files, without extension.
+ *  \param [in] copyOnWrite - if false, the arrays of the returned mesh are read only and any algorithm modifying them in place throws. If true,
+ *               they can be modified, the modified pages being copied in memory and the files being left unchanged.
+ *  \return MEDCouplingUMesh * - a new instance. The caller is to delete it using decrRef() as it is no more needed.
+ *  \throw If a file cannot be read or has not been written by MEDCouplingUMesh::writeRawFiles.
+ */
+MEDCouplingUMesh *MEDCouplingUMesh::LoadFromRawFiles(const std::string& prefix, bool copyOnWrite)
+{
+  MCAuto<DataArrayDouble> coords(DataArrayDouble::New());
+  MCAuto<DataArrayIdType> conn(DataArrayIdType::New()),connI(DataArrayIdType::New());
+  coords->useMappedRawFile(prefix+".coords",copyOnWrite);
+  std::int64_t meshDim(conn->useMappedRawFile(prefix+".conn",copyOnWrite));
+  std::int64_t types(connI->useMappedRawFile(prefix+".conni",copyOnWrite));
+  MCAuto<MEDCouplingUMesh> ret(MEDCouplingUMesh::New("Mesh",(int)meshDim));
+  ret->setCoords(coords);
+  ret->setConnectivity(conn,connI,false);
+  for(int i=0;i<=INTERP_KERNEL::NORM_MAXTYPE;i++)
+    if(types & ((std::int64_t)1 << i))
+      ret->_types.insert((INTERP_KERNEL::NormalizedCellType)i);
+  return ret.retn();
+}
+
 /*!
  * This method expects as input a DataArrayDouble non nul instance 'da' that should be allocated. If not an exception is thrown.
  *
@@ -27,9 +27,12 @@
 #include "CellModel.hxx"
 
 #include <set>
+#include <mutex>
+#include <memory>
 
 namespace MEDCoupling
 {
+  class MEDCouplingUMeshCellLocator;
   class MEDCouplingUMeshCellByTypeEntry;
   class MEDCouplingUMeshCellIterator;
   class MEDCoupling1SGTUMesh;
@@ -159,6 +162,7 @@ namespace MEDCoupling
     MEDCOUPLING_EXPORT void renumberCells(const mcIdType *old2NewBg, bool check=true);
     MEDCOUPLING_EXPORT DataArrayIdType *getCellsInBoundingBox(const double *bbox, double eps) const;
     MEDCOUPLING_EXPORT DataArrayIdType *getCellsInBoundingBox(const INTERP_KERNEL::DirectedBoundingBox& bbox, double eps);
+    MEDCOUPLING_EXPORT MEDCouplingSkyLineArray *getCellsInBoundingBoxes(const DataArrayDouble *bboxes, double eps) const;
     MEDCOUPLING_EXPORT MEDCouplingFieldDouble *getMeasureField(bool isAbs) const;
     MEDCOUPLING_EXPORT DataArrayDouble *getPartMeasureField(bool isAbs, const mcIdType *begin, const mcIdType *end) const;
     MEDCOUPLING_EXPORT MEDCouplingFieldDouble *getMeasureFieldOnNode(bool isAbs) const;
@@ -248,6 +252,8 @@ namespace MEDCoupling
     MEDCOUPLING_EXPORT DataArrayIdType *colinearizeKeepingConform2D(double eps);
     MEDCOUPLING_EXPORT DataArrayIdType *conformize3D(double eps);
     MEDCOUPLING_EXPORT mcIdType split2DCells(const DataArrayIdType *desc, const DataArrayIdType *descI, const DataArrayIdType *subNodesInSeg, const DataArrayIdType *subNodesInSegI, const DataArrayIdType *midOpt=0, const DataArrayIdType *midOptI=0);
+    MEDCOUPLING_EXPORT void writeRawFiles(const std::string& prefix) const;
+    MEDCOUPLING_EXPORT static MEDCouplingUMesh *LoadFromRawFiles(const std::string& prefix, bool copyOnWrite=false);
     MEDCOUPLING_EXPORT static MEDCouplingUMesh *Build0DMeshFromCoords(DataArrayDouble *da);
     MEDCOUPLING_EXPORT static MCAuto<MEDCouplingUMesh> Build1DMeshFromCoords(DataArrayDouble *da);
     MEDCOUPLING_EXPORT static MEDCouplingUMesh *MergeUMeshes(const MEDCouplingUMesh *mesh1, const MEDCouplingUMesh *mesh2);
@@ -304,6 +310,8 @@ namespace MEDCoupling
     DataArrayDouble *fillExtCoordsUsingTranslAndAutoRotation2D(const MEDCouplingUMesh *mesh1D, bool isQuad) const;
     DataArrayDouble *fillExtCoordsUsingTranslAndAutoRotation3D(const MEDCouplingUMesh *mesh1D, bool isQuad) const;
     static bool AreCellsEqualInPool(const std::vector<mcIdType>& candidates, int compType, const mcIdType *conn, const mcIdType *connI, DataArrayIdType *result) ;
+    static void ComputeReverseNodalConnectivity(const mcIdType *conn, const mcIdType *connIndex, mcIdType nbOfCells, mcIdType nbOfNodes, DataArrayIdType *revNodal, DataArrayIdType *revNodalIndx);
+    static bool FindCellsWithSameNodes(const mcIdType *conn, const mcIdType *connIndex, mcIdType nbOfCells, DataArrayIdType *& commonCellsArr, DataArrayIdType *& commonCellsIArr);
     MEDCouplingUMesh *buildPartOfMySelfKeepCoords(const mcIdType *begin, const mcIdType *end) const;
     MEDCouplingUMesh *buildPartOfMySelfKeepCoordsSlice(mcIdType start, mcIdType end, mcIdType step) const;
     DataArrayIdType *convertLinearCellsToQuadratic1D0(DataArrayIdType *&conn, DataArrayIdType *&connI, DataArrayDouble *& coords, std::set<INTERP_KERNEL::NormalizedCellType>& types) const;
@@ -320,6 +328,9 @@ namespace MEDCoupling
     void getCellsContainingPointsZeAlg(const double *pos, mcIdType nbOfPoints, double eps,
                                        MCAuto<DataArrayIdType>& elts, MCAuto<DataArrayIdType>& eltsIndex,
                                        std::function<bool(INTERP_KERNEL::NormalizedCellType,mcIdType)> sensibilityTo2DQuadraticLinearCellsFunc) const;
+    std::shared_ptr<const MEDCouplingUMeshCellLocator> getCellLocator(double eps) const;
+    std::shared_ptr<const MEDCouplingUMeshCellLocator> getCellLocatorForDistance() const;
+    std::shared_ptr<const MEDCouplingUMeshCellLocator> getCellLocatorForBoundingBoxes(double eps) const;
 /// @cond INTERNAL
     static void DeleteCellTypeInIndexedArray(const DataArrayIdType *arrIn, const DataArrayIdType *arrIndxIn, MCAuto<DataArrayIdType>& arrOut, MCAuto<DataArrayIdType>& arrIndxOut);
     static MEDCouplingUMesh *MergeUMeshesLL(const std::vector<const MEDCouplingUMesh *>& a);
@@ -371,6 +382,11 @@ namespace MEDCoupling
     DataArrayIdType *_nodal_connec;
     DataArrayIdType *_nodal_connec_index;
     std::set<INTERP_KERNEL::NormalizedCellType> _types;
+    //! spatial indexes of the cells kept between calls, see getCellLocator, getCellLocatorForDistance and getCellLocatorForBoundingBoxes
+    mutable std::mutex _cell_locator_mutex;
+    mutable std::shared_ptr<const MEDCouplingUMeshCellLocator> _cell_locator;
+    mutable std::shared_ptr<const MEDCouplingUMeshCellLocator> _cell_locator_dst;
+    mutable std::shared_ptr<const MEDCouplingUMeshCellLocator> _cell_locator_bb;
   public:
     static double EPS_FOR_POLYH_ORIENTATION;
   };
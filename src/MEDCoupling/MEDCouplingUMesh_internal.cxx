@@ -29,6 +29,7 @@
 #include "PointLocatorAlgos.txx"
 #include "BBTree.txx"
 #include "BBTreeDst.txx"
+#include "BBTreeFlat.txx"
 #include "SplitterTetra.hxx"
 #include "DiameterCalculator.hxx"
 #include "DirectedBoundingBox.hxx"
@@ -41,9 +42,12 @@
 #include "InterpKernelGeo2DEdgeLin.hxx"
 #include "InterpKernelGeo2DEdgeArcCircle.hxx"
 #include "InterpKernelGeo2DQuadraticPolygon.hxx"
+#include "MEDCouplingParallelAlgorithms.txx"
+#include "InterpKernelThreads.hxx"
 #include "MEDCouplingUMesh_internal.hxx"
 
 #include <sstream>
+#include <atomic>
 #include <fstream>
 #include <numeric>
 #include <cstring>
@@ -865,6 +869,179 @@ bool MEDCouplingUMesh::AreCellsEqualInPool(const std::vector<mcIdType>& candidat
   return ret;
 }
 
+/*!
+ * Computes the reverse nodal connectivity of the \a nbOfCells cells described by \a conn and \a connIndex lying on \a nbOfNodes nodes.
+ * Negative node ids (polyhedron face separators) are ignored. For each node, cell ids are sorted in ascending order.
+ * With several threads, cells are counted and then scattered in \a revNodal using atomic offsets per node, and the cell ids of each
+ * node are sorted at last, so that the result is the one of the serial algorithm.
+ */
+void MEDCouplingUMesh::ComputeReverseNodalConnectivity(const mcIdType *conn, const mcIdType *connIndex, mcIdType nbOfCells, mcIdType nbOfNodes, DataArrayIdType *revNodal, DataArrayIdType *revNodalIndx)
+{
+  unsigned int nbThreads(NumberOfThreadsFor(connIndex[nbOfCells]));
+  revNodalIndx->alloc(nbOfNodes+1,1);
+  mcIdType *revNodalIndxPtr(revNodalIndx->getPointer());
+  if(nbThreads==1)
+    {
+      std::fill(revNodalIndxPtr,revNodalIndxPtr+nbOfNodes+1,0);
+      for(mcIdType eltId=0;eltId<nbOfCells;eltId++)
+        for(const mcIdType *iter=conn+connIndex[eltId]+1;iter!=conn+connIndex[eltId+1];iter++)
+          if(*iter>=0)//for polyhedrons
+            revNodalIndxPtr[(*iter)+1]++;
+      std::partial_sum(revNodalIndxPtr,revNodalIndxPtr+nbOfNodes+1,revNodalIndxPtr);
+      revNodal->alloc(revNodalIndxPtr[nbOfNodes],1);
+      mcIdType *revNodalPtr(revNodal->getPointer());
+      std::vector<mcIdType> pos(revNodalIndxPtr,revNodalIndxPtr+nbOfNodes);
+      for(mcIdType eltId=0;eltId<nbOfCells;eltId++)
+        for(const mcIdType *iter=conn+connIndex[eltId]+1;iter!=conn+connIndex[eltId+1];iter++)
+          if(*iter>=0)
+            revNodalPtr[pos[*iter]++]=eltId;
+      return ;
+    }
+  std::unique_ptr< std::atomic<mcIdType>[] > pos(new std::atomic<mcIdType>[nbOfNodes]);
+  ParallelForEachRange(nbThreads,nbOfNodes,[&](std::size_t, std::size_t start, std::size_t stop)
+    {
+      for(std::size_t i=start;i<stop;i++)
+        pos[i].store(0,std::memory_order_relaxed);
+    });
+  ParallelForEachRange(nbThreads,nbOfCells,[&](std::size_t, std::size_t start, std::size_t stop)
+    {
+      for(mcIdType eltId=(mcIdType)start;eltId<(mcIdType)stop;eltId++)
+        for(const mcIdType *iter=conn+connIndex[eltId]+1;iter!=conn+connIndex[eltId+1];iter++)
+          if(*iter>=0)
+            pos[*iter].fetch_add(1,std::memory_order_relaxed);
+    });
+  revNodalIndxPtr[0]=0;
+  for(mcIdType i=0;i<nbOfNodes;i++)
+    {
+      revNodalIndxPtr[i+1]=revNodalIndxPtr[i]+pos[i].load(std::memory_order_relaxed);
+      pos[i].store(revNodalIndxPtr[i],std::memory_order_relaxed);
+    }
+  revNodal->alloc(revNodalIndxPtr[nbOfNodes],1);
+  mcIdType *revNodalPtr(revNodal->getPointer());
+  ParallelForEachRange(nbThreads,nbOfCells,[&](std::size_t, std::size_t start, std::size_t stop)
+    {
+      for(mcIdType eltId=(mcIdType)start;eltId<(mcIdType)stop;eltId++)
+        for(const mcIdType *iter=conn+connIndex[eltId]+1;iter!=conn+connIndex[eltId+1];iter++)
+          if(*iter>=0)
+            revNodalPtr[pos[*iter].fetch_add(1,std::memory_order_relaxed)]=eltId;
+    });
+  ParallelForEachRange(nbThreads,nbOfNodes,[&](std::size_t, std::size_t start, std::size_t stop)
+    {
+      for(std::size_t i=start;i<stop;i++)
+        std::sort(revNodalPtr+revNodalIndxPtr[i],revNodalPtr+revNodalIndxPtr[i+1]);
+    });
+}
+
+/*!
+ * Finds the groups of cells lying on the same set of nodes among the \a nbOfCells cells described by \a conn and \a connIndex. The output
+ * is the one of MEDCouplingUMesh::FindCommonCellsAlg with the comparison policy 3 and a start cell id equal to 0 : groups are ordered by
+ * their smallest cell id, and cell ids are in ascending order in each group.
+ * Cells are dealt to partitions using a hash of their sorted nodes, so that equal cells are in the same partition. Each partition is then sorted
+ * independently to find its groups.
+ * \return false if a cell has a negative or a repeated node id. In this case nothing is computed and the caller has to fall back on
+ *         MEDCouplingUMesh::FindCommonCellsAlg.
+ */
+bool MEDCouplingUMesh::FindCellsWithSameNodes(const mcIdType *conn, const mcIdType *connIndex, mcIdType nbOfCells, DataArrayIdType *& commonCellsArr, DataArrayIdType *& commonCellsIArr)
+{
+  unsigned int nbThreads(NumberOfThreadsFor(nbOfCells));
+  std::size_t nbOfRanges(nbThreads),nbOfPartitions(nbThreads==1?1:nbThreads*INTERP_KERNEL::NB_OF_CHUNKS_PER_THREAD);
+  // nodes of each cell are sorted in a copy of conn, the place of the type is kept empty
+  std::vector<mcIdType> sortedConn(connIndex[nbOfCells]);
+  std::vector<std::size_t> partitionOfCells(nbOfCells);
+  std::vector<char> isDegenerated(nbOfRanges,0);
+  ParallelForEachRange(nbThreads,nbOfCells,[&](std::size_t rangeId, std::size_t start, std::size_t stop)
+    {
+      for(std::size_t i=start;i<stop;i++)
+        {
+          mcIdType *bg(sortedConn.data()+connIndex[i]+1),*end(sortedConn.data()+connIndex[i+1]);
+          std::copy(conn+connIndex[i]+1,conn+connIndex[i+1],bg);
+          std::sort(bg,end);
+          if(bg==end || *bg<0 || std::adjacent_find(bg,end)!=end)
+            isDegenerated[rangeId]=1;
+          std::size_t h(std::distance(bg,end));
+          for(const mcIdType *it=bg;it!=end;it++)
+            h^=std::hash<mcIdType>()(*it)+0x9e3779b9+(h<<6)+(h>>2);
+          partitionOfCells[i]=h%nbOfPartitions;
+        }
+    });
+  if(std::find(isDegenerated.begin(),isDegenerated.end(),1)!=isDegenerated.end())
+    return false;
+  // cell ids of each partition, in ascending order
+  std::vector<std::size_t> offsets(nbOfRanges*nbOfPartitions,0);
+  ParallelForEachRange(nbThreads,nbOfCells,[&](std::size_t rangeId, std::size_t start, std::size_t stop)
+    {
+      std::size_t *counts(offsets.data()+rangeId*nbOfPartitions);
+      for(std::size_t i=start;i<stop;i++)
+        counts[partitionOfCells[i]]++;
+    });
+  std::vector<std::size_t> partitionsIndex(nbOfPartitions+1,0);
+  for(std::size_t p=0,sum=0;p<nbOfPartitions;p++)
+    {
+      for(std::size_t rangeId=0;rangeId<nbOfRanges;rangeId++)
+        {
+          std::size_t& offset(offsets[rangeId*nbOfPartitions+p]);
+          std::size_t count(offset);
+          offset=sum;
+          sum+=count;
+        }
+      partitionsIndex[p+1]=sum;
+    }
+  std::vector<mcIdType> cellsOfPartitions(nbOfCells);
+  ParallelForEachRange(nbThreads,nbOfCells,[&](std::size_t rangeId, std::size_t start, std::size_t stop)
+    {
+      std::size_t *pos(offsets.data()+rangeId*nbOfPartitions);
+      for(std::size_t i=start;i<stop;i++)
+        cellsOfPartitions[pos[partitionOfCells[i]]++]=ToIdType(i);
+    });
+  // groups of each partition
+  std::vector< std::vector< std::vector<mcIdType> > > groupsOfPartitions(nbOfPartitions);
+  INTERP_KERNEL::ParallelForEachChunk(nbThreads,nbOfPartitions,[&](unsigned int, std::size_t p)
+    {
+      mcIdType *bg(cellsOfPartitions.data()+partitionsIndex[p]),*end(cellsOfPartitions.data()+partitionsIndex[p+1]);
+      auto isLess=[&sortedConn,connIndex](mcIdType cell1, mcIdType cell2)
+        {
+          mcIdType sz1(connIndex[cell1+1]-connIndex[cell1]),sz2(connIndex[cell2+1]-connIndex[cell2]);
+          if(sz1!=sz2)
+            return sz1<sz2;
+          const mcIdType *nodes1(sortedConn.data()+connIndex[cell1]+1),*nodes2(sortedConn.data()+connIndex[cell2]+1);
+          std::pair<const mcIdType *,const mcIdType *> diff(std::mismatch(nodes1,nodes1+sz1-1,nodes2));
+          if(diff.first!=nodes1+sz1-1)
+            return *diff.first<*diff.second;
+          return cell1<cell2;
+        };
+      auto isSame=[&sortedConn,connIndex](mcIdType cell1, mcIdType cell2)
+        {
+          mcIdType sz1(connIndex[cell1+1]-connIndex[cell1]);
+          return sz1==connIndex[cell2+1]-connIndex[cell2] && std::equal(sortedConn.data()+connIndex[cell1]+1,sortedConn.data()+connIndex[cell1+1],sortedConn.data()+connIndex[cell2]+1);
+        };
+      std::sort(bg,end,isLess);
+      for(mcIdType *it=bg;it!=end;)
+        {
+          mcIdType *endOfGroup(it+1);
+          while(endOfGroup!=end && isSame(*it,*endOfGroup))
+            endOfGroup++;
+          if(std::distance(it,endOfGroup)>1)
+            groupsOfPartitions[p].push_back(std::vector<mcIdType>(it,endOfGroup));
+          it=endOfGroup;
+        }
+    });
+  std::vector<const std::vector<mcIdType> *> groups;
+  for(std::vector< std::vector< std::vector<mcIdType> > >::const_iterator it=groupsOfPartitions.begin();it!=groupsOfPartitions.end();it++)
+    for(std::vector< std::vector<mcIdType> >::const_iterator it2=(*it).begin();it2!=(*it).end();it2++)
+      groups.push_back(&(*it2));
+  std::sort(groups.begin(),groups.end(),[](const std::vector<mcIdType> *g1, const std::vector<mcIdType> *g2) { return g1->front()<g2->front(); });
+  MCAuto<DataArrayIdType> commonCells(DataArrayIdType::New()),commonCellsI(DataArrayIdType::New());
+  commonCells->alloc(0,1); commonCellsI->alloc(groups.size()+1,1);
+  mcIdType *commonCellsIPtr(commonCellsI->getPointer()); *commonCellsIPtr++=0;
+  for(std::vector<const std::vector<mcIdType> *>::const_iterator it=groups.begin();it!=groups.end();it++,commonCellsIPtr++)
+    {
+      commonCells->insertAtTheEnd((*it)->begin(),(*it)->end());
+      *commonCellsIPtr=commonCells->getNumberOfTuples();
+    }
+  commonCellsArr=commonCells.retn(); commonCellsIArr=commonCellsI.retn();
+  return true;
+}
+
 /*!
  * This is the low algorithm of MEDCouplingUMesh::buildPartOfMySelf.
  * Keeps from \a this only cells which constituing point id are in the ids specified by [ \a begin,\a end ).
@@ -98,53 +98,184 @@ namespace MEDCoupling
   };
 }
 
+namespace MEDCoupling
+{
+  /*!
+   * Spatial index of the cells of a MEDCouplingUMesh, kept by the mesh between calls (see MEDCouplingUMesh::getCellLocator).
+   * An instance is never modified once built, so that it can be queried by several threads at the same time. It is valid as long as
+   * the mesh has not been modified since its construction, i.e. as long as the time label of the mesh is \a _mesh_time.
+   */
+  class MEDCouplingUMeshCellLocator
+  {
+  public:
+    MEDCouplingUMeshCellLocator(std::size_t meshTime, double eps):_mesh_time(meshTime),_eps(eps) { }
+    virtual ~MEDCouplingUMeshCellLocator() { }
+    bool isValidFor(std::size_t meshTime, double eps) const { return _mesh_time==meshTime && _eps==eps; }
+    virtual std::size_t getHeapMemorySize() const = 0;
+  private:
+    std::size_t _mesh_time;
+    double _eps;
+  };
+
+  //! Tree of the bounding boxes of the cells used to locate points with a precision \a eps
+  template<int SPACEDIM>
+  class MEDCouplingUMeshPointLocator : public MEDCouplingUMeshCellLocator
+  {
+  public:
+    MEDCouplingUMeshPointLocator(std::size_t meshTime, double eps, const DataArrayDouble *bbox):MEDCouplingUMeshCellLocator(meshTime,eps),
+                                                                                                _tree(bbox->begin(),0,0,bbox->getNumberOfTuples(),-eps),_nb_of_cells(bbox->getNumberOfTuples()) { }
+    const BBTreeFlat<SPACEDIM,mcIdType>& getTree() const { return _tree; }
+    std::size_t getHeapMemorySize() const { return (std::size_t)_nb_of_cells*(2*SPACEDIM*sizeof(double)+sizeof(mcIdType)); }
+  private:
+    BBTreeFlat<SPACEDIM,mcIdType> _tree;
+    mcIdType _nb_of_cells;
+  };
+
+  //! Tree of the bounding boxes of the cells used to compute distances from points to the cells
+  template<int SPACEDIM>
+  class MEDCouplingUMeshDistanceLocator : public MEDCouplingUMeshCellLocator
+  {
+  public:
+    MEDCouplingUMeshDistanceLocator(std::size_t meshTime, MCAuto<DataArrayDouble> bbox):MEDCouplingUMeshCellLocator(meshTime,0.),_bbox(bbox),
+                                                                                        _tree(_bbox->begin(),0,0,_bbox->getNumberOfTuples()) { }
+    const BBTreeDst<SPACEDIM>& getTree() const { return _tree; }
+    std::size_t getHeapMemorySize() const { return 2*_bbox->getHeapMemorySizeWithoutChildren(); }
+  private:
+    //! referenced by _tree
+    MCAuto<DataArrayDouble> _bbox;
+    BBTreeDst<SPACEDIM> _tree;
+  };
+
+  /*!
+   * Tree of the bounding boxes of the cells used by getCellsInBoundingBox. \a bbox contains the bounding boxes of the cells (computed
+   * from their nodes) already enlarged by \a eps times their maximal extent, so that the candidates given by the tree are filtered
+   * with exactly the same test than MEDCouplingPointSet::intersectsBoundingBox.
+   */
+  template<int SPACEDIM>
+  class MEDCouplingUMeshBoundingBoxLocator : public MEDCouplingUMeshCellLocator
+  {
+  public:
+    MEDCouplingUMeshBoundingBoxLocator(std::size_t meshTime, double eps, MCAuto<DataArrayDouble> bbox):MEDCouplingUMeshCellLocator(meshTime,eps),_bbox(bbox),
+                                                                                                        _tree(_bbox->begin(),0,0,_bbox->getNumberOfTuples(),0.) { }
+    std::size_t getHeapMemorySize() const { return 2*_bbox->getHeapMemorySizeWithoutChildren()+(std::size_t)_bbox->getNumberOfTuples()*sizeof(mcIdType); }
+    //! Fills \a cells with the sorted ids of the cells whose enlarged bounding box intersects \a bbox
+    void getCellsInBoundingBox(const double *bbox, std::vector<mcIdType>& cells) const
+    {
+      cells.clear();
+      _tree.getIntersectingElems(bbox,cells);
+      const double *cellBBox(_bbox->begin());
+      cells.erase(std::remove_if(cells.begin(),cells.end(),[cellBBox,bbox](mcIdType cellId)
+                                 {
+                                   const double *bb(cellBBox+2*SPACEDIM*cellId);
+                                   for(int idim=0;idim<SPACEDIM;idim++)
+                                     if(!(bb[idim*2]<bbox[idim*2+1] && bbox[idim*2]<bb[idim*2+1]))
+                                       return true;
+                                   return false;
+                                 }),cells.end());
+      std::sort(cells.begin(),cells.end());
+    }
+    //! Same as above for a directed bounding box. The tree is queried with the axis aligned envelope of \a bbox.
+    void getCellsInBoundingBox(const INTERP_KERNEL::DirectedBoundingBox& bbox, std::vector<mcIdType>& cells) const
+    {
+      double envelope[2*SPACEDIM];
+      std::vector<double> data(bbox.getData());
+      if((int)data[0]!=SPACEDIM)
+        for(int idim=0;idim<SPACEDIM;idim++)
+          {
+            envelope[2*idim]=-std::numeric_limits<double>::max();
+            envelope[2*idim+1]=std::numeric_limits<double>::max();
+          }
+      else
+        {
+          // data is [dim, axes (one per row), minmax in the local frame of the axes]
+          const double *axes(&data[1]),*minmax(&data[1+SPACEDIM*SPACEDIM]);
+          for(int k=0;k<SPACEDIM;k++)
+            {
+              double lo(0.),hi(0.),scale(0.);
+              for(int i=0;i<SPACEDIM;i++)
+                {
+                  double a(SPACEDIM==1?1.:axes[i*SPACEDIM+k]);
+                  lo+=std::min(a*minmax[2*i],a*minmax[2*i+1]);
+                  hi+=std::max(a*minmax[2*i],a*minmax[2*i+1]);
+                  scale+=std::abs(a)*std::max(std::abs(minmax[2*i]),std::abs(minmax[2*i+1]));
+                }
+              // the envelope only has to contain the one computed by DirectedBoundingBox::isDisjointWith, whatever the rounding errors
+              envelope[2*k]=lo-1e-12*scale;
+              envelope[2*k+1]=hi+1e-12*scale;
+            }
+        }
+      cells.clear();
+      _tree.getIntersectingElems(envelope,cells);
+      const double *cellBBox(_bbox->begin());
+      cells.erase(std::remove_if(cells.begin(),cells.end(),[cellBBox,&bbox](mcIdType cellId) { return bbox.isDisjointWith(cellBBox+2*SPACEDIM*cellId); }),cells.end());
+      std::sort(cells.begin(),cells.end());
+    }
+  private:
+    MCAuto<DataArrayDouble> _bbox;
+    BBTreeFlat<SPACEDIM,mcIdType> _tree;
+  };
+}
+
 template<int SPACEDIM>
 void MEDCouplingUMesh::getCellsContainingPointsAlg(const double *coords, const double *pos, mcIdType nbOfPoints,
                                                    double eps, MCAuto<DataArrayIdType>& elts, MCAuto<DataArrayIdType>& eltsIndex, std::function<bool(INTERP_KERNEL::NormalizedCellType,int)> sensibilityTo2DQuadraticLinearCellsFunc) const
 {
-  // Override precision for this method only:
-  INTERP_KERNEL::QuadraticPlanarPrecision prec(eps);
-
-  elts=DataArrayIdType::New(); eltsIndex=DataArrayIdType::New(); eltsIndex->alloc(nbOfPoints+1,1); eltsIndex->setIJ(0,0,0); elts->alloc(0,1);
+  std::shared_ptr<const MEDCouplingUMeshCellLocator> locator(getCellLocator(eps));
+  const BBTreeFlat<SPACEDIM,mcIdType>& myTree(static_cast<const MEDCouplingUMeshPointLocator<SPACEDIM>&>(*locator).getTree());
+  elts=DataArrayIdType::New(); eltsIndex=DataArrayIdType::New(); eltsIndex->alloc(nbOfPoints+1,1); eltsIndex->setIJ(0,0,0);
   mcIdType *eltsIndexPtr(eltsIndex->getPointer());
-  MCAuto<DataArrayDouble> bboxArr(getBoundingBoxForBBTree(eps));
-  const double *bbox(bboxArr->begin());
-  mcIdType nbOfCells=getNumberOfCells();
   const mcIdType *conn=_nodal_connec->getConstPointer();
   const mcIdType *connI=_nodal_connec_index->getConstPointer();
-  double bb[2*SPACEDIM];
-  BBTree<SPACEDIM,mcIdType> myTree(&bbox[0],0,0,nbOfCells,-eps);
-  for(mcIdType i=0;i<nbOfPoints;i++)
+  // points are dealt by chunks to threads, the cells found for the points of a chunk are concatenated at the end
+  unsigned int nbThreads(INTERP_KERNEL::EffectiveNumberOfThreads(MEDCouplingGetNumberOfThreads()));
+  std::size_t nbOfChunks(nbThreads==1?1:std::min((std::size_t)nbOfPoints,nbThreads*INTERP_KERNEL::NB_OF_CHUNKS_PER_THREAD));
+  std::vector< std::vector<mcIdType> > eltsOfChunks(nbOfChunks);
+  INTERP_KERNEL::ParallelForEachChunk(nbThreads,nbOfChunks,[&](unsigned int, std::size_t chunkId)
     {
-      eltsIndexPtr[i+1]=eltsIndexPtr[i];
-      for(int j=0;j<SPACEDIM;j++)
-        {
-          bb[2*j]=pos[SPACEDIM*i+j];
-          bb[2*j+1]=pos[SPACEDIM*i+j];
-        }
+      // Override precision for this method only (the precision is per thread):
+      INTERP_KERNEL::QuadraticPlanarPrecision prec(eps);
+      mcIdType start,stop;
+      INTERP_KERNEL::ChunkBounds(nbOfPoints,nbOfChunks,chunkId,start,stop);
+      std::vector<mcIdType>& eltsOfChunk(eltsOfChunks[chunkId]);
+      double bb[2*SPACEDIM];
       std::vector<mcIdType> candidates;
-      myTree.getIntersectingElems(bb,candidates);
-      for(std::vector<mcIdType>::const_iterator iter=candidates.begin();iter!=candidates.end();iter++)
+      for(mcIdType i=start;i<stop;i++)
         {
-          mcIdType sz(connI[(*iter)+1]-connI[*iter]-1);
-          INTERP_KERNEL::NormalizedCellType ct((INTERP_KERNEL::NormalizedCellType)conn[connI[*iter]]);
-          bool status(false);
-          // [ABN] : point locator algorithms are not impl. for POLY or QPOLY in spaceDim3
-          if(  SPACEDIM!=2 &&
-              (ct == INTERP_KERNEL::NORM_POLYGON || sensibilityTo2DQuadraticLinearCellsFunc(ct,_mesh_dim)))
-            throw INTERP_KERNEL::Exception("MEDCouplingUMesh::getCellsContainingPointsAlg : not implemented yet for POLYGON and QPOLYGON in spaceDim 3 !");
-          // Keep calling simple algorithm when this is desired and simple for speed reasons:
-          if (SPACEDIM == 2 && ct != INTERP_KERNEL::NORM_POLYGON && !sensibilityTo2DQuadraticLinearCellsFunc(ct,_mesh_dim))
-            status=INTERP_KERNEL::PointLocatorAlgos<DummyClsMCUG<2> >::isElementContainsPointAlgo2DSimple2(pos+i*SPACEDIM,ct,coords,conn+connI[*iter]+1,sz,eps);
-          else
-            status=INTERP_KERNEL::PointLocatorAlgos<DummyClsMCUG<SPACEDIM> >::isElementContainsPoint(pos+i*SPACEDIM,ct,coords,conn+connI[*iter]+1,sz,eps);
-          if(status)
+          eltsIndexPtr[i+1]=0;
+          for(int j=0;j<SPACEDIM;j++)
+            {
+              bb[2*j]=pos[SPACEDIM*i+j];
+              bb[2*j+1]=pos[SPACEDIM*i+j];
+            }
+          candidates.clear();
+          myTree.getIntersectingElems(bb,candidates);
+          for(std::vector<mcIdType>::const_iterator iter=candidates.begin();iter!=candidates.end();iter++)
             {
-              eltsIndexPtr[i+1]++;
-              elts->pushBackSilent(*iter);
+              mcIdType sz(connI[(*iter)+1]-connI[*iter]-1);
+              INTERP_KERNEL::NormalizedCellType ct((INTERP_KERNEL::NormalizedCellType)conn[connI[*iter]]);
+              bool status(false);
+              // [ABN] : point locator algorithms are not impl. for POLY or QPOLY in spaceDim3
+              if(  SPACEDIM!=2 &&
+                  (ct == INTERP_KERNEL::NORM_POLYGON || sensibilityTo2DQuadraticLinearCellsFunc(ct,_mesh_dim)))
+                throw INTERP_KERNEL::Exception("MEDCouplingUMesh::getCellsContainingPointsAlg : not implemented yet for POLYGON and QPOLYGON in spaceDim 3 !");
+              // Keep calling simple algorithm when this is desired and simple for speed reasons:
+              if (SPACEDIM == 2 && ct != INTERP_KERNEL::NORM_POLYGON && !sensibilityTo2DQuadraticLinearCellsFunc(ct,_mesh_dim))
+                status=INTERP_KERNEL::PointLocatorAlgos<DummyClsMCUG<2> >::isElementContainsPointAlgo2DSimple2(pos+i*SPACEDIM,ct,coords,conn+connI[*iter]+1,sz,eps);
+              else
+                status=INTERP_KERNEL::PointLocatorAlgos<DummyClsMCUG<SPACEDIM> >::isElementContainsPoint(pos+i*SPACEDIM,ct,coords,conn+connI[*iter]+1,sz,eps);
+              if(status)
+                {
+                  eltsIndexPtr[i+1]++;
+                  eltsOfChunk.push_back(*iter);
+                }
             }
         }
-    }
+    });
+  std::partial_sum(eltsIndexPtr,eltsIndexPtr+nbOfPoints+1,eltsIndexPtr);
+  elts->alloc(eltsIndexPtr[nbOfPoints],1);
+  mcIdType *eltsPtr(elts->getPointer());
+  for(std::vector< std::vector<mcIdType> >::const_iterator it=eltsOfChunks.begin();it!=eltsOfChunks.end();it++)
+    eltsPtr=std::copy((*it).begin(),(*it).end(),eltsPtr);
 }
 
 /*!
@@ -159,55 +290,87 @@ MEDCouplingUMesh *MEDCouplingUMesh::buildDescendingConnectivityGen(DataArrayIdTy
   checkConnectivityFullyDefined();
   mcIdType nbOfCells=getNumberOfCells();
   mcIdType nbOfNodes=getNumberOfNodes();
-  MCAuto<DataArrayIdType> revNodalIndx=DataArrayIdType::New(); revNodalIndx->alloc(nbOfNodes+1,1); revNodalIndx->fillWithZero();
-  mcIdType *revNodalIndxPtr=revNodalIndx->getPointer();
   const mcIdType *conn=_nodal_connec->getConstPointer();
   const mcIdType *connIndex=_nodal_connec_index->getConstPointer();
   std::string name="Mesh constituent of "; name+=getName();
   MCAuto<MEDCouplingUMesh> ret=MEDCouplingUMesh::New(name,getMeshDimension()-SonsGenerator::DELTA);
   ret->setCoords(getCoords());
-  ret->allocateCells(2*nbOfCells);
+  // sons are generated in 2 passes over ranges of cells : the first one counts them and the size of their connectivity,
+  // the second one writes them at their final place
+  unsigned int nbThreads(NumberOfThreadsFor(nbOfCells));
   descIndx->alloc(nbOfCells+1,1);
-  MCAuto<DataArrayIdType> revDesc2(DataArrayIdType::New()); revDesc2->reserve(2*nbOfCells);
-  mcIdType *descIndxPtr=descIndx->getPointer(); *descIndxPtr++=0;
-  for(mcIdType eltId=0;eltId<nbOfCells;eltId++,descIndxPtr++)
+  mcIdType *descIndxPtr=descIndx->getPointer(); descIndxPtr[0]=0;
+  std::vector<mcIdType> connSzM1(nbOfCells+1,0);
+  mcIdType meshDimM1(ret->getMeshDimension());
+  ParallelForEachRange(nbThreads,nbOfCells,[&](std::size_t, std::size_t start, std::size_t stop)
     {
-      mcIdType pos=connIndex[eltId];
-      mcIdType posP1=connIndex[eltId+1];
-      const INTERP_KERNEL::CellModel& cm=INTERP_KERNEL::CellModel::GetCellModel((INTERP_KERNEL::NormalizedCellType)conn[pos]);
-      SonsGenerator sg(cm);
-      unsigned nbOfSons=sg.getNumberOfSons2(conn+pos+1,posP1-pos-1);
-      INTERP_KERNEL::AutoPtr<mcIdType> tmp=new mcIdType[posP1-pos];
-      for(unsigned i=0;i<nbOfSons;i++)
+      INTERP_KERNEL::AutoPtr<mcIdType> tmp;
+      mcIdType tmpSz(0);
+      for(mcIdType eltId=(mcIdType)start;eltId<(mcIdType)stop;eltId++)
         {
-          INTERP_KERNEL::NormalizedCellType cmsId;
-          unsigned nbOfNodesSon=sg.fillSonCellNodalConnectivity2(i,conn+pos+1,posP1-pos-1,tmp,cmsId);
-          for(unsigned k=0;k<nbOfNodesSon;k++)
-            if(tmp[k]>=0)
-              revNodalIndxPtr[tmp[k]+1]++;
-          ret->insertNextCell(cmsId,nbOfNodesSon,tmp);
-          revDesc2->pushBackSilent(eltId);
+          mcIdType pos=connIndex[eltId];
+          mcIdType posP1=connIndex[eltId+1];
+          if(posP1-pos>tmpSz)
+            { tmpSz=posP1-pos; tmp=new mcIdType[tmpSz]; }
+          const INTERP_KERNEL::CellModel& cm=INTERP_KERNEL::CellModel::GetCellModel((INTERP_KERNEL::NormalizedCellType)conn[pos]);
+          SonsGenerator sg(cm);
+          unsigned nbOfSons=sg.getNumberOfSons2(conn+pos+1,posP1-pos-1);
+          mcIdType sz(0);
+          for(unsigned i=0;i<nbOfSons;i++)
+            {
+              INTERP_KERNEL::NormalizedCellType cmsId;
+              unsigned nbOfNodesSon=sg.fillSonCellNodalConnectivity2(i,conn+pos+1,posP1-pos-1,tmp,cmsId);
+              const INTERP_KERNEL::CellModel& cms=INTERP_KERNEL::CellModel::GetCellModel(cmsId);
+              if(ToIdType(cms.getDimension())!=meshDimM1 || (!cms.isDynamic() && nbOfNodesSon!=cms.getNumberOfNodes()))
+                {
+                  std::ostringstream oss; oss << "MEDCouplingUMesh::buildDescendingConnectivityGen : son #" << i << " of cell #" << eltId << " is a " << cms.getRepr() << " cell with " << nbOfNodesSon << " nodes";
+                  oss << " not compatible with the mesh dimension " << meshDimM1 << " !";
+                  throw INTERP_KERNEL::Exception(oss.str());
+                }
+              sz+=ToIdType(nbOfNodesSon)+1;
+            }
+          descIndxPtr[eltId+1]=ToIdType(nbOfSons);
+          connSzM1[eltId+1]=sz;
         }
-      descIndxPtr[0]=descIndxPtr[-1]+ToIdType(nbOfSons);
-    }
-  mcIdType nbOfCellsM1=ret->getNumberOfCells();
-  std::transform(revNodalIndxPtr+1,revNodalIndxPtr+nbOfNodes+1,revNodalIndxPtr,revNodalIndxPtr+1,std::plus<mcIdType>());
-  MCAuto<DataArrayIdType> revNodal=DataArrayIdType::New(); revNodal->alloc(revNodalIndx->back(),1);
-  std::fill(revNodal->getPointer(),revNodal->getPointer()+revNodalIndx->back(),-1);
-  mcIdType *revNodalPtr=revNodal->getPointer();
-  const mcIdType *connM1=ret->getNodalConnectivity()->getConstPointer();
-  const mcIdType *connIndexM1=ret->getNodalConnectivityIndex()->getConstPointer();
-  for(mcIdType eltId=0;eltId<nbOfCellsM1;eltId++)
+    });
+  std::partial_sum(descIndxPtr,descIndxPtr+nbOfCells+1,descIndxPtr);
+  std::partial_sum(connSzM1.begin(),connSzM1.end(),connSzM1.begin());
+  mcIdType nbOfCellsM1(descIndxPtr[nbOfCells]);
+  MCAuto<DataArrayIdType> connM1Arr(DataArrayIdType::New()),connIndexM1Arr(DataArrayIdType::New()),revDesc2(DataArrayIdType::New());
+  connM1Arr->alloc(connSzM1.back(),1); connIndexM1Arr->alloc(nbOfCellsM1+1,1); revDesc2->alloc(nbOfCellsM1,1);
+  mcIdType *connM1Ptr(connM1Arr->getPointer()),*connIndexM1Ptr(connIndexM1Arr->getPointer()),*revDesc2Ptr(revDesc2->getPointer());
+  connIndexM1Ptr[nbOfCellsM1]=connSzM1.back();
+  ParallelForEachRange(nbThreads,nbOfCells,[&](std::size_t, std::size_t start, std::size_t stop)
     {
-      const mcIdType *strtNdlConnOfCurCell=connM1+connIndexM1[eltId]+1;
-      const mcIdType *endNdlConnOfCurCell=connM1+connIndexM1[eltId+1];
-      for(const mcIdType *iter=strtNdlConnOfCurCell;iter!=endNdlConnOfCurCell;iter++)
-        if(*iter>=0)//for polyhedrons
-          *std::find_if(revNodalPtr+revNodalIndxPtr[*iter],revNodalPtr+revNodalIndxPtr[*iter+1],std::bind(std::equal_to<mcIdType>(),std::placeholders::_1,-1))=eltId;
-    }
+      for(mcIdType eltId=(mcIdType)start;eltId<(mcIdType)stop;eltId++)
+        {
+          mcIdType pos=connIndex[eltId];
+          mcIdType posP1=connIndex[eltId+1];
+          const INTERP_KERNEL::CellModel& cm=INTERP_KERNEL::CellModel::GetCellModel((INTERP_KERNEL::NormalizedCellType)conn[pos]);
+          SonsGenerator sg(cm);
+          mcIdType sonId(descIndxPtr[eltId]),sonPos(connSzM1[eltId]);
+          for(unsigned i=0;i<(unsigned)(descIndxPtr[eltId+1]-descIndxPtr[eltId]);i++,sonId++)
+            {
+              INTERP_KERNEL::NormalizedCellType cmsId;
+              unsigned nbOfNodesSon=sg.fillSonCellNodalConnectivity2(i,conn+pos+1,posP1-pos-1,connM1Ptr+sonPos+1,cmsId);
+              connM1Ptr[sonPos]=ToIdType(cmsId);
+              connIndexM1Ptr[sonId]=sonPos;
+              revDesc2Ptr[sonId]=eltId;
+              sonPos+=ToIdType(nbOfNodesSon)+1;
+            }
+        }
+    });
+  ret->setConnectivity(connM1Arr,connIndexM1Arr,true);
+  const mcIdType *connM1=connM1Arr->getConstPointer();
+  const mcIdType *connIndexM1=connIndexM1Arr->getConstPointer();
   //
   DataArrayIdType *commonCells=0,*commonCellsI=0;
-  FindCommonCellsAlg(3,0,ret->getNodalConnectivity(),ret->getNodalConnectivityIndex(),revNodal,revNodalIndx,commonCells,commonCellsI);
+  if(!FindCellsWithSameNodes(connM1,connIndexM1,nbOfCellsM1,commonCells,commonCellsI))
+    {// some sons have repeated or negative node ids : keep the generic algorithm that handles them
+      MCAuto<DataArrayIdType> revNodal(DataArrayIdType::New()),revNodalIndx(DataArrayIdType::New());
+      ComputeReverseNodalConnectivity(connM1,connIndexM1,nbOfCellsM1,nbOfNodes,revNodal,revNodalIndx);
+      FindCommonCellsAlg(3,0,connM1Arr,connIndexM1Arr,revNodal,revNodalIndx,commonCells,commonCellsI);
+    }
   MCAuto<DataArrayIdType> commonCellsTmp(commonCells),commonCellsITmp(commonCellsI);
   const mcIdType *commonCellsPtr(commonCells->getConstPointer()),*commonCellsIPtr(commonCellsI->getConstPointer());
   mcIdType newNbOfCellsM1=-1;
@@ -243,7 +406,6 @@ MEDCouplingUMesh *MEDCouplingUMesh::buildDescendingConnectivityGen(DataArrayIdTy
   revDesc->reserve(newNbOfCellsM1);
   revDescIndx->alloc(newNbOfCellsM1+1,1);
   mcIdType *revDescIndxPtr=revDescIndx->getPointer(); *revDescIndxPtr++=0;
-  const mcIdType *revDesc2Ptr=revDesc2->getConstPointer();
   for(mcIdType i=0;i<newNbOfCellsM1;i++,revDescIndxPtr++)
     {
       mcIdType oldCellIdM1=n2oM1Ptr[i];
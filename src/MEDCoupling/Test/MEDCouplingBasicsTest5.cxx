@@ -28,10 +28,19 @@
 #include "MEDCouplingGaussLocalization.hxx"
 #include "MEDCouplingMultiFields.hxx"
 #include "MEDCouplingFieldOverTime.hxx"
+#include "MEDCouplingSkyLineArray.hxx"
+#include "MEDCouplingMemoryPool.hxx"
+#include "DirectedBoundingBox.hxx"
+
+#include "InterpKernelExprParser.hxx"
 
 #include <cmath>
 #include <functional>
+#include <cstdio>
+#include <fstream>
 #include <iterator>
+#include <limits>
+#include <thread>
 
 using namespace MEDCoupling;
 
@@ -2056,3 +2065,600 @@ void MEDCouplingBasicsTest5::testSimplexize3()
   //
   m->decrRef();
 }
+
+/*!
+ * applyFunc and its variants evaluate expressions by blocks of tuples and possibly with several threads. Results must be
+ * exactly those of the tuple by tuple evaluation, whatever the number of threads.
+ */
+void MEDCouplingBasicsTest5::testApplyFuncMultiThreaded1()
+{
+  const int nbOfTuples=5000;
+  MCAuto<DataArrayDouble> arr(DataArrayDouble::New());
+  arr->alloc(nbOfTuples,3);
+  for(int i=0;i<nbOfTuples;i++)
+    {
+      arr->setIJ(i,0,0.001*i-1.7); arr->setIJ(i,1,std::sin(0.01*i)); arr->setIJ(i,2,0.5+std::cos(0.003*i));
+    }
+  arr->setInfoOnComponent(0,"x"); arr->setInfoOnComponent(1,"y"); arr->setInfoOnComponent(2,"z");
+  const char FUNC[]="max(x,y)*exp(-y*y)-min(y,z)*min(y,z)*IVec+cos(x*y+z)*JVec+log10(z+1.6)*KVec+atan(y)/z";
+  // reference : tuple by tuple evaluation
+  std::vector<double> ref(3*nbOfTuples),ref2(3*nbOfTuples);
+  {
+    INTERP_KERNEL::ExprParser expr(FUNC);
+    expr.parse();
+    std::vector<std::string> vars(arr->getVarsOnComponent());
+    std::vector<double> buff(3),stck;
+    for(int iComp=0;iComp<3;iComp++)
+      {
+        expr.prepareExprEvaluationDouble(vars,3,3,iComp,&buff[0],&buff[0]+3);
+        expr.prepareFastEvaluator();
+        for(int i=0;i<nbOfTuples;i++)
+          {
+            std::copy(arr->begin()+3*i,arr->begin()+3*(i+1),buff.begin());
+            expr.evaluateDoubleInternal(stck);
+            ref[3*i+iComp]=stck.back();
+            stck.pop_back();
+          }
+      }
+    INTERP_KERNEL::ExprParser expr2("if(u>0.3,2.*sin(u)-u*u*u,abs(u)^1.5)");
+    expr2.parse();
+    std::vector<std::string> vars2(1,"u");
+    expr2.prepareExprEvaluationDouble(vars2,1,1,0,&buff[0],&buff[0]+1);
+    expr2.prepareFastEvaluator();
+    for(int i=0;i<3*nbOfTuples;i++)
+      {
+        buff[0]=arr->begin()[i];
+        expr2.evaluateDoubleInternal(stck);
+        ref2[i]=stck.back();
+        stck.pop_back();
+      }
+  }
+  const int NB_THREADS[3]={1,3,0};
+  for(int t=0;t<3;t++)
+    {
+      MEDCouplingSetNumberOfThreads(NB_THREADS[t]);
+      CPPUNIT_ASSERT_EQUAL(NB_THREADS[t],MEDCouplingGetNumberOfThreads());
+      for(int safe=0;safe<2;safe++)
+        {
+          MCAuto<DataArrayDouble> res(arr->applyFuncCompo(3,FUNC,safe==1));
+          CPPUNIT_ASSERT_EQUAL(nbOfTuples,(int)res->getNumberOfTuples());
+          CPPUNIT_ASSERT(std::equal(ref.begin(),ref.end(),res->begin()));// bit to bit identical
+          MCAuto<DataArrayDouble> res2(arr->applyFunc("if(u>0.3,2.*sin(u)-u*u*u,abs(u)^1.5)",safe==1));
+          CPPUNIT_ASSERT(std::equal(ref2.begin(),ref2.end(),res2->begin()));
+          MCAuto<DataArrayDouble> res3(arr->deepCopy());
+          res3->applyFuncOnThis("if(u>0.3,2.*sin(u)-u*u*u,abs(u)^1.5)",safe==1);
+          CPPUNIT_ASSERT(res2->isEqualWithoutConsideringStr(*res3,0.));
+        }
+      // error in safe mode : the tuple is reported and applyFuncOnThis has modified the values before it, as the tuple by tuple evaluation does
+      MCAuto<DataArrayDouble> res4(arr->deepCopy());
+      res4->setIJ(4321,0,-3.);
+      MCAuto<DataArrayDouble> res5(res4->deepCopy());
+      res5->applyFuncOnThis("sqrt(u+2.)",false);
+      try
+        {
+          res4->applyFuncOnThis("sqrt(u+2.)",true);
+          CPPUNIT_FAIL("An exception should have been thrown !");
+        }
+      catch(INTERP_KERNEL::Exception& e)
+        {
+          CPPUNIT_ASSERT(std::string(e.what()).find("For tuple # 4321 component # 0")!=std::string::npos);
+        }
+      CPPUNIT_ASSERT(std::equal(res5->begin(),res5->begin()+3*4321,res4->begin()));
+      CPPUNIT_ASSERT_EQUAL(-3.,res4->getIJ(4321,0));
+      res4=arr->deepCopy();
+      res4->setIJ(4321,0,-3.);
+      try
+        {
+          MCAuto<DataArrayDouble> res7(res4->applyFuncCompo(1,"sqrt(x+2.)",true));
+          CPPUNIT_FAIL("An exception should have been thrown !");
+        }
+      catch(INTERP_KERNEL::Exception& e)
+        {
+          CPPUNIT_ASSERT(std::string(e.what()).find("For tuple # 4321 with value (-3, ")!=std::string::npos);
+        }
+      MCAuto<DataArrayDouble> res6(res4->applyFuncCompo(1,"sqrt(x+2.)",false));
+      CPPUNIT_ASSERT(std::isnan(res6->getIJ(4321,0)));
+    }
+  MEDCouplingSetNumberOfThreads(1);
+}
+
+/*!
+ * Sort, unique and set operations of DataArrayIdType switch to multi threaded radix sort based implementations on big arrays.
+ * Results must be the ones of the serial std:: algorithms, whatever the number of threads.
+ */
+void MEDCouplingBasicsTest5::testDAISortAndSetOperationsMultiThreaded1()
+{
+  const mcIdType nbOfTuples=100000;
+  std::vector<mcIdType> vals(nbOfTuples),perm(nbOfTuples);
+  for(mcIdType i=0;i<nbOfTuples;i++)
+    {
+      vals[i]=(i*7919)%30011-15000;
+      perm[i]=(i*7919)%nbOfTuples;// 7919 is prime so perm is a permutation of [0,nbOfTuples)
+    }
+  std::vector<mcIdType> sortedRef(vals),uniqueRef;
+  std::sort(sortedRef.begin(),sortedRef.end());
+  std::unique_copy(sortedRef.begin(),sortedRef.end(),std::back_inserter(uniqueRef));
+  std::vector<mcIdType> groupsRef(1,0);
+  for(mcIdType i=1;i<=nbOfTuples;i++)
+    if(i==nbOfTuples || sortedRef[i]!=sortedRef[i-1])
+      groupsRef.push_back(i);
+  std::vector<mcIdType> evenRef,oddRef;
+  for(std::vector<mcIdType>::const_iterator it=uniqueRef.begin();it!=uniqueRef.end();it++)
+    ((*it)%2==0?evenRef:oddRef).push_back(*it);
+  MCAuto<DataArrayIdType> arr(DataArrayIdType::New()); arr->alloc(nbOfTuples,1);
+  std::copy(vals.begin(),vals.end(),arr->getPointer());
+  MCAuto<DataArrayIdType> p(DataArrayIdType::New()); p->alloc(nbOfTuples,1);
+  std::copy(perm.begin(),perm.end(),p->getPointer());
+  MCAuto<DataArrayIdType> even(DataArrayIdType::New()); even->alloc(0,1);
+  for(std::vector<mcIdType>::const_iterator it=uniqueRef.begin();it!=uniqueRef.end();it++)
+    if((*it)%2==0)
+      even->pushBackSilent(*it);
+  const int NB_THREADS[3]={1,3,0};
+  for(int t=0;t<3;t++)
+    {
+      MEDCouplingSetNumberOfThreads(NB_THREADS[t]);
+      MCAuto<DataArrayIdType> sorted(arr->copySorted());
+      CPPUNIT_ASSERT(std::equal(sortedRef.begin(),sortedRef.end(),sorted->begin()));
+      MCAuto<DataArrayIdType> sortedDesc(arr->copySorted(false));
+      CPPUNIT_ASSERT(std::equal(sortedRef.rbegin(),sortedRef.rend(),sortedDesc->begin()));
+      MCAuto<DataArrayIdType> uniq(sorted->buildUnique());
+      CPPUNIT_ASSERT_EQUAL((mcIdType)uniqueRef.size(),uniq->getNumberOfTuples());
+      CPPUNIT_ASSERT(std::equal(uniqueRef.begin(),uniqueRef.end(),uniq->begin()));
+      MCAuto<DataArrayIdType> uniq2(arr->buildUniqueNotSorted());
+      CPPUNIT_ASSERT(uniq2->isEqualWithoutConsideringStrAndOrder(*uniq));
+      MCAuto<DataArrayIdType> groups(sorted->indexOfSameConsecutiveValueGroups());
+      CPPUNIT_ASSERT_EQUAL((mcIdType)groupsRef.size(),groups->getNumberOfTuples());
+      CPPUNIT_ASSERT(std::equal(groupsRef.begin(),groupsRef.end(),groups->begin()));
+      MCAuto<DataArrayIdType> odd(arr->buildSubstraction(even));
+      CPPUNIT_ASSERT_EQUAL((mcIdType)oddRef.size(),odd->getNumberOfTuples());
+      CPPUNIT_ASSERT(std::equal(oddRef.begin(),oddRef.end(),odd->begin()));
+      MCAuto<DataArrayIdType> inter(arr->buildIntersection(even));
+      CPPUNIT_ASSERT(inter->isEqualWithoutConsideringStr(*even));
+      MCAuto<DataArrayIdType> uni(odd->buildUnion(even));
+      CPPUNIT_ASSERT(uni->isEqualWithoutConsideringStr(*uniq));
+      // permutations
+      MCAuto<DataArrayIdType> o2n(p->checkAndPreparePermutation());
+      CPPUNIT_ASSERT(o2n->isEqualWithoutConsideringStr(*p));
+      MCAuto<DataArrayIdType> shuffled(arr->renumber(p->begin()));
+      MCAuto<DataArrayIdType> permFound(DataArrayIdType::FindPermutationFromFirstToSecond(p,o2n));
+      MCAuto<DataArrayIdType> iota(DataArrayIdType::New()); iota->alloc(nbOfTuples,1); iota->iota();
+      CPPUNIT_ASSERT(permFound->isEqualWithoutConsideringStr(*iota));
+      MCAuto<DataArrayIdType> pInv(p->invertArrayO2N2N2O(nbOfTuples));
+      permFound=DataArrayIdType::FindPermutationFromFirstToSecond(p,pInv);
+      MCAuto<DataArrayIdType> pRenum(p->renumber(permFound->begin()));
+      CPPUNIT_ASSERT(pRenum->isEqualWithoutConsideringStr(*pInv));
+      CPPUNIT_ASSERT_THROW(arr->checkAndPreparePermutation(),INTERP_KERNEL::Exception);
+      CPPUNIT_ASSERT_THROW(DataArrayIdType::FindPermutationFromFirstToSecond(arr,shuffled),INTERP_KERNEL::Exception);
+    }
+  MEDCouplingSetNumberOfThreads(1);
+}
+
+/*!
+ * getReverseNodalConnectivity and buildDescendingConnectivity are multi threaded. Their outputs must not depend on the number of threads.
+ */
+void MEDCouplingBasicsTest5::testReverseNodalAndDescendingConnectivityMultiThreaded1()
+{
+  const int nbOfNodesPerDir=36;
+  MCAuto<MEDCouplingCMesh> cm(MEDCouplingCMesh::New());
+  MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(nbOfNodesPerDir,1); arr->iota();
+  cm->setCoords(arr,arr,arr);
+  MCAuto<MEDCouplingUMesh> m(cm->buildUnstructured());
+  std::vector<mcIdType> polyIds;
+  for(mcIdType i=0;i<m->getNumberOfCells();i+=7)
+    polyIds.push_back(i);
+  m->convertToPolyTypes(&polyIds[0],&polyIds[0]+polyIds.size());
+  mcIdType nbOfCells(m->getNumberOfCells()),nbOfNodes(m->getNumberOfNodes());
+  // reference reverse nodal connectivity
+  std::vector< std::vector<mcIdType> > revNodalRef(nbOfNodes);
+  for(mcIdType i=0;i<nbOfCells;i++)
+    {
+      std::vector<mcIdType> conn;
+      m->getNodeIdsOfCell(i,conn);
+      for(std::vector<mcIdType>::const_iterator it=conn.begin();it!=conn.end();it++)
+        if(*it>=0)
+          revNodalRef[*it].push_back(i);
+    }
+  MCAuto<DataArrayIdType> descRef,descIndxRef,revDescRef,revDescIndxRef;
+  MCAuto<MEDCouplingUMesh> mDescRef;
+  const int NB_THREADS[3]={1,3,0};
+  for(int t=0;t<3;t++)
+    {
+      MEDCouplingSetNumberOfThreads(NB_THREADS[t]);
+      MCAuto<DataArrayIdType> revNodal(DataArrayIdType::New()),revNodalIndx(DataArrayIdType::New());
+      m->getReverseNodalConnectivity(revNodal,revNodalIndx);
+      CPPUNIT_ASSERT_EQUAL(nbOfNodes+1,revNodalIndx->getNumberOfTuples());
+      for(mcIdType i=0;i<nbOfNodes;i++)
+        {
+          CPPUNIT_ASSERT_EQUAL((mcIdType)revNodalRef[i].size(),revNodalIndx->getIJ(i+1,0)-revNodalIndx->getIJ(i,0));
+          CPPUNIT_ASSERT(std::equal(revNodalRef[i].begin(),revNodalRef[i].end(),revNodal->begin()+revNodalIndx->getIJ(i,0)));
+        }
+      MCAuto<DataArrayIdType> desc(DataArrayIdType::New()),descIndx(DataArrayIdType::New()),revDesc(DataArrayIdType::New()),revDescIndx(DataArrayIdType::New());
+      MCAuto<MEDCouplingUMesh> mDesc(m->buildDescendingConnectivity(desc,descIndx,revDesc,revDescIndx));
+      CPPUNIT_ASSERT_EQUAL((mcIdType)3*nbOfNodesPerDir*(nbOfNodesPerDir-1)*(nbOfNodesPerDir-1),mDesc->getNumberOfCells());
+      if(t==0)
+        {
+          descRef=desc; descIndxRef=descIndx; revDescRef=revDesc; revDescIndxRef=revDescIndx; mDescRef=mDesc;
+          continue;
+        }
+      CPPUNIT_ASSERT(mDesc->isEqual(mDescRef,0.));
+      CPPUNIT_ASSERT(desc->isEqual(*descRef));
+      CPPUNIT_ASSERT(descIndx->isEqual(*descIndxRef));
+      CPPUNIT_ASSERT(revDesc->isEqual(*revDescRef));
+      CPPUNIT_ASSERT(revDescIndx->isEqual(*revDescIndxRef));
+    }
+  MEDCouplingSetNumberOfThreads(1);
+}
+
+/*!
+ * The trees used by getCellsContainingPoints and distanceToPoints are kept by the mesh between calls and rebuilt when the mesh is modified.
+ * Point location and distance computations are multi threaded.
+ */
+void MEDCouplingBasicsTest5::testCellLocatorCache1()
+{
+  const int nbOfNodesPerDir=41,nbOfPts=2000;
+  MCAuto<MEDCouplingCMesh> cm(MEDCouplingCMesh::New());
+  MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(nbOfNodesPerDir,1); arr->iota();
+  cm->setCoords(arr,arr);
+  MCAuto<MEDCouplingUMesh> m(cm->buildUnstructured());
+  MCAuto<DataArrayDouble> pts(DataArrayDouble::New()); pts->alloc(nbOfPts,2);
+  for(int i=0;i<nbOfPts;i++)
+    {// some points are on nodes or edges, some are out of the mesh
+      pts->setIJ(i,0,(double)((i*37)%(4*nbOfNodesPerDir+4))/4.-0.5);
+      pts->setIJ(i,1,(double)((i*53)%(3*nbOfNodesPerDir))/3.+0.1);
+    }
+  // reference computed cell by cell
+  std::vector<mcIdType> eltsRef,eltsIndexRef(1,0);
+  for(int i=0;i<nbOfPts;i++)
+    {
+      double x(pts->getIJ(i,0)),y(pts->getIJ(i,1));
+      for(mcIdType j=0;j<(nbOfNodesPerDir-1)*(nbOfNodesPerDir-1);j++)
+        {
+          double x0((double)(j%(nbOfNodesPerDir-1))),y0((double)(j/(nbOfNodesPerDir-1)));
+          if(x>=x0-1e-12 && x<=x0+1.+1e-12 && y>=y0-1e-12 && y<=y0+1.+1e-12)
+            eltsRef.push_back(j);
+        }
+      eltsIndexRef.push_back((mcIdType)eltsRef.size());
+    }
+  const int NB_THREADS[3]={1,3,0};
+  for(int t=0;t<3;t++)
+    {
+      MEDCouplingSetNumberOfThreads(NB_THREADS[t]);
+      for(int iter=0;iter<2;iter++)
+        {// second iteration reuses the tree
+          MCAuto<DataArrayIdType> elts,eltsIndex;
+          m->getCellsContainingPoints(pts->begin(),nbOfPts,1e-12,elts,eltsIndex);
+          CPPUNIT_ASSERT_EQUAL((mcIdType)nbOfPts+1,eltsIndex->getNumberOfTuples());
+          CPPUNIT_ASSERT(std::equal(eltsIndexRef.begin(),eltsIndexRef.end(),eltsIndex->begin()));
+          CPPUNIT_ASSERT_EQUAL((mcIdType)eltsRef.size(),elts->getNumberOfTuples());
+          CPPUNIT_ASSERT(std::equal(eltsRef.begin(),eltsRef.end(),elts->begin()));
+        }
+    }
+  const double pt0[2]={2.5,1.5},pt1[2]={-2.,0.1};
+  CPPUNIT_ASSERT_EQUAL((mcIdType)(nbOfNodesPerDir-1+2),m->getCellContainingPoint(pt0,1e-12));
+  // the tree has to be rebuilt after a modification of the mesh
+  const double vec[2]={1000.,0.};
+  m->translate(vec);
+  CPPUNIT_ASSERT_EQUAL((mcIdType)-1,m->getCellContainingPoint(pt0,1e-12));
+  const double vec2[2]={-1000.,0.};
+  m->translate(vec2);
+  CPPUNIT_ASSERT_EQUAL((mcIdType)(nbOfNodesPerDir-1+2),m->getCellContainingPoint(pt0,1e-12));
+  // and also after a modification in place of the coordinates declared with declareAsNew
+  CPPUNIT_ASSERT_EQUAL((mcIdType)-1,m->getCellContainingPoint(pt1,1e-12));
+  m->getCoords()->getPointer()[0]=-3.;
+  m->getCoords()->declareAsNew();
+  CPPUNIT_ASSERT_EQUAL((mcIdType)0,m->getCellContainingPoint(pt1,1e-12));
+  // distanceToPoints on a curve
+  MCAuto<MEDCouplingUMesh> m2(cm->buildUnstructured());
+  MCAuto<MEDCouplingUMesh> skin(m2->computeSkin());
+  MCAuto<DataArrayDouble> dstRef;
+  MCAuto<DataArrayIdType> cellIdsRef;
+  for(int t=0;t<3;t++)
+    {
+      MEDCouplingSetNumberOfThreads(NB_THREADS[t]);
+      DataArrayIdType *cellIds(0);
+      MCAuto<DataArrayDouble> dst(skin->distanceToPoints(pts,cellIds));
+      MCAuto<DataArrayIdType> cellIdsSafe(cellIds);
+      if(t==0)
+        {
+          dstRef=dst; cellIdsRef=cellIdsSafe;
+          CPPUNIT_ASSERT_DOUBLES_EQUAL(0.5,dst->getIJ(0,0),1e-12);// point (-0.5,0.1)
+          continue;
+        }
+      CPPUNIT_ASSERT(dst->isEqual(*dstRef,0.));
+      CPPUNIT_ASSERT(cellIdsSafe->isEqual(*cellIdsRef));
+    }
+  const double vec3[2]={-1.5,-1.5};
+  skin->translate(vec3);
+  mcIdType cellId(-1);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.,skin->distanceToPoint(pts->begin(),pts->begin()+2,cellId),1e-12);
+  MEDCouplingSetNumberOfThreads(1);
+}
+
+void MEDCouplingBasicsTest5::testCellsInBoundingBoxes1()
+{
+  const int nbOfNodesPerDir=9,nbOfBoxes=300;
+  MCAuto<MEDCouplingCMesh> cm(MEDCouplingCMesh::New());
+  MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(nbOfNodesPerDir,1); arr->iota();
+  cm->setCoords(arr,arr,arr);
+  MCAuto<MEDCouplingUMesh> m(cm->buildUnstructured());
+  MCAuto<DataArrayDouble> cellBBoxes(m->getBoundingBoxForBBTreeFast());
+  const mcIdType nbOfCells(m->getNumberOfCells());
+  MCAuto<DataArrayDouble> bboxes(DataArrayDouble::New()); bboxes->alloc(nbOfBoxes,6);
+  for(int i=0;i<nbOfBoxes;i++)
+    for(int j=0;j<3;j++)
+      {// some boxes have faces on the faces of the cells, some are partly out of the mesh
+        double lo((double)((i*(31+7*j))%(4*nbOfNodesPerDir+4))/4.-1.);
+        bboxes->setIJ(i,2*j,lo);
+        bboxes->setIJ(i,2*j+1,lo+(double)((i*(13+5*j))%12)/4.);
+      }
+  // reference computed cell by cell, the cells being unit cubes their bounding boxes are enlarged by eps
+  const double eps(1e-12);
+  auto enlargedBBoxOfCell=[&cellBBoxes](mcIdType cellId, double e, double *bb) { for(int k=0;k<6;k++) bb[k]=cellBBoxes->getIJ(cellId,k)+(k%2==0?-e:e); };
+  double bb[6];
+  std::vector<mcIdType> valueRef,indexRef(1,0);
+  for(int i=0;i<nbOfBoxes;i++)
+    {
+      for(mcIdType j=0;j<nbOfCells;j++)
+        {
+          enlargedBBoxOfCell(j,eps,bb);
+          const double *bbox(bboxes->begin()+6*i);
+          if(bb[0]<bbox[1] && bbox[0]<bb[1] && bb[2]<bbox[3] && bbox[2]<bb[3] && bb[4]<bbox[5] && bbox[4]<bb[5])
+            valueRef.push_back(j);
+        }
+      indexRef.push_back((mcIdType)valueRef.size());
+    }
+  CPPUNIT_ASSERT(valueRef.size()>(std::size_t)nbOfBoxes);
+  const int NB_THREADS[3]={1,3,0};
+  for(int t=0;t<3;t++)
+    {
+      MEDCouplingSetNumberOfThreads(NB_THREADS[t]);
+      MCAuto<MEDCouplingSkyLineArray> res(m->getCellsInBoundingBoxes(bboxes,eps));
+      CPPUNIT_ASSERT_EQUAL((mcIdType)nbOfBoxes,res->getNumberOf());
+      CPPUNIT_ASSERT(std::equal(indexRef.begin(),indexRef.end(),res->getIndex()));
+      CPPUNIT_ASSERT_EQUAL((mcIdType)valueRef.size(),res->getLength());
+      CPPUNIT_ASSERT(std::equal(valueRef.begin(),valueRef.end(),res->getValues()));
+    }
+  MEDCouplingSetNumberOfThreads(1);
+  for(int i=0;i<nbOfBoxes;i+=17)
+    {
+      MCAuto<DataArrayIdType> cells(m->getCellsInBoundingBox(bboxes->begin()+6*i,eps));
+      CPPUNIT_ASSERT_EQUAL(indexRef[i+1]-indexRef[i],cells->getNumberOfTuples());
+      CPPUNIT_ASSERT(std::equal(valueRef.begin()+indexRef[i],valueRef.begin()+indexRef[i+1],cells->begin()));
+    }
+  // directed bounding box of a rotated segment
+  const double pts[9]={1.2,0.5,2.3, 4.1,3.7,2.9, 2.2,2.6,6.1};
+  INTERP_KERNEL::DirectedBoundingBox dbb(pts,3,3);
+  std::vector<mcIdType> cellsRef;
+  for(mcIdType j=0;j<nbOfCells;j++)
+    {
+      enlargedBBoxOfCell(j,0.1,bb);
+      if(!dbb.isDisjointWith(bb))
+        cellsRef.push_back(j);
+    }
+  CPPUNIT_ASSERT(!cellsRef.empty() && cellsRef.size()<(std::size_t)nbOfCells);
+  MCAuto<DataArrayIdType> cells(m->getCellsInBoundingBox(dbb,0.1));
+  CPPUNIT_ASSERT_EQUAL((mcIdType)cellsRef.size(),cells->getNumberOfTuples());
+  CPPUNIT_ASSERT(std::equal(cellsRef.begin(),cellsRef.end(),cells->begin()));
+  // the tree has to be rebuilt after a modification of the mesh
+  const double bbox0[6]={0.2,0.8,0.2,0.8,0.2,0.8};
+  cells=m->getCellsInBoundingBox(bbox0,eps);
+  CPPUNIT_ASSERT_EQUAL((mcIdType)1,cells->getNumberOfTuples());
+  CPPUNIT_ASSERT_EQUAL((mcIdType)0,cells->getIJ(0,0));
+  const double vec[3]={1.,0.,0.};
+  m->translate(vec);
+  cells=m->getCellsInBoundingBox(bbox0,eps);
+  CPPUNIT_ASSERT_EQUAL((mcIdType)0,cells->getNumberOfTuples());
+}
+
+void MEDCouplingBasicsTest5::testMemoryPool1()
+{
+  MCAuto<MEDCouplingMemoryPool> pool(MEDCouplingMemoryPool::New());
+  MCAuto<DataArrayIdType> escaping;
+  {
+    MEDCouplingMemoryPoolScope scope(pool);
+    CPPUNIT_ASSERT(MEDCouplingMemoryPool::GetCurrent()==pool);
+    for(int i=0;i<10;i++)
+      {
+        MCAuto<DataArrayIdType> tmp(DataArrayIdType::New()); tmp->alloc(100,1); tmp->iota();
+        MCAuto<DataArrayIdType> tmp2(tmp->deepCopy());
+        CPPUNIT_ASSERT(tmp2->isIota(100));
+      }
+    CPPUNIT_ASSERT_EQUAL((std::size_t)20,pool->getNumberOfAllocations());
+    CPPUNIT_ASSERT_EQUAL((std::size_t)2,pool->getNumberOfSystemAllocations());// all the other blocks are reused
+    CPPUNIT_ASSERT_EQUAL((std::size_t)18,pool->getNumberOfReusedBlocks());
+    CPPUNIT_ASSERT_EQUAL((std::size_t)0,pool->getNumberOfBytesInUse());
+    CPPUNIT_ASSERT(pool->getPeakOfBytesInUse()>=2*100*sizeof(mcIdType));
+    // an array growing by pushBack and an array outliving the scope
+    escaping=DataArrayIdType::New(); escaping->alloc(0,1);
+    for(mcIdType i=0;i<1000;i++)
+      escaping->pushBackSilent(i);
+    CPPUNIT_ASSERT(escaping->isIota(1000));
+    // a thread without scope allocates with malloc
+    MEDCouplingMemoryPool *poolOfThread(pool);
+    std::thread th([&poolOfThread]() { poolOfThread=MEDCouplingMemoryPool::GetCurrent(); });
+    th.join();
+    CPPUNIT_ASSERT(!poolOfThread);
+    // nested scope restoring malloc
+    {
+      MEDCouplingMemoryPoolScope scope2(nullptr);
+      CPPUNIT_ASSERT(!MEDCouplingMemoryPool::GetCurrent());
+    }
+    CPPUNIT_ASSERT(MEDCouplingMemoryPool::GetCurrent()==pool);
+  }
+  CPPUNIT_ASSERT(!MEDCouplingMemoryPool::GetCurrent());
+  CPPUNIT_ASSERT(pool->getNumberOfBytesInUse()>=1000*sizeof(mcIdType));
+  // the chain of temporary arrays of a mesh operation gives the same result in a pool
+  MCAuto<MEDCouplingUMesh> m(build3DSurfTargetMesh_1());
+  const mcIdType cellIds[3]={0,2,3};
+  MCAuto<MEDCouplingUMesh> partRef(m->buildPartOfMySelf(cellIds,cellIds+3,true));
+  partRef->zipCoords();
+  pool->resetCounters();
+  {
+    MEDCouplingMemoryPoolScope scope(pool);
+    for(int i=0;i<3;i++)
+      {
+        MCAuto<MEDCouplingUMesh> part(m->buildPartOfMySelf(cellIds,cellIds+3,true));
+        part->zipCoords();
+        CPPUNIT_ASSERT(part->isEqual(partRef,1e-12));
+      }
+  }
+  CPPUNIT_ASSERT(pool->getNumberOfReusedBlocks()>0);
+  CPPUNIT_ASSERT(pool->getNumberOfSystemAllocations()<pool->getNumberOfAllocations());
+  // big arrays are aligned on huge pages and not kept
+  pool->setHugePageThreshold(1024*1024);
+  pool->resetCounters();
+  {
+    MEDCouplingMemoryPoolScope scope(pool);
+    MCAuto<DataArrayDouble> big(DataArrayDouble::New()); big->alloc(200000,1); big->fillWithValue(3.);
+    CPPUNIT_ASSERT_EQUAL((std::size_t)0,reinterpret_cast<std::size_t>(big->begin())%MEDCouplingMemoryPool::HUGE_PAGE_SIZE);
+    CPPUNIT_ASSERT_EQUAL((std::size_t)1,pool->getNumberOfHugePageAllocations());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(600000.,big->accumulate((std::size_t)0),1e-12);
+  }
+  CPPUNIT_ASSERT(pool->getNumberOfBytesInUse()<MEDCouplingMemoryPool::HUGE_PAGE_SIZE);
+  pool->releaseCachedBlocks();
+  CPPUNIT_ASSERT_EQUAL((std::size_t)0,pool->getNumberOfCachedBytes());
+  // sizes whose rounding to a power of two would overflow are refused
+  CPPUNIT_ASSERT_THROW(pool->setMaxPooledSize(std::numeric_limits<std::size_t>::max()),INTERP_KERNEL::Exception);
+  CPPUNIT_ASSERT_EQUAL((std::size_t)1024*1024,pool->getMaxPooledSize());
+  {
+    MEDCouplingMemoryPool::Deallocator dealloc(nullptr);
+    CPPUNIT_ASSERT_THROW(pool->allocate(std::numeric_limits<std::size_t>::max()-1,dealloc),INTERP_KERNEL::Exception);
+  }
+  // the pool is destroyed only once the last array allocated in it is released
+  MEDCouplingMemoryPool *poolPtr(pool);
+  pool.nullify();
+  CPPUNIT_ASSERT_EQUAL(1,poolPtr->getRCValue());
+  escaping.nullify();
+}
+
+void MEDCouplingBasicsTest5::testMappedRawFiles1()
+{
+  // array read only
+  MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(3000,1); arr->iota(7.); arr->rearrange(3);
+  arr->writeRawFile("mappedRawFiles1.arr",12);
+  MCAuto<DataArrayDouble> arr2(DataArrayDouble::New());
+  CPPUNIT_ASSERT_EQUAL((std::int64_t)12,arr2->useMappedRawFile("mappedRawFiles1.arr"));
+  CPPUNIT_ASSERT_EQUAL((mcIdType)1000,arr2->getNumberOfTuples());
+  CPPUNIT_ASSERT_EQUAL((std::size_t)3,arr2->getNumberOfComponents());
+  CPPUNIT_ASSERT(arr2->isEqual(*arr,0.));
+  CPPUNIT_ASSERT_THROW(arr2->setIJ(0,0,5.),INTERP_KERNEL::Exception);
+  MCAuto<DataArrayDouble> arr3(arr2->deepCopy());
+  arr3->setIJ(0,0,5.);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(7.,arr2->getIJ(0,0),0.);
+  // array copy on write : the file is left unchanged
+  MCAuto<DataArrayDouble> arr4(DataArrayDouble::New());
+  arr4->useMappedRawFile("mappedRawFiles1.arr",true);
+  arr4->setIJ(0,0,5.);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(5.,arr4->getIJ(0,0),0.);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(7.,arr2->getIJ(0,0),0.);
+  arr4->rearrange(1);
+  arr4->pushBackSilent(6.);// the values leave the mapping
+  CPPUNIT_ASSERT_EQUAL((std::size_t)3001,arr4->getNbOfElems());
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(6.,arr4->back(),0.);
+  arr4.nullify();
+  MCAuto<DataArrayDouble> arr5(DataArrayDouble::New());
+  arr5->useMappedRawFile("mappedRawFiles1.arr");
+  CPPUNIT_ASSERT(arr5->isEqual(*arr,0.));
+  // wrong type
+  MCAuto<DataArrayInt64> arr6(DataArrayInt64::New());
+  CPPUNIT_ASSERT_THROW(arr6->useMappedRawFile("mappedRawFiles1.arr"),INTERP_KERNEL::Exception);
+  CPPUNIT_ASSERT_THROW(arr6->useMappedRawFile("mappedRawFiles1.nonexisting"),INTERP_KERNEL::Exception);
+  arr2.nullify(); arr5.nullify();
+  // corrupted number of tuples whose product by the size of the tuples wraps around to the size of the file
+  {
+    std::fstream fs("mappedRawFiles1.arr",std::ios_base::in | std::ios_base::out | std::ios_base::binary);
+    std::uint64_t nbOfTuples(1000+(std::uint64_t(1)<<62));
+    fs.seekp(32);
+    fs.write(reinterpret_cast<const char *>(&nbOfTuples),sizeof(std::uint64_t));
+  }
+  MCAuto<DataArrayDouble> arr7(DataArrayDouble::New());
+  CPPUNIT_ASSERT_THROW(arr7->useMappedRawFile("mappedRawFiles1.arr"),INTERP_KERNEL::Exception);
+  CPPUNIT_ASSERT_EQUAL(0,std::remove("mappedRawFiles1.arr"));
+  // mesh
+  MCAuto<MEDCouplingUMesh> m(build3DTargetMesh_1());
+  m->writeRawFiles("mappedRawFiles1");
+  MCAuto<MEDCouplingUMesh> m2(MEDCouplingUMesh::LoadFromRawFiles("mappedRawFiles1"));
+  m2->setName(m->getName());
+  m2->getCoords()->copyStringInfoFrom(*m->getCoords());
+  CPPUNIT_ASSERT(m2->isEqual(m,1e-12));
+  CPPUNIT_ASSERT_EQUAL(m->getMeshDimension(),m2->getMeshDimension());
+  CPPUNIT_ASSERT(m->getAllGeoTypes()==m2->getAllGeoTypes());
+  MCAuto<MEDCouplingFieldDouble> vol(m->getMeasureField(true)),vol2(m2->getMeasureField(true));
+  CPPUNIT_ASSERT(vol2->getArray()->isEqual(*vol->getArray(),1e-12));
+  MCAuto<MEDCouplingUMesh> skin(m->computeSkin()),skin2(m2->computeSkin());
+  CPPUNIT_ASSERT(skin2->getNodalConnectivity()->isEqual(*skin->getNodalConnectivity()));
+  const double vec[3]={1.,0.,0.};
+  CPPUNIT_ASSERT_THROW(m2->translate(vec),INTERP_KERNEL::Exception);
+  MCAuto<MEDCouplingUMesh> m3(MEDCouplingUMesh::LoadFromRawFiles("mappedRawFiles1",true));
+  m3->translate(vec);
+  m3->zipCoords();
+  m2.nullify(); m3.nullify();
+  // polylines : NORM_POLYL is the last type
+  MCAuto<MEDCouplingUMesh> m4(MEDCouplingUMesh::New("polylines",1));
+  MCAuto<DataArrayDouble> coo(DataArrayDouble::New()); coo->alloc(10,1); coo->iota(0.); coo->rearrange(2);
+  m4->setCoords(coo);
+  const mcIdType conn4[7]={0,1,2,3, 3,4, 1};
+  m4->allocateCells(2);
+  m4->insertNextCell(INTERP_KERNEL::NORM_POLYL,4,conn4);
+  m4->insertNextCell(INTERP_KERNEL::NORM_SEG2,2,conn4+4);
+  m4->finishInsertingCells();
+  m4->writeRawFiles("mappedRawFiles1");
+  MCAuto<MEDCouplingUMesh> m5(MEDCouplingUMesh::LoadFromRawFiles("mappedRawFiles1"));
+  CPPUNIT_ASSERT(m4->getAllGeoTypes()==m5->getAllGeoTypes());
+  CPPUNIT_ASSERT_EQUAL((std::size_t)2,m5->getAllGeoTypes().size());
+  CPPUNIT_ASSERT(m5->getNodalConnectivity()->isEqual(*m4->getNodalConnectivity()));
+  m5.nullify();
+  CPPUNIT_ASSERT_EQUAL(0,std::remove("mappedRawFiles1.coords"));
+  CPPUNIT_ASSERT_EQUAL(0,std::remove("mappedRawFiles1.conn"));
+  CPPUNIT_ASSERT_EQUAL(0,std::remove("mappedRawFiles1.conni"));
+}
+
+void MEDCouplingBasicsTest5::testGetBoundingBoxesOfCellClusters1()
+{
+  // a L-shaped mesh of 36 cells, of thickness 2, in the square [0,10]x[0,10]
+  MCAuto<MEDCouplingCMesh> cm(MEDCouplingCMesh::New());
+  MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(11,1); arr->iota();
+  cm->setCoords(arr,arr);
+  MCAuto<MEDCouplingUMesh> sq(cm->buildUnstructured());
+  std::vector<mcIdType> cellsOfL;
+  for(mcIdType j=0;j<10;j++)
+    for(mcIdType i=0;i<10;i++)
+      if(i<2 || j<2)
+        cellsOfL.push_back(10*j+i);
+  MCAuto<MEDCouplingUMesh> m(static_cast<MEDCouplingUMesh *>(sq->buildPartOfMySelf(cellsOfL.data(),cellsOfL.data()+cellsOfL.size(),true)));
+  MCAuto<DataArrayDouble> cellsBBox(m->getBoundingBoxForBBTree());
+  // no bisection : the global bounding box
+  MCAuto<DataArrayDouble> boxes(m->getBoundingBoxesOfCellClusters(0));
+  CPPUNIT_ASSERT_EQUAL((mcIdType)1,boxes->getNumberOfTuples());
+  CPPUNIT_ASSERT_EQUAL((std::size_t)4,boxes->getNumberOfComponents());
+  const double expected0[4]={0.,10.,0.,10.};
+  for(int j=0;j<4;j++)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(expected0[j],boxes->getIJ(0,j),1e-12);
+  // bisections : the boxes are tighter and each cell lies in one of them. With 3 levels they fit exactly the L.
+  const double expectedAreas[3]={60.,45.,36.};
+  for(int nbOfLevels=1;nbOfLevels<4;nbOfLevels++)
+    {
+      boxes=m->getBoundingBoxesOfCellClusters(nbOfLevels);
+      double area(0.);
+      for(mcIdType b=0;b<boxes->getNumberOfTuples();b++)
+        area+=(boxes->getIJ(b,1)-boxes->getIJ(b,0))*(boxes->getIJ(b,3)-boxes->getIJ(b,2));
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(expectedAreas[nbOfLevels-1],area,1e-12);
+      for(mcIdType c=0;c<cellsBBox->getNumberOfTuples();c++)
+        {
+          bool found(false);
+          for(mcIdType b=0;b<boxes->getNumberOfTuples() && !found;b++)
+            found=boxes->getIJ(b,0)<=cellsBBox->getIJ(c,0) && cellsBBox->getIJ(c,1)<=boxes->getIJ(b,1) && boxes->getIJ(b,2)<=cellsBBox->getIJ(c,2) && cellsBBox->getIJ(c,3)<=boxes->getIJ(b,3);
+          CPPUNIT_ASSERT(found);
+        }
+    }
+  // more bisections than cells : one box per cell
+  boxes=m->getBoundingBoxesOfCellClusters(8);
+  CPPUNIT_ASSERT_EQUAL((mcIdType)36,boxes->getNumberOfTuples());
+  for(mcIdType b=0;b<36;b++)
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.,(boxes->getIJ(b,1)-boxes->getIJ(b,0))*(boxes->getIJ(b,3)-boxes->getIJ(b,2)),1e-12);
+  CPPUNIT_ASSERT_THROW(m->getBoundingBoxesOfCellClusters(-1),INTERP_KERNEL::Exception);
+  // empty mesh
+  MCAuto<MEDCouplingUMesh> empty(static_cast<MEDCouplingUMesh *>(m->buildPartOfMySelf(cellsOfL.data(),cellsOfL.data(),true)));
+  boxes=empty->getBoundingBoxesOfCellClusters(3);
+  CPPUNIT_ASSERT_EQUAL((mcIdType)0,boxes->getNumberOfTuples());
+}
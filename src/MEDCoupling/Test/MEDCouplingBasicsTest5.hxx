@@ -76,6 +76,14 @@ namespace MEDCoupling
     CPPUNIT_TEST( testDAIBuildSubstractionOptimized1 );
     CPPUNIT_TEST( testDAIIsStrictlyMonotonic1 );
     CPPUNIT_TEST( testSimplexize3 );
+    CPPUNIT_TEST( testApplyFuncMultiThreaded1 );
+    CPPUNIT_TEST( testDAISortAndSetOperationsMultiThreaded1 );
+    CPPUNIT_TEST( testReverseNodalAndDescendingConnectivityMultiThreaded1 );
+    CPPUNIT_TEST( testCellLocatorCache1 );
+    CPPUNIT_TEST( testCellsInBoundingBoxes1 );
+    CPPUNIT_TEST( testMemoryPool1 );
+    CPPUNIT_TEST( testMappedRawFiles1 );
+    CPPUNIT_TEST( testGetBoundingBoxesOfCellClusters1 );
     CPPUNIT_TEST_SUITE_END();
   public:
     void testUMeshTessellate2D1();
@@ -118,6 +126,14 @@ namespace MEDCoupling
     void testDAIBuildSubstractionOptimized1();
     void testDAIIsStrictlyMonotonic1();
     void testSimplexize3();
+    void testApplyFuncMultiThreaded1();
+    void testDAISortAndSetOperationsMultiThreaded1();
+    void testReverseNodalAndDescendingConnectivityMultiThreaded1();
+    void testCellLocatorCache1();
+    void testCellsInBoundingBoxes1();
+    void testMemoryPool1();
+    void testMappedRawFiles1();
+    void testGetBoundingBoxesOfCellClusters1();
   };
 }
 
@@ -20,16 +20,22 @@
 
 #include "MEDCouplingRemapperTest.hxx"
 #include "MEDCouplingUMesh.hxx"
+#include "MEDCouplingCMesh.hxx"
 #include "MEDCouplingMappedExtrudedMesh.hxx"
 #include "MEDCouplingFieldDouble.hxx"
 #include "MEDCouplingFieldTemplate.hxx"
 #include "MEDCouplingMemArray.hxx"
 #include "MEDCouplingRemapper.hxx"
+#include "MEDCouplingMemoryPool.hxx"
 
 #include "MEDCouplingBasicsTest.hxx"
 
 #include <cmath>
+#include <thread>
 #include <numeric>
+#include <fstream>
+#include <limits>
+#include <cstdio>
 
 using namespace MEDCoupling;
 
@@ -1316,3 +1322,488 @@ void MEDCouplingRemapperTest::testBugNonRegression1()
   srcMesh->decrRef(); trgMesh->decrRef();
 }
 
+/*!
+ * Checks that the matrix computed with several threads (NbThreads option) is exactly the sequential one.
+ */
+void MEDCouplingRemapperTest::testMultiThreaded3D()
+{
+  MCAuto<MEDCouplingUMesh> srcMesh,trgMesh;
+  {
+    MCAuto<MEDCouplingCMesh> cm(MEDCouplingCMesh::New());
+    MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(7,1); arr->iota(0.); arr->applyLin(1./6.,0.);
+    cm->setCoords(arr,arr,arr);
+    srcMesh=cm->buildUnstructured();
+    MCAuto<DataArrayDouble> arr2(DataArrayDouble::New()); arr2->alloc(6,1); arr2->iota(0.); arr2->applyLin(0.23,-0.07);
+    cm->setCoords(arr2,arr2,arr2);
+    trgMesh=cm->buildUnstructured();
+    trgMesh->simplexize(INTERP_KERNEL::PLANAR_FACE_5);
+  }
+  const char *METHS[3]={"P0P0","P1P0","P0P1"};
+  for(int i=0;i<3;i++)
+    {
+      MEDCouplingRemapper remapperSeq;
+      remapperSeq.setIntersectionType(INTERP_KERNEL::Triangulation);
+      CPPUNIT_ASSERT_EQUAL(1,remapperSeq.prepare(srcMesh,trgMesh,METHS[i]));
+      std::vector<std::map<mcIdType,double> > matSeq(remapperSeq.getCrudeMatrix());
+      for(int nbThreads=2;nbThreads<=5;nbThreads+=3)
+        {
+          MEDCouplingRemapper remapper;
+          remapper.setIntersectionType(INTERP_KERNEL::Triangulation);
+          CPPUNIT_ASSERT(remapper.setOptionInt("NbThreads",nbThreads));
+          CPPUNIT_ASSERT_EQUAL(nbThreads,remapper.getNbThreads());
+          CPPUNIT_ASSERT_EQUAL(1,remapper.prepare(srcMesh,trgMesh,METHS[i]));
+          const std::vector<std::map<mcIdType,double> >& mat(remapper.getCrudeMatrix());
+          CPPUNIT_ASSERT_EQUAL(matSeq.size(),mat.size());
+          for(std::size_t j=0;j<mat.size();j++)
+            {
+              CPPUNIT_ASSERT_EQUAL(matSeq[j].size(),mat[j].size());
+              std::map<mcIdType,double>::const_iterator it1(matSeq[j].begin()),it2(mat[j].begin());
+              for(;it1!=matSeq[j].end();it1++,it2++)
+                {
+                  CPPUNIT_ASSERT_EQUAL((*it1).first,(*it2).first);
+                  CPPUNIT_ASSERT_EQUAL((*it1).second,(*it2).second);// bit to bit identical
+                }
+            }
+        }
+    }
+}
+
+/*!
+ * Same as testMultiThreaded3D for the planar intersectors.
+ */
+void MEDCouplingRemapperTest::testMultiThreaded2D()
+{
+  MCAuto<MEDCouplingUMesh> srcMesh,trgMesh;
+  {
+    MCAuto<MEDCouplingCMesh> cm(MEDCouplingCMesh::New());
+    MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(21,1); arr->iota(0.); arr->applyLin(0.05,0.);
+    cm->setCoords(arr,arr);
+    srcMesh=cm->buildUnstructured();
+    srcMesh->simplexize(0);
+    MCAuto<DataArrayDouble> arr2(DataArrayDouble::New()); arr2->alloc(17,1); arr2->iota(0.); arr2->applyLin(0.0625,-0.03);
+    cm->setCoords(arr2,arr2);
+    trgMesh=cm->buildUnstructured();
+    const double center[2]={0.5,0.5};
+    trgMesh->rotate(center,0,0.3);
+  }
+  const INTERP_KERNEL::IntersectionType INTERSECT_TYPES[3]={INTERP_KERNEL::Triangulation,INTERP_KERNEL::Convex,INTERP_KERNEL::Geometric2D};
+  const char *METHS[2]={"P0P0","P1P0"};
+  for(int i=0;i<3;i++)
+    for(int j=0;j<2;j++)
+      {
+        if(INTERSECT_TYPES[i]==INTERP_KERNEL::Convex && j==1)
+          continue;
+        MEDCouplingRemapper remapperSeq;
+        remapperSeq.setIntersectionType(INTERSECT_TYPES[i]);
+        CPPUNIT_ASSERT_EQUAL(1,remapperSeq.prepare(srcMesh,trgMesh,METHS[j]));
+        std::vector<std::map<mcIdType,double> > matSeq(remapperSeq.getCrudeMatrix());
+        MEDCouplingRemapper remapper;
+        remapper.setIntersectionType(INTERSECT_TYPES[i]);
+        remapper.setNbThreads(3);
+        CPPUNIT_ASSERT_EQUAL(1,remapper.prepare(srcMesh,trgMesh,METHS[j]));
+        CPPUNIT_ASSERT(matSeq==remapper.getCrudeMatrix());// bit to bit identical
+      }
+  // Geometric2D precision is a per thread context : two remappings with different precisions can run concurrently.
+  // The target nodes are moved from the source ones by less than the coarsest precision, so that the two matrices differ.
+  MCAuto<MEDCouplingUMesh> trgMesh2(srcMesh->deepCopy());
+  const double vec[2]={1e-5,3e-6};
+  trgMesh2->translate(vec);
+  const double PRECISIONS[2]={1e-12,1e-3};
+  std::vector<std::map<mcIdType,double> > matRef[2],mat[2];
+  for(int i=0;i<2;i++)
+    {
+      MEDCouplingRemapper remapper;
+      remapper.setIntersectionType(INTERP_KERNEL::Geometric2D);
+      remapper.setPrecision(PRECISIONS[i]);
+      CPPUNIT_ASSERT_EQUAL(1,remapper.prepare(srcMesh,trgMesh2,"P0P0"));
+      matRef[i]=remapper.getCrudeMatrix();
+    }
+  CPPUNIT_ASSERT(matRef[0]!=matRef[1]);// otherwise a precision leaking from one thread to the other would not be detected
+  std::vector<std::thread> threads;
+  for(int i=0;i<2;i++)
+    threads.push_back(std::thread([&,i]()
+      {
+        MEDCouplingRemapper remapper;
+        remapper.setIntersectionType(INTERP_KERNEL::Geometric2D);
+        remapper.setPrecision(PRECISIONS[i]);
+        remapper.setNbThreads(2);
+        remapper.prepare(srcMesh,trgMesh2,"P0P0");
+        mat[i]=remapper.getCrudeMatrix();
+      }));
+  for(std::vector<std::thread>::iterator it=threads.begin();it!=threads.end();it++)
+    (*it).join();
+  for(int i=0;i<2;i++)
+    CPPUNIT_ASSERT(matRef[i]==mat[i]);
+}
+
+/*!
+ * The crude matrix is stored in compressed sparse row format after prepare : checks that getCrudeMatrix, setCrudeMatrix,
+ * nullifiedTinyCoeffInCrudeMatrixAbs and the transfers stay consistent with each other.
+ */
+void MEDCouplingRemapperTest::testCrudeMatrixStorage()
+{
+  MCAuto<MEDCouplingUMesh> srcMesh,trgMesh;
+  {
+    MCAuto<MEDCouplingCMesh> cm(MEDCouplingCMesh::New());
+    MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(4,1); arr->iota(0.);
+    cm->setCoords(arr,arr);
+    srcMesh=cm->buildUnstructured();
+    MCAuto<DataArrayDouble> arr2(DataArrayDouble::New()); arr2->alloc(4,1); arr2->iota(0.); arr2->applyLin(1.,0.1);
+    cm->setCoords(arr2,arr2);
+    trgMesh=cm->buildUnstructured();
+  }
+  MCAuto<MEDCouplingFieldDouble> srcField(MEDCouplingFieldDouble::New(ON_CELLS,ONE_TIME));
+  srcField->setMesh(srcMesh);
+  MCAuto<DataArrayDouble> srcArr(DataArrayDouble::New()); srcArr->alloc(18,1); srcArr->iota(1.); srcArr->rearrange(2);
+  srcField->setArray(srcArr);
+  srcField->setNature(IntensiveMaximum);
+  //
+  MEDCouplingRemapper remapper;
+  CPPUNIT_ASSERT_EQUAL(1,remapper.prepare(srcMesh,trgMesh,"P0P0"));
+  CPPUNIT_ASSERT_EQUAL(ToIdType(9),remapper.getNumberOfColsOfMatrix());
+  std::vector<std::map<mcIdType,double> > m(remapper.getCrudeMatrix());
+  CPPUNIT_ASSERT_EQUAL(9,(int)m.size());
+  CPPUNIT_ASSERT_EQUAL(4,(int)m[0].size());
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.81,m[0][0],1e-12);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.01,m[0][4],1e-12);
+  CPPUNIT_ASSERT_EQUAL(1,(int)m[8].size());
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.81,remapper.getMaxValueInCrudeMatrix(),1e-12);
+  MCAuto<MEDCouplingFieldDouble> trgField(remapper.transferField(srcField,1e300));
+  // same matrix given by the user
+  MEDCouplingRemapper remapper2;
+  remapper2.setCrudeMatrix(srcMesh,trgMesh,"P0P0",m);
+  CPPUNIT_ASSERT(m==remapper2.getCrudeMatrix());
+  MCAuto<MEDCouplingFieldDouble> trgField2(remapper2.transferField(srcField,1e300));
+  CPPUNIT_ASSERT(trgField->getArray()->isEqual(*trgField2->getArray(),0.));
+  MCAuto<MEDCouplingFieldDouble> srcField2(remapper.reverseTransferField(trgField,1e300)),srcField3(remapper2.reverseTransferField(trgField,1e300));
+  CPPUNIT_ASSERT(srcField2->getArray()->isEqual(*srcField3->getArray(),0.));
+  // removal of the small coefficients is seen by getCrudeMatrix and by the transfers
+  CPPUNIT_ASSERT_EQUAL(16,remapper2.nullifiedTinyCoeffInCrudeMatrixAbs(0.1));
+  const std::vector<std::map<mcIdType,double> >& m2(remapper2.getCrudeMatrix());
+  CPPUNIT_ASSERT_EQUAL(9,(int)m2.size());
+  for(std::size_t i=0;i<m2.size();i++)
+    {
+      CPPUNIT_ASSERT_EQUAL(1,(int)m2[i].size());
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(0.81,m2[i].find((mcIdType)i)->second,1e-12);
+    }
+  trgField2=remapper2.transferField(srcField,1e300);
+  CPPUNIT_ASSERT(trgField2->getArray()->isEqual(*srcArr,1e-12));
+}
+
+/*!
+ * Checks that transferMulti/transferFields give exactly the same results than transfer/transferField applied on each field.
+ */
+void MEDCouplingRemapperTest::testTransferMulti()
+{
+  MCAuto<MEDCouplingUMesh> srcMesh,trgMesh;
+  {
+    MCAuto<MEDCouplingCMesh> cm(MEDCouplingCMesh::New());
+    MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(5,1); arr->iota(0.);
+    cm->setCoords(arr,arr);
+    srcMesh=cm->buildUnstructured();
+    MCAuto<DataArrayDouble> arr2(DataArrayDouble::New()); arr2->alloc(6,1); arr2->iota(0.); arr2->applyLin(1.,0.5);
+    cm->setCoords(arr2,arr2);
+    trgMesh=cm->buildUnstructured();
+  }
+  const NatureOfField NATURES[4]={IntensiveMaximum,ExtensiveConservation,IntensiveMaximum,IntensiveConservation};
+  const int NB_OF_COMPOS[4]={1,3,2,1};
+  std::vector< MCAuto<MEDCouplingFieldDouble> > srcFields(4);
+  std::vector<const MEDCouplingFieldDouble *> srcFieldsPtr(4);
+  for(int i=0;i<4;i++)
+    {
+      srcFields[i]=MEDCouplingFieldDouble::New(ON_CELLS,ONE_TIME);
+      srcFields[i]->setMesh(srcMesh);
+      srcFields[i]->setName("field");
+      MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(16*NB_OF_COMPOS[i],1); arr->iota((double)i); arr->applyFunc("sqrt(x)");
+      arr->rearrange(NB_OF_COMPOS[i]);
+      srcFields[i]->setArray(arr);
+      srcFields[i]->setNature(NATURES[i]);
+      srcFieldsPtr[i]=srcFields[i];
+    }
+  MEDCouplingRemapper remapper;
+  CPPUNIT_ASSERT_EQUAL(1,remapper.prepare(srcMesh,trgMesh,"P0P0"));
+  std::vector<MEDCouplingFieldDouble *> trgFields(remapper.transferFields(srcFieldsPtr,-7.));
+  CPPUNIT_ASSERT_EQUAL(4,(int)trgFields.size());
+  for(int i=0;i<4;i++)
+    {
+      MCAuto<MEDCouplingFieldDouble> trgFieldRef(remapper.transferField(srcFields[i],-7.)),trgField(trgFields[i]);
+      CPPUNIT_ASSERT(trgField->getMesh()==trgMesh);
+      CPPUNIT_ASSERT_EQUAL(std::string("field"),trgField->getName());
+      CPPUNIT_ASSERT(NATURES[i]==trgField->getNature());
+      CPPUNIT_ASSERT(trgFieldRef->getArray()->isEqual(*trgField->getArray(),0.));// bit to bit identical
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(-7.,trgField->getArray()->getIJ(24,0),1e-15);
+    }
+  // on already allocated target fields
+  std::vector< MCAuto<MEDCouplingFieldDouble> > trgFields2(4);
+  std::vector<MEDCouplingFieldDouble *> trgFields2Ptr(4);
+  for(int i=0;i<4;i++)
+    {
+      trgFields2[i]=MEDCouplingFieldDouble::New(ON_CELLS,ONE_TIME);
+      trgFields2[i]->setMesh(trgMesh);
+      trgFields2[i]->setNature(NATURES[i]);
+      trgFields2Ptr[i]=trgFields2[i];
+    }
+  remapper.transferMulti(srcFieldsPtr,trgFields2Ptr,-7.);
+  for(int i=0;i<4;i++)
+    {
+      MCAuto<MEDCouplingFieldDouble> trgFieldRef(remapper.transferField(srcFields[i],-7.));
+      CPPUNIT_ASSERT(trgFieldRef->getArray()->isEqual(*trgFields2[i]->getArray(),0.));
+    }
+  trgFields2Ptr.pop_back();
+  CPPUNIT_ASSERT_THROW(remapper.transferMulti(srcFieldsPtr,trgFields2Ptr,-7.),INTERP_KERNEL::Exception);
+}
+
+
+void MEDCouplingRemapperTest::testSaveLoadMatrix()
+{
+  const char fileName[]="SaveLoadMatrix.mcmat";
+  MCAuto<MEDCouplingUMesh> srcMesh,trgMesh,otherMesh;
+  {
+    MCAuto<MEDCouplingCMesh> cm(MEDCouplingCMesh::New());
+    MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(5,1); arr->iota(0.);
+    cm->setCoords(arr,arr);
+    srcMesh=cm->buildUnstructured();
+    MCAuto<DataArrayDouble> arr2(DataArrayDouble::New()); arr2->alloc(6,1); arr2->iota(0.); arr2->applyLin(0.7,0.3);
+    cm->setCoords(arr2,arr2);
+    trgMesh=cm->buildUnstructured();
+    trgMesh->simplexize(0);
+    arr2->applyLin(1.,1e-3);
+    cm->setCoords(arr2,arr2);
+    otherMesh=cm->buildUnstructured();
+    otherMesh->simplexize(0);
+  }
+  MCAuto<MEDCouplingFieldDouble> srcField(MEDCouplingFieldDouble::New(ON_CELLS,ONE_TIME));
+  srcField->setMesh(srcMesh);
+  {
+    MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(16,1); arr->iota(1.); arr->applyFunc("sqrt(x)");
+    srcField->setArray(arr);
+  }
+  srcField->setNature(IntensiveConservation);
+  MEDCouplingRemapper remapper;
+  remapper.setPrecision(1e-10);
+  remapper.setIntersectionType(INTERP_KERNEL::Geometric2D);
+  remapper.setMaxDistance3DSurfIntersect(0.25);
+  CPPUNIT_ASSERT_EQUAL(1,remapper.prepare(srcMesh,trgMesh,"P0P0"));
+  MCAuto<MEDCouplingFieldDouble> trgFieldRef(remapper.transferField(srcField,-7.));
+  remapper.saveMatrix(fileName);
+  //
+  MEDCouplingRemapper remapper2;
+  remapper2.loadMatrix(srcMesh,trgMesh,fileName);
+  CPPUNIT_ASSERT(remapper2.getCrudeMatrix()==remapper.getCrudeMatrix());
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1e-10,remapper2.getPrecision(),0.);
+  CPPUNIT_ASSERT(INTERP_KERNEL::Geometric2D==remapper2.getIntersectionType());
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.25,remapper2.getMaxDistance3DSurfIntersect(),0.);
+  CPPUNIT_ASSERT_EQUAL(remapper.getNumberOfColsOfMatrix(),remapper2.getNumberOfColsOfMatrix());
+  MCAuto<MEDCouplingFieldDouble> trgField(remapper2.transferField(srcField,-7.));
+  CPPUNIT_ASSERT(trgFieldRef->getArray()->isEqual(*trgField->getArray(),0.));// bit to bit identical
+  // with field templates
+  MCAuto<MEDCouplingFieldTemplate> srcFt(MEDCouplingFieldTemplate::New(ON_CELLS)),trgFt(MEDCouplingFieldTemplate::New(ON_CELLS)),trgFtNodes(MEDCouplingFieldTemplate::New(ON_NODES));
+  srcFt->setMesh(srcMesh); trgFt->setMesh(trgMesh); trgFtNodes->setMesh(trgMesh);
+  MEDCouplingRemapper remapper3;
+  remapper3.loadMatrixEx(srcFt,trgFt,fileName);
+  CPPUNIT_ASSERT(remapper3.getCrudeMatrix()==remapper.getCrudeMatrix());
+  // supports or method not matching the saved matrix
+  CPPUNIT_ASSERT_THROW(remapper3.loadMatrix(srcMesh,otherMesh,fileName),INTERP_KERNEL::Exception);
+  CPPUNIT_ASSERT_THROW(remapper3.loadMatrix(trgMesh,srcMesh,fileName),INTERP_KERNEL::Exception);
+  CPPUNIT_ASSERT_THROW(remapper3.loadMatrixEx(srcFt,trgFtNodes,fileName),INTERP_KERNEL::Exception);
+  CPPUNIT_ASSERT_THROW(remapper3.loadMatrix(srcMesh,trgMesh,"NotExistingFile.mcmat"),INTERP_KERNEL::Exception);
+  // a rejected file leaves the matrix already loaded unchanged
+  CPPUNIT_ASSERT(remapper3.getCrudeMatrix()==remapper.getCrudeMatrix());
+  trgField=remapper3.transferField(srcField,-7.);
+  CPPUNIT_ASSERT(trgFieldRef->getArray()->isEqual(*trgField->getArray(),0.));
+  // a rejected file leaves the options unchanged
+  MEDCouplingRemapper remapper5;
+  CPPUNIT_ASSERT_THROW(remapper5.loadMatrix(srcMesh,otherMesh,fileName),INTERP_KERNEL::Exception);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(INTERP_KERNEL::InterpolationOptions().getPrecision(),remapper5.getPrecision(),0.);
+  CPPUNIT_ASSERT(INTERP_KERNEL::InterpolationOptions().getIntersectionType()==remapper5.getIntersectionType());
+  // huge number of coefficients in a corrupted header
+  {
+    std::ifstream ifs(fileName,std::ios_base::binary);
+    std::string content((std::istreambuf_iterator<char>(ifs)),std::istreambuf_iterator<char>());
+    ifs.close();
+    mcIdType nbOfCoeffs(0);
+    for(std::vector<std::map<mcIdType,double> >::const_iterator it=remapper.getCrudeMatrix().begin();it!=remapper.getCrudeMatrix().end();it++)
+      nbOfCoeffs+=(mcIdType)(*it).size();
+    std::size_t posOfNbOfCoeffs(content.size()-(trgMesh->getNumberOfCells()+1)*sizeof(mcIdType)-nbOfCoeffs*(sizeof(mcIdType)+sizeof(double))-sizeof(mcIdType));
+    mcIdType nbOfCoeffsInFile(0);
+    std::copy(content.begin()+posOfNbOfCoeffs,content.begin()+posOfNbOfCoeffs+sizeof(mcIdType),reinterpret_cast<char *>(&nbOfCoeffsInFile));
+    CPPUNIT_ASSERT_EQUAL(nbOfCoeffs,nbOfCoeffsInFile);
+    mcIdType huge(std::numeric_limits<mcIdType>::max()/2);
+    std::string corrupted(content);
+    std::copy(reinterpret_cast<const char *>(&huge),reinterpret_cast<const char *>(&huge)+sizeof(mcIdType),corrupted.begin()+posOfNbOfCoeffs);
+    std::ofstream ofs(fileName,std::ios_base::binary | std::ios_base::trunc);
+    ofs.write(corrupted.c_str(),corrupted.size());
+    ofs.close();
+    CPPUNIT_ASSERT_THROW(remapper5.loadMatrix(srcMesh,trgMesh,fileName),INTERP_KERNEL::Exception);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(INTERP_KERNEL::InterpolationOptions().getPrecision(),remapper5.getPrecision(),0.);
+    // number of columns not matching the source support, whereas all the column ids are lower than it
+    mcIdType nbOfCols(srcMesh->getNumberOfCells()+10);
+    corrupted=content;
+    std::copy(reinterpret_cast<const char *>(&nbOfCols),reinterpret_cast<const char *>(&nbOfCols)+sizeof(mcIdType),corrupted.begin()+posOfNbOfCoeffs-sizeof(mcIdType));
+    std::ofstream ofs1(fileName,std::ios_base::binary | std::ios_base::trunc);
+    ofs1.write(corrupted.c_str(),corrupted.size());
+    ofs1.close();
+    CPPUNIT_ASSERT_THROW(remapper3.loadMatrix(srcMesh,trgMesh,fileName),INTERP_KERNEL::Exception);
+    CPPUNIT_ASSERT(remapper3.getCrudeMatrix()==remapper.getCrudeMatrix());
+    std::ofstream ofs2(fileName,std::ios_base::binary | std::ios_base::trunc);
+    ofs2.write(content.c_str(),content.size());
+  }
+  // truncated file
+  {
+    std::ifstream ifs(fileName,std::ios_base::binary);
+    std::string content((std::istreambuf_iterator<char>(ifs)),std::istreambuf_iterator<char>());
+    ifs.close();
+    std::ofstream ofs(fileName,std::ios_base::binary | std::ios_base::trunc);
+    ofs.write(content.c_str(),content.size()-4);
+  }
+  CPPUNIT_ASSERT_THROW(remapper3.loadMatrix(srcMesh,trgMesh,fileName),INTERP_KERNEL::Exception);
+  // not prepared remapper
+  MEDCouplingRemapper remapper4;
+  CPPUNIT_ASSERT_THROW(remapper4.saveMatrix(fileName),INTERP_KERNEL::Exception);
+  remove(fileName);
+}
+
+void MEDCouplingRemapperTest::testPrepareIncremental()
+{
+  MCAuto<MEDCouplingUMesh> srcMesh,trgMesh;
+  {
+    MCAuto<MEDCouplingCMesh> cm(MEDCouplingCMesh::New());
+    MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(11,1); arr->iota(0.);
+    cm->setCoords(arr,arr);
+    srcMesh=cm->buildUnstructured();
+    MCAuto<DataArrayDouble> arr2(DataArrayDouble::New()); arr2->alloc(8,1); arr2->iota(0.); arr2->applyLin(1.3,0.4);
+    cm->setCoords(arr2,arr2);
+    trgMesh=cm->buildUnstructured();
+    trgMesh->simplexize(0);
+  }
+  const char *METHODS[2]={"P0P0","P1P0"};
+  for(int m=0;m<2;m++)
+    {
+      MCAuto<MEDCouplingUMesh> trgMesh2(trgMesh->deepCopy());
+      MEDCouplingRemapper remapper;
+      CPPUNIT_ASSERT_EQUAL(trgMesh2->getNumberOfCells(),remapper.prepareIncremental(srcMesh,trgMesh2,METHODS[m],1e-3));
+      CPPUNIT_ASSERT_EQUAL(mcIdType(0),remapper.prepareIncremental(srcMesh,trgMesh2,METHODS[m],1e-3));
+      // move in place node #9 (shared by 6 triangles) and slightly node #20
+      double *coords(trgMesh2->getCoords()->getPointer());
+      coords[2*9]+=0.2; coords[2*9+1]-=0.15;
+      coords[2*20]+=1e-4;
+      trgMesh2->getCoords()->declareAsNew();
+      CPPUNIT_ASSERT_EQUAL(mcIdType(6),remapper.prepareIncremental(srcMesh,trgMesh2,METHODS[m],1e-3));
+      MEDCouplingRemapper remapperRef;
+      remapperRef.prepare(srcMesh,trgMesh2,METHODS[m]);
+      CPPUNIT_ASSERT(remapperRef.getCrudeMatrix()!=remapper.getCrudeMatrix());// the move of node #20 is ignored
+      // node #20 goes on moving : its cumulated move becomes larger than eps
+      MCAuto<MEDCouplingUMesh> trgMesh3(trgMesh2->deepCopy());
+      trgMesh3->getCoords()->setIJ(20,0,trgMesh3->getCoords()->getIJ(20,0)+1e-3);
+      CPPUNIT_ASSERT_EQUAL(mcIdType(6),remapper.prepareIncremental(srcMesh,trgMesh3,METHODS[m],1e-3));
+      remapperRef.prepare(srcMesh,trgMesh3,METHODS[m]);
+      const std::vector<std::map<mcIdType,double> >& mat(remapper.getCrudeMatrix()),&matRef(remapperRef.getCrudeMatrix());
+      CPPUNIT_ASSERT_EQUAL(matRef.size(),mat.size());
+      for(std::size_t i=0;i<mat.size();i++)
+        {
+          CPPUNIT_ASSERT_EQUAL(matRef[i].size(),mat[i].size());
+          for(std::map<mcIdType,double>::const_iterator it=mat[i].begin(),itRef=matRef[i].begin();it!=mat[i].end();it++,itRef++)
+            {
+              CPPUNIT_ASSERT_EQUAL((*itRef).first,(*it).first);
+              CPPUNIT_ASSERT_EQUAL((*itRef).second,(*it).second);
+            }
+        }
+      MCAuto<MEDCouplingFieldDouble> srcField(MEDCouplingFieldDouble::New(m==0?ON_CELLS:ON_NODES,ONE_TIME));
+      srcField->setMesh(srcMesh);
+      MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(m==0?100:121,1); arr->iota(1.);
+      srcField->setArray(arr); srcField->setNature(IntensiveMaximum);
+      MCAuto<MEDCouplingFieldDouble> trgField(remapper.transferField(srcField,-7.)),trgFieldRef(remapperRef.transferField(srcField,-7.));
+      CPPUNIT_ASSERT(trgField->getMesh()==trgMesh3);
+      CPPUNIT_ASSERT(trgFieldRef->getArray()->isEqual(*trgField->getArray(),1e-12));
+      // with eps equal to 0. even a tiny move is taken into account : the matrix is exactly the one of prepare
+      trgMesh3->getCoords()->setIJ(9,1,trgMesh3->getCoords()->getIJ(9,1)+1e-9);
+      CPPUNIT_ASSERT_EQUAL(mcIdType(6),remapper.prepareIncremental(srcMesh,trgMesh3,METHODS[m],0.));
+      remapperRef.prepare(srcMesh,trgMesh3,METHODS[m]);
+      CPPUNIT_ASSERT(remapperRef.getCrudeMatrix()==remapper.getCrudeMatrix());
+      // a modified source or a different connectivity lead to a full computation
+      srcMesh->declareAsNew();
+      CPPUNIT_ASSERT_EQUAL(trgMesh3->getNumberOfCells(),remapper.prepareIncremental(srcMesh,trgMesh3,METHODS[m],1e-3));
+      trgMesh3->getNodalConnectivity()->setIJ(1,0,trgMesh3->getNodalConnectivity()->getIJ(2,0));
+      trgMesh3->getNodalConnectivity()->declareAsNew();
+      CPPUNIT_ASSERT_EQUAL(trgMesh3->getNumberOfCells(),remapper.prepareIncremental(srcMesh,trgMesh3,METHODS[m],1e-3));
+    }
+}
+
+namespace
+{
+  //! deallocator of a buffer owned by the test : only counts the releases
+  void CountRelease(void *, void *param)
+  {
+    (*reinterpret_cast<int *>(param))++;
+  }
+}
+
+/*!
+ * Transfers between fields whose arrays are views on buffers owned by the caller : the target values are written in the caller buffer,
+ * no array being allocated, replaced nor copied.
+ */
+void MEDCouplingRemapperTest::testTransferInPlace()
+{
+  MCAuto<MEDCouplingUMesh> srcMesh,trgMesh;
+  {
+    MCAuto<MEDCouplingCMesh> cm(MEDCouplingCMesh::New());
+    MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(5,1); arr->iota(0.);
+    cm->setCoords(arr,arr);
+    srcMesh=cm->buildUnstructured();
+    MCAuto<DataArrayDouble> arr2(DataArrayDouble::New()); arr2->alloc(6,1); arr2->iota(0.); arr2->applyLin(1.,0.5);
+    cm->setCoords(arr2,arr2);
+    trgMesh=cm->buildUnstructured();
+  }
+  std::vector<double> srcBuffer(16*2),trgBuffer(25*2,-1.);
+  std::iota(srcBuffer.begin(),srcBuffer.end(),1.);
+  int nbOfReleases(0);
+  MCAuto<MEDCouplingFieldDouble> srcField(MEDCouplingFieldDouble::New(ON_CELLS,ONE_TIME)),trgField(MEDCouplingFieldDouble::New(ON_CELLS,ONE_TIME));
+  srcField->setMesh(srcMesh); srcField->setNature(IntensiveMaximum);
+  trgField->setMesh(trgMesh); trgField->setNature(IntensiveMaximum);
+  {
+    MCAuto<DataArrayDouble> srcArr(DataArrayDouble::New()),trgArr(DataArrayDouble::New());
+    srcArr->useArray(srcBuffer.data(),false,DeallocType::CPP_DEALLOC,16,2);
+    trgArr->useExternalArrayWithDeallocator(trgBuffer.data(),25,2,CountRelease,&nbOfReleases);
+    srcField->setArray(srcArr);
+    trgField->setArray(trgArr);
+  }
+  const DataArrayDouble *trgArr(trgField->getArray());
+  MEDCouplingRemapper remapper;
+  CPPUNIT_ASSERT_EQUAL(1,remapper.prepare(srcMesh,trgMesh,"P0P0"));
+  MCAuto<MEDCouplingFieldDouble> trgFieldRef(remapper.transferField(srcField,-7.));
+  // the arrays allocated on the hot path would be counted by the pool of the scope
+  MCAuto<MEDCouplingMemoryPool> pool(MEDCouplingMemoryPool::New());
+  {
+    MEDCouplingMemoryPoolScope scope(pool);
+    for(int i=0;i<3;i++)
+      {
+        std::fill(trgBuffer.begin(),trgBuffer.end(),-1.);
+        remapper.transfer(srcField,trgField,-7.);
+        CPPUNIT_ASSERT(trgArr==trgField->getArray());
+        CPPUNIT_ASSERT(trgBuffer.data()==trgArr->begin());
+        CPPUNIT_ASSERT(trgFieldRef->getArray()->isEqual(*trgArr,0.));
+      }
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(-7.,trgBuffer[2*24],1e-15);
+    // the in place operations of the field work on the caller buffer too, and a shallow clone shares it
+    MCAuto<MEDCouplingFieldDouble> trgFieldShallow(trgField->clone(false));
+    CPPUNIT_ASSERT(trgArr==trgFieldShallow->getArray());
+    trgField->applyLin(2.,1.);
+    (*trgField)-=(*trgFieldRef);
+    CPPUNIT_ASSERT(trgBuffer.data()==trgField->getArray()->begin());
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(trgFieldRef->getArray()->getIJ(3,1)+1.,trgBuffer[2*3+1],1e-12);
+    CPPUNIT_ASSERT_EQUAL((std::size_t)0,pool->getNumberOfAllocations());
+    CPPUNIT_ASSERT_EQUAL((std::size_t)0,pool->getNumberOfSystemAllocations());
+  }
+  // partialTransfer lets the target tuples not intercepted unchanged
+  std::fill(trgBuffer.begin(),trgBuffer.end(),-1.);
+  remapper.partialTransfer(srcField,trgField);
+  CPPUNIT_ASSERT(trgArr==trgField->getArray());
+  CPPUNIT_ASSERT(trgBuffer.data()==trgArr->begin());
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(-1.,trgBuffer[2*24],1e-15);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(trgFieldRef->getArray()->getIJ(0,1),trgBuffer[1],1e-15);
+  // the buffers are still owned by the caller : the release is only notified
+  CPPUNIT_ASSERT(srcBuffer.data()==srcField->getArray()->begin());
+  CPPUNIT_ASSERT_EQUAL(0,nbOfReleases);
+  trgField.nullify();
+  CPPUNIT_ASSERT_EQUAL(1,nbOfReleases);
+}
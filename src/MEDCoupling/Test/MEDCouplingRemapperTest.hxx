@@ -44,6 +44,13 @@ namespace MEDCoupling
     CPPUNIT_TEST( testPrepareEx1 );
     CPPUNIT_TEST( testPartialTransfer1 );
     CPPUNIT_TEST( testBugNonRegression1 );
+    CPPUNIT_TEST( testMultiThreaded3D );
+    CPPUNIT_TEST( testMultiThreaded2D );
+    CPPUNIT_TEST( testCrudeMatrixStorage );
+    CPPUNIT_TEST( testTransferMulti );
+    CPPUNIT_TEST( testSaveLoadMatrix );
+    CPPUNIT_TEST( testPrepareIncremental );
+    CPPUNIT_TEST( testTransferInPlace );
     CPPUNIT_TEST_SUITE_END();
   public:
     void test2DInterpP0P0_1();
@@ -58,6 +65,13 @@ namespace MEDCoupling
     void testPartialTransfer1();
     //
     void testBugNonRegression1();
+    void testMultiThreaded3D();
+    void testMultiThreaded2D();
+    void testCrudeMatrixStorage();
+    void testTransferMulti();
+    void testSaveLoadMatrix();
+    void testPrepareIncremental();
+    void testTransferInPlace();
   private:
     static MEDCouplingUMesh *build1DTargetMesh_2();
     static MEDCouplingUMesh *build2DTargetMesh_3();
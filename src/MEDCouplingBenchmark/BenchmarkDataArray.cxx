@@ -0,0 +1,135 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "MEDCouplingBenchmark.hxx"
+#include "MEDCouplingBenchmarkMeshes.hxx"
+
+using namespace MEDCoupling;
+using namespace MEDCouplingBenchmark;
+
+namespace
+{
+  void DataArrayDouble_DeepCopy(State& state)
+  {
+    MCAuto<DataArrayDouble> arr(BuildRandomArray(state.size()));
+    while(state.keepRunning())
+      {
+        MCAuto<DataArrayDouble> cpy(arr->deepCopy());
+      }
+    state.setBytesProcessed(state.iterations()*state.size()*sizeof(double));
+  }
+
+  void DataArrayDouble_Add(State& state)
+  {
+    MCAuto<DataArrayDouble> a1(BuildRandomArray(state.size(),3,1)),a2(BuildRandomArray(state.size(),3,2));
+    while(state.keepRunning())
+      {
+        MCAuto<DataArrayDouble> res(DataArrayDouble::Add(a1,a2));
+      }
+    state.setItemsProcessed(state.iterations()*state.size()*3);
+  }
+
+  void DataArrayDouble_Accumulate(State& state)
+  {
+    MCAuto<DataArrayDouble> arr(BuildRandomArray(state.size()));
+    double sum(0.);
+    while(state.keepRunning())
+      sum+=arr->accumulate((std::size_t)0);
+    state.setItemsProcessed(state.iterations()*state.size());
+    state.setCounter("checksum",sum/(double)state.iterations());
+  }
+
+  void DataArrayDouble_Sort(State& state)
+  {
+    MCAuto<DataArrayDouble> arr(BuildRandomArray(state.size()));
+    while(state.keepRunning())
+      {
+        state.pauseTiming();
+        MCAuto<DataArrayDouble> work(arr->deepCopy());
+        state.resumeTiming();
+        work->sort();
+      }
+    state.setItemsProcessed(state.iterations()*state.size());
+  }
+
+  void DataArrayDouble_FindIdsInRange(State& state)
+  {
+    MCAuto<DataArrayDouble> arr(BuildRandomArray(state.size()));
+    while(state.keepRunning())
+      {
+        MCAuto<DataArrayIdType> ids(arr->findIdsInRange(0.25,0.5));
+      }
+    state.setItemsProcessed(state.iterations()*state.size());
+  }
+
+  void DataArrayDouble_FindCommonTuples(State& state)
+  {
+    // one point out of two has a duplicate
+    MCAuto<DataArrayDouble> arr(BuildRandomArray(state.size()/2,3));
+    MCAuto<DataArrayDouble> both(DataArrayDouble::Aggregate(arr,arr));
+    while(state.keepRunning())
+      {
+        DataArrayIdType *comm(0),*commI(0);
+        both->findCommonTuples(1e-12,-1,comm,commI);
+        MCAuto<DataArrayIdType> commAuto(comm),commIAuto(commI);
+      }
+    state.setItemsProcessed(state.iterations()*both->getNumberOfTuples());
+  }
+
+  void DataArrayIdType_InvertArrayO2N2N2O(State& state)
+  {
+    MCAuto<DataArrayIdType> o2n(BuildRandomPermutation(state.size()));
+    while(state.keepRunning())
+      {
+        MCAuto<DataArrayIdType> n2o(o2n->invertArrayO2N2N2O(state.size()));
+      }
+    state.setItemsProcessed(state.iterations()*state.size());
+  }
+
+  void DataArrayIdType_BuildUnique(State& state)
+  {
+    MCAuto<DataArrayIdType> arr(BuildRandomIdArray(state.size(),state.size()/4));
+    while(state.keepRunning())
+      {
+        MCAuto<DataArrayIdType> res(arr->buildUnique());
+      }
+    state.setItemsProcessed(state.iterations()*state.size());
+  }
+
+  void DataArrayIdType_Renumber(State& state)
+  {
+    MCAuto<DataArrayIdType> arr(BuildRandomIdArray(state.size(),state.size()));
+    MCAuto<DataArrayIdType> o2n(BuildRandomPermutation(state.size(),1));
+    while(state.keepRunning())
+      {
+        MCAuto<DataArrayIdType> res(arr->renumber(o2n->begin()));
+      }
+    state.setItemsProcessed(state.iterations()*state.size());
+  }
+}
+
+MEDCOUPLING_BENCHMARK(DataArrayDouble_DeepCopy,1000000,10000000);
+MEDCOUPLING_BENCHMARK(DataArrayDouble_Add,100000,1000000);
+MEDCOUPLING_BENCHMARK(DataArrayDouble_Accumulate,1000000,10000000);
+MEDCOUPLING_BENCHMARK(DataArrayDouble_Sort,100000,1000000);
+MEDCOUPLING_BENCHMARK(DataArrayDouble_FindIdsInRange,1000000,10000000);
+MEDCOUPLING_BENCHMARK(DataArrayDouble_FindCommonTuples,100000,1000000);
+MEDCOUPLING_BENCHMARK(DataArrayIdType_InvertArrayO2N2N2O,1000000,10000000);
+MEDCOUPLING_BENCHMARK(DataArrayIdType_BuildUnique,1000000,10000000);
+MEDCOUPLING_BENCHMARK(DataArrayIdType_Renumber,1000000,10000000);
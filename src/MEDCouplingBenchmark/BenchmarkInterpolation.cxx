@@ -0,0 +1,87 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "MEDCouplingBenchmark.hxx"
+#include "MEDCouplingBenchmarkMeshes.hxx"
+#include "MEDCouplingRemapper.hxx"
+#include "MEDCouplingFieldDouble.hxx"
+
+using namespace MEDCoupling;
+using namespace MEDCouplingBenchmark;
+
+namespace
+{
+  //! measures MEDCouplingRemapper::prepare in P0P0 between \a src and \a trg, which goes through Interpolation2D, Interpolation3D or Interpolation3DSurf
+  void PrepareP0P0(State& state, const MEDCouplingUMesh *src, const MEDCouplingUMesh *trg)
+  {
+    std::size_t nbOfCoeffs(0);
+    while(state.keepRunning())
+      {
+        MEDCouplingRemapper remapper;
+        remapper.prepare(src,trg,"P0P0");
+        state.pauseTiming();
+        const std::vector<std::map<mcIdType,double> >& matrix(remapper.getCrudeMatrix());
+        nbOfCoeffs=0;
+        for(std::vector<std::map<mcIdType,double> >::const_iterator it=matrix.begin();it!=matrix.end();it++)
+          nbOfCoeffs+=(*it).size();
+        state.resumeTiming();
+      }
+    state.setItemsProcessed(state.iterations()*trg->getNumberOfCells());
+    state.setCounter("nb_of_coefficients",(double)nbOfCoeffs);
+  }
+
+  void Interpolation2D_PrepareP0P0(State& state)
+  {
+    MCAuto<MEDCouplingUMesh> src(BuildSimplexUMesh(2,state.size())),trg(BuildCartesianUMesh(2,state.size(),0.013));
+    PrepareP0P0(state,src,trg);
+  }
+
+  void Interpolation3D_PrepareP0P0(State& state)
+  {
+    MCAuto<MEDCouplingUMesh> src(BuildSimplexUMesh(3,state.size())),trg(BuildCartesianUMesh(3,state.size(),0.013));
+    PrepareP0P0(state,src,trg);
+  }
+
+  void Interpolation3DSurf_PrepareP0P0(State& state)
+  {
+    MCAuto<MEDCouplingUMesh> src(BuildSurfUMesh3D(state.size())),trg(BuildSurfUMesh3D(state.size()/2,0.013));
+    PrepareP0P0(state,src,trg);
+  }
+
+  void Remapper3D_TransferP0P0(State& state)
+  {
+    MCAuto<MEDCouplingUMesh> src(BuildSimplexUMesh(3,state.size())),trg(BuildCartesianUMesh(3,state.size(),0.013));
+    MEDCouplingRemapper remapper;
+    remapper.prepare(src,trg,"P0P0");
+    MCAuto<MEDCouplingFieldDouble> srcField(MEDCouplingFieldDouble::New(ON_CELLS,ONE_TIME));
+    srcField->setMesh(src);
+    srcField->setArray(BuildRandomArray(src->getNumberOfCells(),3));
+    srcField->setNature(IntensiveMaximum);
+    while(state.keepRunning())
+      {
+        MCAuto<MEDCouplingFieldDouble> trgField(remapper.transferField(srcField,0.));
+      }
+    state.setItemsProcessed(state.iterations()*trg->getNumberOfCells());
+  }
+}
+
+MEDCOUPLING_BENCHMARK(Interpolation2D_PrepareP0P0,10000,100000);
+MEDCOUPLING_BENCHMARK(Interpolation3D_PrepareP0P0,10000,100000);
+MEDCOUPLING_BENCHMARK(Interpolation3DSurf_PrepareP0P0,10000,100000);
+MEDCOUPLING_BENCHMARK(Remapper3D_TransferP0P0,10000,100000);
@@ -0,0 +1,79 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "MEDCouplingBenchmark.hxx"
+#include "MEDCouplingBenchmarkMeshes.hxx"
+#include "MEDFileMesh.hxx"
+
+#include <cstdio>
+#include <sstream>
+
+using namespace MEDCoupling;
+using namespace MEDCouplingBenchmark;
+
+namespace
+{
+  //! a mesh of tetrahedra with its skin at level -1, and families on both levels
+  MCAuto<MEDFileUMesh> BuildFileMesh(mcIdType nbOfCells)
+  {
+    MCAuto<MEDCouplingUMesh> m0(BuildSimplexUMesh(3,nbOfCells));
+    MCAuto<MEDCouplingUMesh> m1(m0->computeSkin());
+    MCAuto<MEDFileUMesh> ret(MEDFileUMesh::New());
+    ret->setName("Mesh");
+    ret->setMeshAtLevel(0,m0);
+    ret->setMeshAtLevel(-1,m1);
+    MCAuto<DataArrayIdType> fam0(BuildRandomIdArray(m0->getNumberOfCells(),4)),fam1(BuildRandomIdArray(m1->getNumberOfCells(),4));
+    fam1->applyLin(-1,-1);
+    ret->setFamilyFieldArr(0,fam0);
+    ret->setFamilyFieldArr(-1,fam1);
+    return ret;
+  }
+
+  std::string FileName(const std::string& bench, mcIdType size)
+  {
+    std::ostringstream oss; oss << "MEDCouplingBenchmark_" << bench << "_" << size << ".med";
+    return oss.str();
+  }
+
+  void MEDFileUMesh_Write(State& state)
+  {
+    MCAuto<MEDFileUMesh> mesh(BuildFileMesh(state.size()));
+    std::string fileName(FileName("Write",state.size()));
+    while(state.keepRunning())
+      mesh->write(fileName,2);
+    std::remove(fileName.c_str());
+    state.setItemsProcessed(state.iterations()*state.size());
+  }
+
+  void MEDFileUMesh_Read(State& state)
+  {
+    std::string fileName(FileName("Read",state.size()));
+    BuildFileMesh(state.size())->write(fileName,2);
+    while(state.keepRunning())
+      {
+        MCAuto<MEDFileUMesh> mesh(MEDFileUMesh::New(fileName));
+        MCAuto<MEDCouplingUMesh> m0(mesh->getMeshAtLevel(0));
+      }
+    std::remove(fileName.c_str());
+    state.setItemsProcessed(state.iterations()*state.size());
+  }
+}
+
+MEDCOUPLING_BENCHMARK(MEDFileUMesh_Write,10000,100000,1000000);
+MEDCOUPLING_BENCHMARK(MEDFileUMesh_Read,10000,100000,1000000);
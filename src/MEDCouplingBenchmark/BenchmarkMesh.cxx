@@ -0,0 +1,125 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "MEDCouplingBenchmark.hxx"
+#include "MEDCouplingBenchmarkMeshes.hxx"
+#include "BBTree.txx"
+
+#include <vector>
+
+using namespace MEDCoupling;
+using namespace MEDCouplingBenchmark;
+
+namespace
+{
+  void BBTree3D_Build(State& state)
+  {
+    MCAuto<MEDCouplingUMesh> mesh(BuildSimplexUMesh(3,state.size()));
+    MCAuto<DataArrayDouble> bbox(mesh->getBoundingBoxForBBTree());
+    mcIdType nbOfCells(mesh->getNumberOfCells());
+    while(state.keepRunning())
+      {
+        BBTree<3,mcIdType> tree(bbox->begin(),0,0,nbOfCells);
+      }
+    state.setItemsProcessed(state.iterations()*nbOfCells);
+  }
+
+  void BBTree3D_Query(State& state)
+  {
+    MCAuto<MEDCouplingUMesh> mesh(BuildSimplexUMesh(3,state.size()));
+    MCAuto<DataArrayDouble> bbox(mesh->getBoundingBoxForBBTree());
+    mcIdType nbOfCells(mesh->getNumberOfCells());
+    BBTree<3,mcIdType> tree(bbox->begin(),0,0,nbOfCells);
+    // bounding boxes of the cells of a shifted mesh
+    MCAuto<MEDCouplingUMesh> other(BuildCartesianUMesh(3,state.size()/5,0.013));
+    MCAuto<DataArrayDouble> otherBBox(other->getBoundingBoxForBBTree());
+    mcIdType nbOfQueries(other->getNumberOfCells());
+    std::size_t nbOfHits(0);
+    std::vector<mcIdType> elems;
+    while(state.keepRunning())
+      {
+        for(mcIdType i=0;i<nbOfQueries;i++)
+          {
+            elems.clear();
+            tree.getIntersectingElems(otherBBox->begin()+6*i,elems);
+            nbOfHits+=elems.size();
+          }
+      }
+    state.setItemsProcessed(state.iterations()*nbOfQueries);
+    state.setCounter("hits_per_query",(double)nbOfHits/(double)(state.iterations()*nbOfQueries));
+  }
+
+  void UMesh2D_BuildDescendingConnectivity(State& state)
+  {
+    MCAuto<MEDCouplingUMesh> mesh(BuildSimplexUMesh(2,state.size()));
+    while(state.keepRunning())
+      {
+        MCAuto<DataArrayIdType> desc(DataArrayIdType::New()),descI(DataArrayIdType::New()),revDesc(DataArrayIdType::New()),revDescI(DataArrayIdType::New());
+        MCAuto<MEDCouplingUMesh> faces(mesh->buildDescendingConnectivity(desc,descI,revDesc,revDescI));
+      }
+    state.setItemsProcessed(state.iterations()*mesh->getNumberOfCells());
+  }
+
+  void UMesh3D_BuildDescendingConnectivity(State& state)
+  {
+    MCAuto<MEDCouplingUMesh> mesh(BuildSimplexUMesh(3,state.size()));
+    while(state.keepRunning())
+      {
+        MCAuto<DataArrayIdType> desc(DataArrayIdType::New()),descI(DataArrayIdType::New()),revDesc(DataArrayIdType::New()),revDescI(DataArrayIdType::New());
+        MCAuto<MEDCouplingUMesh> faces(mesh->buildDescendingConnectivity(desc,descI,revDesc,revDescI));
+      }
+    state.setItemsProcessed(state.iterations()*mesh->getNumberOfCells());
+  }
+
+  void UMesh3D_MergeNodes(State& state)
+  {
+    // two adjacent blocks whose nodes on the common face are duplicated
+    MCAuto<MEDCouplingUMesh> m1(BuildCartesianUMesh(3,state.size()/2)),m2(BuildCartesianUMesh(3,state.size()/2,1.));
+    MCAuto<MEDCouplingUMesh> ref(MEDCouplingUMesh::MergeUMeshes(m1,m2));
+    while(state.keepRunning())
+      {
+        state.pauseTiming();
+        MCAuto<MEDCouplingUMesh> mesh(ref->deepCopy());
+        state.resumeTiming();
+        bool areNodesMerged(false);
+        mcIdType newNbOfNodes(0);
+        MCAuto<DataArrayIdType> o2n(mesh->mergeNodes(1e-10,areNodesMerged,newNbOfNodes));
+      }
+    state.setItemsProcessed(state.iterations()*ref->getNumberOfNodes());
+  }
+
+  void UMesh3D_GetCellsContainingPoints(State& state)
+  {
+    MCAuto<MEDCouplingUMesh> mesh(BuildSimplexUMesh(3,state.size()));
+    MCAuto<DataArrayDouble> pts(BuildRandomArray(state.size(),3));
+    while(state.keepRunning())
+      {
+        MCAuto<DataArrayIdType> elts,eltsIndex;
+        mesh->getCellsContainingPoints(pts->begin(),pts->getNumberOfTuples(),1e-12,elts,eltsIndex);
+      }
+    state.setItemsProcessed(state.iterations()*pts->getNumberOfTuples());
+  }
+}
+
+MEDCOUPLING_BENCHMARK(BBTree3D_Build,10000,100000,1000000);
+MEDCOUPLING_BENCHMARK(BBTree3D_Query,10000,100000,1000000);
+MEDCOUPLING_BENCHMARK(UMesh2D_BuildDescendingConnectivity,10000,100000,1000000);
+MEDCOUPLING_BENCHMARK(UMesh3D_BuildDescendingConnectivity,10000,100000,1000000);
+MEDCOUPLING_BENCHMARK(UMesh3D_MergeNodes,10000,100000,1000000);
+MEDCOUPLING_BENCHMARK(UMesh3D_GetCellsContainingPoints,10000,100000);
@@ -0,0 +1,417 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "MEDCouplingBenchmark.hxx"
+#include "MEDCouplingRefCountObject.hxx"
+#include "InterpKernelException.hxx"
+
+#include <cmath>
+#include <regex>
+#include <thread>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <numeric>
+#include <iostream>
+#include <algorithm>
+
+using namespace MEDCouplingBenchmark;
+
+State::State(mcIdType size, double minTime, std::size_t minIterations):_size(size),_min_time(minTime),_min_iterations(std::max<std::size_t>(minIterations,1)),
+                                                                        _iterations(0),_started(false),_paused(false),_cpu_start(0),_real_time(0.),_cpu_time(0.),
+                                                                        _items_processed(0),_bytes_processed(0)
+{
+}
+
+/*!
+ * Returns true as long as another iteration is needed. The time between two calls is measured, except between pauseTiming and resumeTiming.
+ */
+bool State::keepRunning()
+{
+  if(!_started)
+    {
+      _started=true;
+      resumeTiming();
+      return true;
+    }
+  _iterations++;
+  if(_iterations<_min_iterations || _real_time+std::chrono::duration<double>(std::chrono::steady_clock::now()-_real_start).count()<_min_time)
+    return true;
+  pauseTiming();
+  return false;
+}
+
+void State::pauseTiming()
+{
+  if(_paused)
+    return ;
+  _real_time+=std::chrono::duration<double>(std::chrono::steady_clock::now()-_real_start).count();
+  _cpu_time+=(double)(std::clock()-_cpu_start)/CLOCKS_PER_SEC;
+  _paused=true;
+}
+
+void State::resumeTiming()
+{
+  _paused=false;
+  _cpu_start=std::clock();
+  _real_start=std::chrono::steady_clock::now();
+}
+
+int Registry::Register(const std::string& name, Function function, const std::vector<mcIdType>& sizes)
+{
+  Entry entry;
+  entry._name=name;
+  entry._function=function;
+  entry._sizes=sizes;
+  Entries().push_back(entry);
+  return (int)Entries().size();
+}
+
+const std::vector<Registry::Entry>& Registry::GetEntries()
+{
+  return Entries();
+}
+
+std::vector<Registry::Entry>& Registry::Entries()
+{
+  static std::vector<Entry> entries;
+  return entries;
+}
+
+namespace
+{
+  struct Options
+  {
+    std::string _filter=".*";
+    double _min_time=0.5;
+    std::size_t _min_iterations=1;
+    std::size_t _repetitions=1;
+    double _scale=1.;
+    std::string _format="console";
+    std::string _out;
+    bool _list=false;
+  };
+
+  struct Run
+  {
+    std::string _name;
+    std::string _run_name;
+    std::string _run_type;
+    std::string _aggregate_name;
+    std::size_t _repetitions;
+    std::size_t _repetition_index;
+    std::size_t _iterations;
+    //! times per iteration, in ms
+    double _real_time;
+    double _cpu_time;
+    double _items_per_second;
+    double _bytes_per_second;
+    std::map<std::string,double> _counters;
+  };
+
+  void PrintUsage(const char *prog)
+  {
+    std::cout << "Usage : " << prog << " [options]" << std::endl
+              << "  --benchmark_filter=<regex>        run only the benchmarks whose name \"<name>/<size>\" matches <regex>" << std::endl
+              << "  --benchmark_list_tests            list the benchmarks without running them" << std::endl
+              << "  --benchmark_min_time=<seconds>    minimal time of a run (default 0.5)" << std::endl
+              << "  --benchmark_min_iterations=<n>    minimal number of iterations of a run (default 1)" << std::endl
+              << "  --benchmark_repetitions=<n>       number of runs of each benchmark, aggregated by mean, median and stddev (default 1)" << std::endl
+              << "  --benchmark_scale=<factor>        factor applied to the sizes of all the benchmarks (default 1)" << std::endl
+              << "  --benchmark_format=console|json   format of the standard output (default console)" << std::endl
+              << "  --benchmark_out=<file>            also write the results in JSON in <file>" << std::endl;
+  }
+
+  bool StartsWith(const std::string& arg, const std::string& key, std::string& value)
+  {
+    if(arg.compare(0,key.size(),key)!=0)
+      return false;
+    value=arg.substr(key.size());
+    return true;
+  }
+
+  Options ParseArgs(int argc, char *argv[])
+  {
+    Options ret;
+    for(int i=1;i<argc;i++)
+      {
+        std::string arg(argv[i]),value;
+        if(StartsWith(arg,"--benchmark_filter=",value))
+          ret._filter=value;
+        else if(arg=="--benchmark_list_tests" || arg=="--benchmark_list_tests=true")
+          ret._list=true;
+        else if(StartsWith(arg,"--benchmark_min_time=",value))
+          ret._min_time=std::stod(value);
+        else if(StartsWith(arg,"--benchmark_min_iterations=",value))
+          ret._min_iterations=std::stoul(value);
+        else if(StartsWith(arg,"--benchmark_repetitions=",value))
+          ret._repetitions=std::max<std::size_t>(std::stoul(value),1);
+        else if(StartsWith(arg,"--benchmark_scale=",value))
+          ret._scale=std::stod(value);
+        else if(StartsWith(arg,"--benchmark_format=",value))
+          ret._format=value;
+        else if(StartsWith(arg,"--benchmark_out=",value))
+          ret._out=value;
+        else
+          {
+            std::ostringstream oss; oss << "Unrecognized option \"" << arg << "\" ! Use --help to get the list of options.";
+            throw INTERP_KERNEL::Exception(oss.str());
+          }
+      }
+    if(ret._format!="console" && ret._format!="json")
+      throw INTERP_KERNEL::Exception("Option --benchmark_format expects console or json !");
+    if(ret._scale<=0.)
+      throw INTERP_KERNEL::Exception("Option --benchmark_scale expects a positive factor !");
+    return ret;
+  }
+
+  Run MakeRun(const std::string& name, const State& state, std::size_t repetitions, std::size_t repetitionIndex)
+  {
+    Run ret;
+    ret._name=name; ret._run_name=name; ret._run_type="iteration";
+    ret._repetitions=repetitions; ret._repetition_index=repetitionIndex;
+    ret._iterations=state.iterations();
+    double nbOfIter((double)std::max<std::size_t>(state.iterations(),1));
+    ret._real_time=1e3*state.getRealTime()/nbOfIter;
+    ret._cpu_time=1e3*state.getCPUTime()/nbOfIter;
+    ret._items_per_second=state.getRealTime()>0.?(double)state.getItemsProcessed()/state.getRealTime():0.;
+    ret._bytes_per_second=state.getRealTime()>0.?(double)state.getBytesProcessed()/state.getRealTime():0.;
+    ret._counters=state.getCounters();
+    return ret;
+  }
+
+  double Aggregate(const std::vector<double>& values, const std::string& aggregateName)
+  {
+    double mean(std::accumulate(values.begin(),values.end(),0.)/(double)values.size());
+    if(aggregateName=="mean")
+      return mean;
+    if(aggregateName=="median")
+      {
+        std::vector<double> tmp(values);
+        std::sort(tmp.begin(),tmp.end());
+        std::size_t sz(tmp.size());
+        return sz%2==1?tmp[sz/2]:(tmp[sz/2-1]+tmp[sz/2])/2.;
+      }
+    double ret(0.);
+    for(std::vector<double>::const_iterator it=values.begin();it!=values.end();it++)
+      ret+=(*it-mean)*(*it-mean);
+    return values.size()>1?std::sqrt(ret/(double)(values.size()-1)):0.;
+  }
+
+  //! mean, median and stddev of the repetitions of a benchmark
+  std::vector<Run> AggregateRuns(const std::vector<Run>& runs)
+  {
+    std::vector<Run> ret;
+    const char *aggregateNames[3]={"mean","median","stddev"};
+    for(int i=0;i<3;i++)
+      {
+        Run agg(runs.front());
+        agg._name=runs.front()._name+"_"+aggregateNames[i];
+        agg._run_type="aggregate"; agg._aggregate_name=aggregateNames[i];
+        std::vector<double> realTimes,cpuTimes,items,bytes;
+        for(std::vector<Run>::const_iterator it=runs.begin();it!=runs.end();it++)
+          {
+            realTimes.push_back((*it)._real_time); cpuTimes.push_back((*it)._cpu_time);
+            items.push_back((*it)._items_per_second); bytes.push_back((*it)._bytes_per_second);
+          }
+        agg._real_time=Aggregate(realTimes,aggregateNames[i]);
+        agg._cpu_time=Aggregate(cpuTimes,aggregateNames[i]);
+        agg._items_per_second=Aggregate(items,aggregateNames[i]);
+        agg._bytes_per_second=Aggregate(bytes,aggregateNames[i]);
+        for(std::map<std::string,double>::iterator it=agg._counters.begin();it!=agg._counters.end();it++)
+          {
+            std::vector<double> values;
+            for(std::vector<Run>::const_iterator it2=runs.begin();it2!=runs.end();it2++)
+              values.push_back((*it2)._counters.count((*it).first)?(*it2)._counters.find((*it).first)->second:0.);
+            (*it).second=Aggregate(values,aggregateNames[i]);
+          }
+        ret.push_back(agg);
+      }
+    return ret;
+  }
+
+  std::string JSONString(const std::string& str)
+  {
+    std::ostringstream oss; oss << '"';
+    for(std::string::const_iterator it=str.begin();it!=str.end();it++)
+      {
+        if(*it=='"' || *it=='\\')
+          oss << '\\' << *it;
+        else if((unsigned char)*it<0x20)
+          oss << "\\u" << std::hex << std::setw(4) << std::setfill('0') << (int)(unsigned char)*it << std::dec;
+        else
+          oss << *it;
+      }
+    oss << '"';
+    return oss.str();
+  }
+
+  void WriteJSON(std::ostream& os, const std::vector<Run>& runs, const char *prog)
+  {
+    std::time_t now(std::time(nullptr));
+    char date[64];
+    std::strftime(date,sizeof(date),"%Y-%m-%dT%H:%M:%S",std::localtime(&now));
+    os << std::setprecision(17);
+    os << "{" << std::endl << "  \"context\": {" << std::endl;
+    os << "    \"date\": " << JSONString(date) << "," << std::endl;
+    os << "    \"executable\": " << JSONString(prog) << "," << std::endl;
+    os << "    \"num_cpus\": " << std::thread::hardware_concurrency() << "," << std::endl;
+    os << "    \"medcoupling_version\": " << JSONString(MEDCoupling::MEDCouplingVersionStr()) << "," << std::endl;
+    os << "    \"medcoupling_id_size\": " << MEDCoupling::MEDCouplingSizeOfIDs() << "," << std::endl;
+#ifdef NDEBUG
+    os << "    \"library_build_type\": \"release\"" << std::endl;
+#else
+    os << "    \"library_build_type\": \"debug\"" << std::endl;
+#endif
+    os << "  }," << std::endl << "  \"benchmarks\": [";
+    for(std::vector<Run>::const_iterator it=runs.begin();it!=runs.end();it++)
+      {
+        os << (it==runs.begin()?"":",") << std::endl << "    {" << std::endl;
+        os << "      \"name\": " << JSONString((*it)._name) << "," << std::endl;
+        os << "      \"run_name\": " << JSONString((*it)._run_name) << "," << std::endl;
+        os << "      \"run_type\": " << JSONString((*it)._run_type) << "," << std::endl;
+        if(!(*it)._aggregate_name.empty())
+          os << "      \"aggregate_name\": " << JSONString((*it)._aggregate_name) << "," << std::endl;
+        os << "      \"repetitions\": " << (*it)._repetitions << "," << std::endl;
+        if((*it)._aggregate_name.empty())
+          os << "      \"repetition_index\": " << (*it)._repetition_index << "," << std::endl;
+        os << "      \"iterations\": " << (*it)._iterations << "," << std::endl;
+        os << "      \"real_time\": " << (*it)._real_time << "," << std::endl;
+        os << "      \"cpu_time\": " << (*it)._cpu_time << "," << std::endl;
+        if((*it)._items_per_second>0.)
+          os << "      \"items_per_second\": " << (*it)._items_per_second << "," << std::endl;
+        if((*it)._bytes_per_second>0.)
+          os << "      \"bytes_per_second\": " << (*it)._bytes_per_second << "," << std::endl;
+        for(std::map<std::string,double>::const_iterator it2=(*it)._counters.begin();it2!=(*it)._counters.end();it2++)
+          os << "      " << JSONString((*it2).first) << ": " << (*it2).second << "," << std::endl;
+        os << "      \"time_unit\": \"ms\"" << std::endl << "    }";
+      }
+    os << std::endl << "  ]" << std::endl << "}" << std::endl;
+  }
+
+  void WriteConsoleHeader(std::ostream& os)
+  {
+    os << std::left << std::setw(60) << "Benchmark" << std::right << std::setw(14) << "Time (ms)" << std::setw(14) << "CPU (ms)"
+       << std::setw(12) << "Iterations" << "  Counters" << std::endl << std::string(120,'-') << std::endl;
+  }
+
+  void WriteConsoleRun(std::ostream& os, const Run& run)
+  {
+    os << std::left << std::setw(60) << run._name << std::right << std::fixed << std::setprecision(4) << std::setw(14) << run._real_time
+       << std::setw(14) << run._cpu_time << std::setw(12) << run._iterations << std::defaultfloat << std::setprecision(6);
+    if(run._items_per_second>0.)
+      os << "  items_per_second=" << run._items_per_second;
+    if(run._bytes_per_second>0.)
+      os << "  bytes_per_second=" << run._bytes_per_second;
+    for(std::map<std::string,double>::const_iterator it=run._counters.begin();it!=run._counters.end();it++)
+      os << "  " << (*it).first << "=" << (*it).second;
+    os << std::endl;
+  }
+}
+
+/*!
+ * Runs the registered benchmarks selected by the command line options (see --help), and reports their results on the standard output
+ * and optionally in a JSON file following the format of Google Benchmark, so that the tools comparing runs of Google Benchmark can be used.
+ * \return 0 on success.
+ */
+int MEDCouplingBenchmark::RunBenchmarks(int argc, char *argv[])
+{
+  for(int i=1;i<argc;i++)
+    if(std::string(argv[i])=="--help" || std::string(argv[i])=="-h")
+      {
+        PrintUsage(argv[0]);
+        return 0;
+      }
+  Options options;
+  std::regex filter;
+  try
+    {
+      options=ParseArgs(argc,argv);
+      filter=std::regex(options._filter);
+    }
+  catch(std::exception& e)
+    {
+      std::cerr << e.what() << std::endl;
+      return 1;
+    }
+  std::vector< std::pair<std::string,std::pair<Function,mcIdType> > > selected;
+  const std::vector<Registry::Entry>& entries(Registry::GetEntries());
+  for(std::vector<Registry::Entry>::const_iterator it=entries.begin();it!=entries.end();it++)
+    for(std::vector<mcIdType>::const_iterator it2=(*it)._sizes.begin();it2!=(*it)._sizes.end();it2++)
+      {
+        mcIdType size(std::max<mcIdType>((mcIdType)std::llround((double)*it2*options._scale),1));
+        std::ostringstream oss; oss << (*it)._name << "/" << size;
+        if(std::regex_search(oss.str(),filter))
+          selected.push_back(std::make_pair(oss.str(),std::make_pair((*it)._function,size)));
+      }
+  if(options._list)
+    {
+      for(std::vector< std::pair<std::string,std::pair<Function,mcIdType> > >::const_iterator it=selected.begin();it!=selected.end();it++)
+        std::cout << (*it).first << std::endl;
+      return 0;
+    }
+  bool console(options._format=="console");
+  if(console)
+    WriteConsoleHeader(std::cout);
+  std::vector<Run> runs;
+  int ret(0);
+  for(std::vector< std::pair<std::string,std::pair<Function,mcIdType> > >::const_iterator it=selected.begin();it!=selected.end();it++)
+    {
+      std::vector<Run> reps;
+      try
+        {
+          for(std::size_t rep=0;rep<options._repetitions;rep++)
+            {
+              State state((*it).second.second,options._min_time,options._min_iterations);
+              (*it).second.first(state);
+              reps.push_back(MakeRun((*it).first,state,options._repetitions,rep));
+              if(console)
+                WriteConsoleRun(std::cout,reps.back());
+            }
+        }
+      catch(INTERP_KERNEL::Exception& e)
+        {
+          std::cerr << (*it).first << " : " << e.what() << std::endl;
+          ret=1;
+          continue;
+        }
+      runs.insert(runs.end(),reps.begin(),reps.end());
+      if(options._repetitions>1)
+        {
+          std::vector<Run> aggs(AggregateRuns(reps));
+          if(console)
+            for(std::vector<Run>::const_iterator it2=aggs.begin();it2!=aggs.end();it2++)
+              WriteConsoleRun(std::cout,*it2);
+          runs.insert(runs.end(),aggs.begin(),aggs.end());
+        }
+    }
+  if(!console)
+    WriteJSON(std::cout,runs,argv[0]);
+  if(!options._out.empty())
+    {
+      std::ofstream ofs(options._out.c_str());
+      if(!ofs)
+        {
+          std::cerr << "Unable to open file \"" << options._out << "\" for writing !" << std::endl;
+          return 1;
+        }
+      WriteJSON(ofs,runs,argv[0]);
+    }
+  return ret;
+}
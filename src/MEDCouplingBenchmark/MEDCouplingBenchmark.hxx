@@ -0,0 +1,116 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#pragma once
+
+#include "MCType.hxx"
+
+#include <map>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <ctime>
+
+namespace MEDCouplingBenchmark
+{
+  /*!
+   * State of a benchmark run, given to the benchmark function. The code to measure is the body of a loop on keepRunning(),
+   * which is run until both the minimal number of iterations and the minimal time are reached :
+   *
+   * \code
+   * void BenchSort(State& state)
+   * {
+   *   MCAuto<DataArrayDouble> arr(BuildRandomArray(state.size()));   // not measured
+   *   while(state.keepRunning())
+   *     {
+   *       state.pauseTiming();
+   *       MCAuto<DataArrayDouble> work(arr->deepCopy());                // not measured
+   *       state.resumeTiming();
+   *       work->sort();                                                 // measured
+   *     }
+   *   state.setItemsProcessed(state.iterations()*state.size());
+   * }
+   * MEDCOUPLING_BENCHMARK(BenchSort,1000,1000000);
+   * \endcode
+   */
+  class State
+  {
+  public:
+    State(mcIdType size, double minTime, std::size_t minIterations);
+    //! the size given at registration, multiplied by the scale of the run
+    mcIdType size() const { return _size; }
+    bool keepRunning();
+    void pauseTiming();
+    void resumeTiming();
+    std::size_t iterations() const { return _iterations; }
+    void setItemsProcessed(std::size_t nbOfItems) { _items_processed=nbOfItems; }
+    void setBytesProcessed(std::size_t nbOfBytes) { _bytes_processed=nbOfBytes; }
+    void setCounter(const std::string& name, double value) { _counters[name]=value; }
+    double getRealTime() const { return _real_time; }
+    double getCPUTime() const { return _cpu_time; }
+    std::size_t getItemsProcessed() const { return _items_processed; }
+    std::size_t getBytesProcessed() const { return _bytes_processed; }
+    const std::map<std::string,double>& getCounters() const { return _counters; }
+  private:
+    mcIdType _size;
+    double _min_time;
+    std::size_t _min_iterations;
+    std::size_t _iterations;
+    bool _started;
+    bool _paused;
+    std::chrono::steady_clock::time_point _real_start;
+    std::clock_t _cpu_start;
+    //! accumulated times in seconds
+    double _real_time;
+    double _cpu_time;
+    std::size_t _items_processed;
+    std::size_t _bytes_processed;
+    std::map<std::string,double> _counters;
+  };
+
+  typedef void (*Function)(State&);
+
+  /*!
+   * Registered benchmarks. Each benchmark is run once for each of its sizes, under the name "<name>/<size>".
+   */
+  class Registry
+  {
+  public:
+    struct Entry
+    {
+      std::string _name;
+      Function _function;
+      std::vector<mcIdType> _sizes;
+    };
+  public:
+    static int Register(const std::string& name, Function function, const std::vector<mcIdType>& sizes);
+    static const std::vector<Entry>& GetEntries();
+  private:
+    static std::vector<Entry>& Entries();
+  };
+
+  int RunBenchmarks(int argc, char *argv[]);
+}
+
+#define MEDCOUPLING_BENCHMARK_CAT2(a,b) a##b
+#define MEDCOUPLING_BENCHMARK_CAT(a,b) MEDCOUPLING_BENCHMARK_CAT2(a,b)
+
+//! registers the benchmark function \a func, run for each of the given sizes
+#define MEDCOUPLING_BENCHMARK(func,...) \
+  static const int MEDCOUPLING_BENCHMARK_CAT(func##_registered_,__LINE__)=MEDCouplingBenchmark::Registry::Register(#func,func,{__VA_ARGS__})
@@ -0,0 +1,34 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "MEDCouplingBenchmark.hxx"
+
+/**
+ * Runs the micro and macro benchmarks of the core kernels of MEDCoupling on synthetic meshes of scalable size.
+ *
+ * USAGE : MEDCouplingBenchmark [--benchmark_filter=<regex>] [--benchmark_scale=<factor>] [--benchmark_repetitions=<n>]
+ *                              [--benchmark_format=console|json] [--benchmark_out=<file.json>] ...
+ *         (see MEDCouplingBenchmark --help)
+ *
+ * The JSON output follows the format of Google Benchmark, so that runs of two releases can be compared with its tools (compare.py).
+ */
+int main(int argc, char *argv[])
+{
+  return MEDCouplingBenchmark::RunBenchmarks(argc,argv);
+}
@@ -0,0 +1,116 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "MEDCouplingBenchmarkMeshes.hxx"
+#include "MEDCouplingCMesh.hxx"
+#include "InterpKernelException.hxx"
+
+#include <cmath>
+#include <random>
+#include <algorithm>
+
+using namespace MEDCoupling;
+
+namespace
+{
+  //! number of cells along each direction so that a cartesian mesh of dimension \a meshDim has about \a nbOfCells cells
+  mcIdType NbOfCellsPerDir(int meshDim, mcIdType nbOfCells)
+  {
+    return std::max<mcIdType>((mcIdType)std::llround(std::pow((double)nbOfCells,1./(double)meshDim)),1);
+  }
+}
+
+/*!
+ * Returns an array of \a nbOfTuples tuples of uniformly distributed values in [0,1).
+ */
+MCAuto<DataArrayDouble> MEDCouplingBenchmark::BuildRandomArray(mcIdType nbOfTuples, std::size_t nbOfCompo, unsigned int seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_real_distribution<double> dist(0.,1.);
+  MCAuto<DataArrayDouble> ret(DataArrayDouble::New()); ret->alloc(nbOfTuples,nbOfCompo);
+  for(double *pt=ret->rwBegin();pt!=ret->rwEnd();pt++)
+    *pt=dist(gen);
+  return ret;
+}
+
+/*!
+ * Returns an array of \a nbOfTuples uniformly distributed ids in [0,\a maxValue).
+ */
+MCAuto<DataArrayIdType> MEDCouplingBenchmark::BuildRandomIdArray(mcIdType nbOfTuples, mcIdType maxValue, unsigned int seed)
+{
+  std::mt19937 gen(seed);
+  std::uniform_int_distribution<mcIdType> dist(0,std::max<mcIdType>(maxValue,1)-1);
+  MCAuto<DataArrayIdType> ret(DataArrayIdType::New()); ret->alloc(nbOfTuples,1);
+  for(mcIdType *pt=ret->rwBegin();pt!=ret->rwEnd();pt++)
+    *pt=dist(gen);
+  return ret;
+}
+
+/*!
+ * Returns a random permutation of [0,\a nbOfTuples).
+ */
+MCAuto<DataArrayIdType> MEDCouplingBenchmark::BuildRandomPermutation(mcIdType nbOfTuples, unsigned int seed)
+{
+  std::mt19937 gen(seed);
+  MCAuto<DataArrayIdType> ret(DataArrayIdType::New()); ret->alloc(nbOfTuples,1); ret->iota(0);
+  std::shuffle(ret->rwBegin(),ret->rwEnd(),gen);
+  return ret;
+}
+
+/*!
+ * Returns an unstructured mesh of quadrangles (\a meshDim 2) or hexahedra (\a meshDim 3) of the unit square or cube translated of \a shift
+ * along each axis, with about \a nbOfCells cells.
+ */
+MCAuto<MEDCouplingUMesh> MEDCouplingBenchmark::BuildCartesianUMesh(int meshDim, mcIdType nbOfCells, double shift)
+{
+  if(meshDim<1 || meshDim>3)
+    throw INTERP_KERNEL::Exception("BuildCartesianUMesh : mesh dimension must be 1, 2 or 3 !");
+  mcIdType n(NbOfCellsPerDir(meshDim,nbOfCells));
+  MCAuto<DataArrayDouble> arr(DataArrayDouble::New()); arr->alloc(n+1,1); arr->iota(0.);
+  arr->applyLin(1./(double)n,shift);
+  MCAuto<MEDCouplingCMesh> cmesh(MEDCouplingCMesh::New("Mesh"));
+  for(int i=0;i<meshDim;i++)
+    cmesh->setCoordsAt(i,arr);
+  MCAuto<MEDCouplingUMesh> ret(cmesh->buildUnstructured());
+  return ret;
+}
+
+/*!
+ * Returns the mesh of BuildCartesianUMesh split in triangles (\a meshDim 2) or tetrahedra (\a meshDim 3).
+ */
+MCAuto<MEDCouplingUMesh> MEDCouplingBenchmark::BuildSimplexUMesh(int meshDim, mcIdType nbOfCells, double shift)
+{
+  MCAuto<MEDCouplingUMesh> ret(BuildCartesianUMesh(meshDim,meshDim==2?nbOfCells/2:nbOfCells/5,shift));
+  MCAuto<DataArrayIdType> tmp(ret->simplexize(meshDim==2?0:(int)INTERP_KERNEL::PLANAR_FACE_5));
+  return ret;
+}
+
+/*!
+ * Returns a mesh of about \a nbOfCells quadrangles in 3D, on a wavy surface above the unit square.
+ */
+MCAuto<MEDCouplingUMesh> MEDCouplingBenchmark::BuildSurfUMesh3D(mcIdType nbOfCells, double shift)
+{
+  MCAuto<MEDCouplingUMesh> ret(BuildCartesianUMesh(2,nbOfCells,shift));
+  ret->changeSpaceDimension(3);
+  DataArrayDouble *coords(ret->getCoords());
+  double *pt(coords->getPointer());
+  for(mcIdType i=0;i<coords->getNumberOfTuples();i++,pt+=3)
+    pt[2]=0.05*std::sin(4.*pt[0])*std::cos(4.*pt[1]);
+  return ret;
+}
@@ -0,0 +1,39 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#pragma once
+
+#include "MCType.hxx"
+#include "MCAuto.hxx"
+#include "MEDCouplingUMesh.hxx"
+#include "MEDCouplingMemArray.hxx"
+
+/*!
+ * Synthetic meshes and arrays of scalable size used by the benchmarks. All of them are deterministic, so that two runs of a benchmark
+ * work on the same data.
+ */
+namespace MEDCouplingBenchmark
+{
+  MEDCoupling::MCAuto<MEDCoupling::DataArrayDouble> BuildRandomArray(mcIdType nbOfTuples, std::size_t nbOfCompo=1, unsigned int seed=0);
+  MEDCoupling::MCAuto<MEDCoupling::DataArrayIdType> BuildRandomIdArray(mcIdType nbOfTuples, mcIdType maxValue, unsigned int seed=0);
+  MEDCoupling::MCAuto<MEDCoupling::DataArrayIdType> BuildRandomPermutation(mcIdType nbOfTuples, unsigned int seed=0);
+  MEDCoupling::MCAuto<MEDCoupling::MEDCouplingUMesh> BuildCartesianUMesh(int meshDim, mcIdType nbOfCells, double shift=0.);
+  MEDCoupling::MCAuto<MEDCoupling::MEDCouplingUMesh> BuildSimplexUMesh(int meshDim, mcIdType nbOfCells, double shift=0.);
+  MEDCoupling::MCAuto<MEDCoupling::MEDCouplingUMesh> BuildSurfUMesh3D(mcIdType nbOfCells, double shift=0.);
+}
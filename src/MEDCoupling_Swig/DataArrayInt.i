@@ -49,6 +49,8 @@
     ARRAY *sumPerTuple() const;
     void sort(bool asc=true);
     void reverse();
+    void writeRawFile(const std::string& fileName, int64_t tag=0) const;
+    int64_t useMappedRawFile(const std::string& fileName, bool copyOnWrite=false);
     void checkMonotonic(bool increasing) const;
     bool isMonotonic(bool increasing) const;
     void checkStrictlyMonotonic(bool increasing) const;
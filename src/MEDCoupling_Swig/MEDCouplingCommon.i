@@ -342,6 +342,7 @@ typedef long mcPyPtrType;
 %newobject MEDCoupling::MEDCouplingPointSet::getCellIdsLyingOnNodes;
 %newobject MEDCoupling::MEDCouplingPointSet::deepCopyConnectivityOnly;
 %newobject MEDCoupling::MEDCouplingPointSet::getBoundingBoxForBBTree;
+%newobject MEDCoupling::MEDCouplingPointSet::getBoundingBoxesOfCellClusters;
 %newobject MEDCoupling::MEDCouplingPointSet::computeFetchedNodeIds;
 %newobject MEDCoupling::MEDCouplingPointSet::ComputeNbOfInteractionsWithSrcCells;
 %newobject MEDCoupling::MEDCouplingPointSet::computeDiameterField;
@@ -383,6 +384,7 @@ typedef long mcPyPtrType;
 %newobject MEDCoupling::MEDCouplingUMesh::getPartMeasureField;
 %newobject MEDCoupling::MEDCouplingUMesh::buildPartOrthogonalField;
 %newobject MEDCoupling::MEDCouplingUMesh::keepCellIdsByType;
+%newobject MEDCoupling::MEDCouplingUMesh::LoadFromRawFiles;
 %newobject MEDCoupling::MEDCouplingUMesh::Build0DMeshFromCoords;
 %newobject MEDCoupling::MEDCouplingUMesh::Build1DMeshFromCoords;
 %newobject MEDCoupling::MEDCouplingUMesh::findAndCorrectBadOriented3DExtrudedCells;
@@ -398,6 +400,7 @@ typedef long mcPyPtrType;
 %newobject MEDCoupling::MEDCouplingUMesh::buildUnionOf2DMesh;
 %newobject MEDCoupling::MEDCouplingUMesh::buildUnionOf3DMesh;
 %newobject MEDCoupling::MEDCouplingUMesh::generateGraph;
+%newobject MEDCoupling::MEDCouplingUMesh::getCellsInBoundingBoxes;
 %newobject MEDCoupling::MEDCouplingUMesh::orderConsecutiveCells1D;
 %newobject MEDCoupling::MEDCouplingUMesh::clipSingle3DCellByPlane;
 %newobject MEDCoupling::MEDCouplingUMesh::getBoundingBoxForBBTreeFast;
@@ -1526,6 +1529,7 @@ namespace MEDCoupling
       virtual bool isEmptyMesh(const std::vector<mcIdType>& tinyInfo) const;
       virtual MEDCouplingPointSet *deepCopyConnectivityOnly() const;
       virtual DataArrayDouble *getBoundingBoxForBBTree(double arcDetEps=1e-12) const;
+      DataArrayDouble *getBoundingBoxesOfCellClusters(int nbOfLevels, double arcDetEps=1e-12) const;
       virtual void renumberNodesWithOffsetInConn(int offset);
       virtual bool areAllNodesFetched() const;
       virtual MEDCouplingFieldDouble *computeDiameterField() const;
@@ -2148,6 +2152,7 @@ namespace MEDCoupling
     DataArrayIdType *findAndCorrectBadOriented3DCells();
     MEDCoupling::MEDCoupling1GTUMesh *convertIntoSingleGeoTypeMesh() const;
     MEDCouplingSkyLineArray *generateGraph() const;
+    MEDCouplingSkyLineArray *getCellsInBoundingBoxes(const DataArrayDouble *bboxes, double eps) const;
     DataArrayIdType *convertNodalConnectivityToStaticGeoTypeMesh() const;
     DataArrayIdType *buildUnionOf2DMesh() const;
     DataArrayIdType *buildUnionOf3DMesh() const;
@@ -2159,6 +2164,8 @@ namespace MEDCoupling
     void orientCorrectly2DCells(const MEDCouplingUMesh *refFaces);
     DataArrayDouble *computeCellCenterOfMassWithPrecision(double eps);
     int split2DCells(const DataArrayIdType *desc, const DataArrayIdType *descI, const DataArrayIdType *subNodesInSeg, const DataArrayIdType *subNodesInSegI, const DataArrayIdType *midOpt=0, const DataArrayIdType *midOptI=0);
+    void writeRawFiles(const std::string& prefix) const;
+    static MEDCouplingUMesh *LoadFromRawFiles(const std::string& prefix, bool copyOnWrite=false);
     static MEDCouplingUMesh *Build0DMeshFromCoords(DataArrayDouble *da);
     static MEDCouplingUMesh *MergeUMeshes(const MEDCouplingUMesh *mesh1, const MEDCouplingUMesh *mesh2);
     static MEDCouplingUMesh *MergeUMeshesOnSameCoords(const MEDCouplingUMesh *mesh1, const MEDCouplingUMesh *mesh2);
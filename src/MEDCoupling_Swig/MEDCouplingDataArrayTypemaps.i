@@ -342,6 +342,12 @@ PyObject *ToNumPyArrayUnderground(MCData *self, int npyObjectType, const char *M
   int nbDims=nbComp==1?1:2;
   npy_intp dim[2];
   dim[0]=(npy_intp)nbTuples; dim[1]=(npy_intp)nbComp;
+  if(mem.isDeallocatorCalled() && mem.getDeallocator()!=numarrdeal && mem.getDeallocator()!=MEDCoupling::MemArray<T>::CDeallocator && mem.getDeallocator()!=MEDCoupling::MemArray<T>::COffsetDeallocator)
+    {// memory not coming from malloc (MEDCouplingMemoryPool, buffer given with useExternalArrayWithDeallocator) whereas numpy may have to free it
+      T *pt((T *)malloc(mem.getNbOfElem()*sizeof(T)));
+      std::copy(mem.getConstPointer(),mem.getConstPointer()+mem.getNbOfElem(),pt);
+      mem.useArray(pt,true,MEDCoupling::DeallocType::C_DEALLOC,mem.getNbOfElem());
+    }
   const T *bg=self->getConstPointer();
   PyObject *ret(PyArray_SimpleNewFromData(nbDims,dim,npyObjectType,const_cast<T *>(bg)));
   if(mem.isDeallocatorCalled())
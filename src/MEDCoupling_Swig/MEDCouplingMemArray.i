@@ -996,6 +996,8 @@ typedef DataArrayInt64 DataArrayIdType;
     bool isUniform(double val, double eps) const;
     void sort(bool asc=true);
     void reverse();
+    void writeRawFile(const std::string& fileName, int64_t tag=0) const;
+    int64_t useMappedRawFile(const std::string& fileName, bool copyOnWrite=false);
     void checkMonotonic(bool increasing, double eps) const;
     bool isMonotonic(bool increasing, double eps) const;
     std::string repr() const;
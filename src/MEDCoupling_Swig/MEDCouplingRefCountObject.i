@@ -83,6 +83,8 @@ namespace MEDCoupling
   bool MEDCouplingByteOrder();
   const char *MEDCouplingByteOrderStr();
   bool IsCXX11Compiled();
+  void MEDCouplingSetNumberOfThreads(int nbThreads);
+  int MEDCouplingGetNumberOfThreads();
   
   class BigMemoryObject
   {
@@ -50,6 +50,7 @@ namespace MEDCoupling
       ~MEDCouplingRemapper();
       int prepare(const MEDCouplingMesh *srcMesh, const MEDCouplingMesh *targetMesh, const std::string& method);
       int prepareEx(const MEDCouplingFieldTemplate *src, const MEDCouplingFieldTemplate *target);
+      mcIdType prepareIncremental(const MEDCouplingMesh *srcMesh, const MEDCouplingMesh *targetMesh, const std::string& method, double eps);
       void transfer(const MEDCouplingFieldDouble *srcField, MEDCouplingFieldDouble *targetField, double dftValue);
       void partialTransfer(const MEDCouplingFieldDouble *srcField, MEDCouplingFieldDouble *targetField);
       void reverseTransfer(MEDCouplingFieldDouble *srcField, const MEDCouplingFieldDouble *targetField, double dftValue);
@@ -65,6 +66,9 @@ namespace MEDCoupling
       int nullifiedTinyCoeffInCrudeMatrix(double scaleFactor);
       double getMaxValueInCrudeMatrix() const;
       int getNumberOfColsOfMatrix() const;
+      void saveMatrix(const std::string& fileName) const;
+      void loadMatrix(const MEDCouplingMesh *srcMesh, const MEDCouplingMesh *targetMesh, const std::string& fileName);
+      void loadMatrixEx(const MEDCouplingFieldTemplate *src, const MEDCouplingFieldTemplate *target, const std::string& fileName);
       static std::string BuildMethodFrom(const std::string& meth1, const std::string& meth2);
       %extend
          {
@@ -128,6 +132,34 @@ namespace MEDCoupling
              self->setCrudeMatrix(srcMesh,targetMesh,method,mCpp);
            }
 
+           void transferMulti(PyObject *srcFields, PyObject *targetFields, double dftValue)
+           {
+             std::vector<const MEDCouplingFieldDouble *> srcFieldsCpp;
+             convertFromPyObjVectorOfObj<const MEDCoupling::MEDCouplingFieldDouble *>(srcFields,SWIGTYPE_p_MEDCoupling__MEDCouplingFieldDouble,"MEDCouplingFieldDouble",srcFieldsCpp);
+             std::vector<MEDCouplingFieldDouble *> targetFieldsCpp;
+             convertFromPyObjVectorOfObj<MEDCoupling::MEDCouplingFieldDouble *>(targetFields,SWIGTYPE_p_MEDCoupling__MEDCouplingFieldDouble,"MEDCouplingFieldDouble",targetFieldsCpp);
+             self->transferMulti(srcFieldsCpp,targetFieldsCpp,dftValue);
+           }
+
+           PyObject *transferFields(PyObject *srcFields, double dftValue)
+           {
+             std::vector<MEDCouplingFieldDouble *> ret;
+             void *argp(0);
+             if(SWIG_IsOK(SWIG_ConvertPtr(srcFields,&argp,SWIGTYPE_p_MEDCoupling__MEDCouplingMultiFields,0)))
+               ret=self->transferFields(reinterpret_cast<const MEDCouplingMultiFields *>(argp),dftValue);
+             else
+               {
+                 std::vector<const MEDCouplingFieldDouble *> srcFieldsCpp;
+                 convertFromPyObjVectorOfObj<const MEDCoupling::MEDCouplingFieldDouble *>(srcFields,SWIGTYPE_p_MEDCoupling__MEDCouplingFieldDouble,"MEDCouplingFieldDouble",srcFieldsCpp);
+                 ret=self->transferFields(srcFieldsCpp,dftValue);
+               }
+             std::size_t sz(ret.size());
+             PyObject *res(PyList_New(sz));
+             for(std::size_t i=0;i<sz;i++)
+               PyList_SetItem(res,i,SWIG_NewPointerObj(SWIG_as_voidptr(ret[i]),SWIGTYPE_p_MEDCoupling__MEDCouplingFieldDouble, SWIG_POINTER_OWN | 0 ));
+             return res;
+           }
+
            void setCrudeMatrixEx(const MEDCouplingFieldTemplate *src, const MEDCouplingFieldTemplate *target, PyObject *m)
            {
              std::vector<std::map<mcIdType,double> > mCpp;
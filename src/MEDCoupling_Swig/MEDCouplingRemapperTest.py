@@ -1680,6 +1680,59 @@ class MEDCouplingBasicsTest(unittest.TestCase):
             mat = remap.getCrudeMatrix()
             self.checkMatrix(expectedMatrix,mat,18,1.0)
 
+    def testTransferFields1(self):
+        """ transferFields/transferMulti give the same results than transferField applied on each field."""
+        arr=DataArrayDouble(5) ; arr.iota()
+        srcMesh=MEDCouplingCMesh() ; srcMesh.setCoords(arr,arr) ; srcMesh=srcMesh.buildUnstructured()
+        trgMesh=srcMesh.deepCopy() ; trgMesh.translate([0.3,0.3])
+        remap=MEDCouplingRemapper()
+        self.assertEqual(remap.prepare(srcMesh,trgMesh,"P0P0"),1)
+        fs=[]
+        for i,(nat,nbCompo) in enumerate([(IntensiveMaximum,1),(ExtensiveConservation,3),(IntensiveMaximum,2)]):
+            f=MEDCouplingFieldDouble(ON_CELLS) ; f.setMesh(srcMesh) ; f.setName("f%d"%i) ; f.setNature(nat)
+            a=DataArrayDouble(16*nbCompo) ; a.iota(float(i)) ; a.rearrange(nbCompo) ; f.setArray(a)
+            fs.append(f)
+            pass
+        res=remap.transferFields(fs,-7.)
+        self.assertEqual(len(res),3)
+        for f,r in zip(fs,res):
+            self.assertEqual(r.getName(),f.getName())
+            self.assertTrue(r.getArray().isEqual(remap.transferField(f,-7.).getArray(),0.))
+            pass
+        self.assertTrue(res[0].getArray().isEqual(remap.transferFields(MEDCouplingMultiFields.New(fs),-7.)[0].getArray(),0.))
+        trgs=[MEDCouplingFieldDouble(ON_CELLS) for f in fs]
+        for f,t in zip(fs,trgs):
+            t.setMesh(trgMesh) ; t.setNature(f.getNature())
+            pass
+        remap.transferMulti(fs,trgs,-7.)
+        for t,r in zip(trgs,res):
+            self.assertTrue(t.getArray().isEqual(r.getArray(),0.))
+            pass
+        pass
+
+    def testSaveLoadMatrix1(self):
+        """ A matrix saved with saveMatrix and reloaded with loadMatrix gives the same transfer, without computing the intersections again."""
+        import os
+        fileName="SaveLoadMatrix1.mcmat"
+        arr=DataArrayDouble(5) ; arr.iota()
+        srcMesh=MEDCouplingCMesh() ; srcMesh.setCoords(arr,arr) ; srcMesh=srcMesh.buildUnstructured()
+        trgMesh=srcMesh.deepCopy() ; trgMesh.translate([0.3,0.3]) ; trgMesh.simplexize(0)
+        remap=MEDCouplingRemapper()
+        remap.setPrecision(1e-10)
+        self.assertEqual(remap.prepare(srcMesh,trgMesh,"P0P0"),1)
+        remap.saveMatrix(fileName)
+        remap2=MEDCouplingRemapper()
+        remap2.loadMatrix(srcMesh,trgMesh,fileName)
+        self.assertEqual(remap2.getCrudeMatrix(),remap.getCrudeMatrix())
+        self.assertEqual(remap2.getPrecision(),1e-10)
+        f=MEDCouplingFieldDouble(ON_CELLS) ; f.setMesh(srcMesh) ; f.setNature(IntensiveMaximum)
+        a=DataArrayDouble(16) ; a.iota(1.) ; f.setArray(a)
+        self.assertTrue(remap2.transferField(f,-7.).getArray().isEqual(remap.transferField(f,-7.).getArray(),0.))
+        otherMesh=trgMesh.deepCopy() ; otherMesh.translate([1e-3,0.])
+        self.assertRaises(InterpKernelException,remap2.loadMatrix,srcMesh,otherMesh,fileName)
+        os.remove(fileName)
+        pass
+
     def checkMatrix(self,mat1,mat2,nbCols,eps):
         self.assertEqual(len(mat1),len(mat2))
         for i in range(len(mat1)):
@@ -328,6 +328,12 @@ catch(INTERP_KERNEL::Exception& e)
     throw e;
 }
 
+void MEDFileData::loadContentLeftInFile() const
+{
+  if(_meshes.isNotNull())
+    _meshes->loadContentLeftInFile();
+}
+
 void MEDFileData::writeLL(med_idt fid) const
 {
   writeHeader(fid);
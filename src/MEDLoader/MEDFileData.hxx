@@ -65,6 +65,7 @@ namespace MEDCoupling
     MEDLOADER_EXPORT static MCAuto<MEDFileData> Aggregate(const std::vector<const MEDFileData *>& mfds);
     //
     MEDLOADER_EXPORT void writeLL(med_idt fid) const;
+    MEDLOADER_EXPORT void loadContentLeftInFile() const override;
   private:
     MEDFileData();
     MEDFileData(med_idt fid);
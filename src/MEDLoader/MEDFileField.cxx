@@ -93,7 +93,6 @@ MEDFileFields *MEDFileFields::LoadPartOf(const std::string& fileName, bool loadA
 
 MEDFileFields *MEDFileFields::LoadSpecificEntities(const std::string& fileName, const std::vector< std::pair<TypeOfField,INTERP_KERNEL::NormalizedCellType> >& entities, bool loadAll)
 {
-  MEDFileUtilities::CheckFileForRead(fileName);
   INTERP_KERNEL::AutoCppPtr<MEDFileEntities> ent(new MEDFileStaticEntities(entities));
   MEDFileUtilities::AutoFid fid(OpenMEDFileForRead(fileName));
   return new MEDFileFields(fid,loadAll,0,ent);
@@ -2139,6 +2139,17 @@ MEDFileAnyTypeFieldMultiTSIterator *MEDFileAnyTypeFieldMultiTS::iterator()
   return new MEDFileAnyTypeFieldMultiTSIterator(this);
 }
 
+/*!
+ * Returns an iterator over the time steps of \a this, loading the arrays of the \a nbOfPrefetchedTS next time steps in background
+ * while the current one is processed. Useful when \a this has been read with \c loadAll set to \c false.
+ *  \return MEDFileAnyTypeFieldMultiTSPrefetchIterator * - a new object to be deallocated by the caller.
+ *  \sa MEDFileAnyTypeFieldMultiTSPrefetchIterator
+ */
+MEDFileAnyTypeFieldMultiTSPrefetchIterator *MEDFileAnyTypeFieldMultiTS::prefetchIterator(int nbOfPrefetchedTS)
+{
+  return new MEDFileAnyTypeFieldMultiTSPrefetchIterator(this,nbOfPrefetchedTS);
+}
+
 //= MEDFileFieldMultiTS
 
 MEDFileAnyTypeFieldMultiTS *MEDFileFieldMultiTS::shallowCpy() const
@@ -2227,4 +2238,122 @@ MEDFileAnyTypeField1TS *MEDFileAnyTypeFieldMultiTSIterator::nextt()
     return 0;
 }
 
+MEDFileAnyTypeFieldMultiTSPrefetchIterator::MEDFileAnyTypeFieldMultiTSPrefetchIterator(MEDFileAnyTypeFieldMultiTS *fmts, int nbOfPrefetchedTS):_iter_id(0),_nb_iter(0),_nb_prefetched(nbOfPrefetchedTS),_nb_loaded(0),_stop(false)
+{
+  if(nbOfPrefetchedTS<0)
+    throw INTERP_KERNEL::Exception("MEDFileAnyTypeFieldMultiTSPrefetchIterator : number of prefetched time steps must be >= 0 !");
+  if(!fmts)
+    return ;
+  _fmts.takeRef(fmts);
+  _nb_iter=fmts->getNumberOfTS();
+  _ts.resize(_nb_iter);
+  for(int i=0;i<_nb_iter;i++)
+    _ts[i]=fmts->getTimeStepAtPos(i);
+  if(!fmts->getFileName().empty())
+    {
+      std::lock_guard<std::mutex> lock(MEDFileReadMutex());
+      _session=MEDFileReadSession::New(fmts->getFileName());
+    }
+  _worker=std::thread(&MEDFileAnyTypeFieldMultiTSPrefetchIterator::prefetch,this);
+}
+
+MEDFileAnyTypeFieldMultiTSPrefetchIterator::~MEDFileAnyTypeFieldMultiTSPrefetchIterator()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stop=true;
+  }
+  _cond.notify_all();
+  if(_worker.joinable())
+    _worker.join();
+  releaseCurrent();
+  for(int i=_iter_id;i<_nb_loaded;i++)
+    _ts[i]->unloadArraysWithoutDataLoss();
+  std::lock_guard<std::mutex> lock(MEDFileReadMutex());
+  _session.nullify();
+}
+
+/*!
+ * Returns the next time step, its arrays being loaded, or NULL if the end is reached. The arrays of the time step returned by the previous
+ * call are released.
+ *  \return MEDFileAnyTypeField1TS * - a new reference to be released by the caller.
+ *  \throw If the load of the arrays of the time step failed.
+ */
+MEDFileAnyTypeField1TS *MEDFileAnyTypeFieldMultiTSPrefetchIterator::nextt()
+{
+  releaseCurrent();
+  if(_iter_id>=_nb_iter)
+    return 0;
+  int pos(_iter_id);
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _iter_id++;
+    _cond.notify_all();
+    _cond.wait(lock,[this,pos] { return _nb_loaded>pos || !_error.empty(); });
+    if(_nb_loaded<=pos)
+      throw INTERP_KERNEL::Exception(_error);
+  }
+  _current=_ts[pos];
+  _ts[pos].nullify();
+  MEDFileAnyTypeField1TS *ret(_current);
+  ret->incrRef();
+  return ret;
+}
+
+/*!
+ * Body of the background thread : loads the arrays of the time steps in order, never more than \a _nb_prefetched ahead of the requested ones.
+ */
+void MEDFileAnyTypeFieldMultiTSPrefetchIterator::prefetch()
+{
+  for(int i=0;i<_nb_iter;i++)
+    {
+      {
+        std::unique_lock<std::mutex> lock(_mutex);
+        _cond.wait(lock,[this,i] { return _stop || i<_iter_id+_nb_prefetched; });
+        if(_stop)
+          return ;
+      }
+      try
+        {
+          std::lock_guard<std::mutex> lock(MEDFileReadMutex());
+          _ts[i]->loadArraysIfNecessary();
+        }
+      catch(std::exception& e)
+        {
+          setError(e.what());
+          return ;
+        }
+      catch(...)
+        {
+          setError("");
+          return ;
+        }
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _nb_loaded=i+1;
+      }
+      _cond.notify_all();
+    }
+}
+
+/*!
+ * Called by the background thread when the load of a time step failed : the error is given to nextt, which throws it.
+ */
+void MEDFileAnyTypeFieldMultiTSPrefetchIterator::setError(const std::string& what)
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _error=what.empty()?std::string("MEDFileAnyTypeFieldMultiTSPrefetchIterator : unexpected error while loading the arrays of a time step !"):what;
+  }
+  _cond.notify_all();
+}
+
+void MEDFileAnyTypeFieldMultiTSPrefetchIterator::releaseCurrent()
+{
+  if(_current.isNull())
+    return ;
+  _current->unloadArraysWithoutDataLoss();
+  _current.nullify();
+}
+
 //= MEDFileInt32FieldMultiTS
@@ -25,6 +25,11 @@
 #include "MEDFileFieldGlobs.hxx"
 #include "MEDLoaderTraits.hxx"
 #include "MEDFileUtilities.hxx"
+#include "MEDFileReadSession.hxx"
+
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 
 namespace MEDCoupling
 {
@@ -219,6 +224,7 @@ namespace MEDCoupling
   };
 
   class MEDFileAnyTypeFieldMultiTSIterator;
+  class MEDFileAnyTypeFieldMultiTSPrefetchIterator;
   class MEDFileFastCellSupportComparator;
   /*!
    * User class.
@@ -284,6 +290,7 @@ namespace MEDCoupling
     MEDLOADER_EXPORT int getPosOfTimeStep(int iteration, int order) const;
     MEDLOADER_EXPORT int getPosGivenTime(double time, double eps=1e-8) const;
     MEDLOADER_EXPORT MEDFileAnyTypeFieldMultiTSIterator *iterator();
+    MEDLOADER_EXPORT MEDFileAnyTypeFieldMultiTSPrefetchIterator *prefetchIterator(int nbOfPrefetchedTS=1);
     MEDLOADER_EXPORT bool changeMeshNames(const std::vector< std::pair<std::string,std::string> >& modifTab);
     MEDLOADER_EXPORT const std::vector<std::string>& getInfo() const;
     MEDLOADER_EXPORT bool presenceOfMultiDiscPerGeoType() const;
@@ -459,4 +466,41 @@ namespace MEDCoupling
     int _iter_id;
     int _nb_iter;
   };
+
+  /*!
+   * Iterator over the time steps of a MEDFileAnyTypeFieldMultiTS coming from a file, whose arrays are loaded by a background thread
+   * up to \a nbOfPrefetchedTS time steps ahead of the one returned by nextt. The arrays of a time step returned by nextt are released
+   * (see MEDFileAnyTypeField1TS::unloadArraysWithoutDataLoss) at the next call to nextt, so that at most \a nbOfPrefetchedTS+1 time steps
+   * are in memory. The file is kept opened through a MEDFileReadSession while \a this is alive.
+   *
+   * The background thread calls the MED file library only while holding MEDFileReadMutex(), as do the other prefetch iterators. While \a this is alive, any other call to the MED file or HDF5 libraries made concurrently by
+   * another thread must hold MEDFileReadMutex() too. The time steps not yet returned by nextt must not be accessed, and \a fmts
+   * must not be modified.
+   */
+  class MEDFileAnyTypeFieldMultiTSPrefetchIterator
+  {
+  public:
+    MEDLOADER_EXPORT MEDFileAnyTypeFieldMultiTSPrefetchIterator(MEDFileAnyTypeFieldMultiTS *fmts, int nbOfPrefetchedTS);
+    MEDLOADER_EXPORT ~MEDFileAnyTypeFieldMultiTSPrefetchIterator();
+    MEDLOADER_EXPORT MEDFileAnyTypeField1TS *nextt();
+  private:
+    void prefetch();
+    void setError(const std::string& what);
+    void releaseCurrent();
+  private:
+    MCAuto<MEDFileAnyTypeFieldMultiTS> _fmts;
+    MCAuto<MEDFileReadSession> _session;
+    std::vector< MCAuto<MEDFileAnyTypeField1TS> > _ts;
+    MCAuto<MEDFileAnyTypeField1TS> _current;
+    int _iter_id;
+    int _nb_iter;
+    int _nb_prefetched;
+    //! number of time steps whose arrays have been loaded by _worker
+    int _nb_loaded;
+    bool _stop;
+    std::string _error;
+    std::mutex _mutex;
+    std::condition_variable _cond;
+    std::thread _worker;
+  };
 }
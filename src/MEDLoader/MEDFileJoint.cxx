@@ -252,8 +252,7 @@ MEDFileJointOneStep *MEDFileJointOneStep::New(int dt, int it)
  */
 MEDFileJointOneStep *MEDFileJointOneStep::New(const std::string& fileName, const std::string& mName, const std::string& jointName, int num)
 {
-  MEDFileUtilities::CheckFileForRead(fileName);
-  MEDFileUtilities::AutoFid fid=MEDfileOpen(fileName.c_str(), MED_ACC_RDONLY);
+  MEDFileUtilities::AutoFid fid(OpenMEDFileForRead(fileName));
   return new MEDFileJointOneStep(fid, mName, jointName, num);
 }
 
@@ -449,8 +448,7 @@ MEDFileJoint *MEDFileJoint::New()
 
 MEDFileJoint *MEDFileJoint::New(const std::string& fileName, const std::string& mName, int curJoint)
 {
-  MEDFileUtilities::CheckFileForRead(fileName);
-  MEDFileUtilities::AutoFid fid=MEDfileOpen(fileName.c_str(), MED_ACC_RDONLY);
+  MEDFileUtilities::AutoFid fid(OpenMEDFileForRead(fileName));
   return new MEDFileJoint(fid,mName,curJoint);
 }
 
@@ -633,8 +631,7 @@ MEDFileJoints *MEDFileJoints::New()
 
 MEDFileJoints *MEDFileJoints::New(const std::string& fileName, const std::string& meshName)
 {
-  MEDFileUtilities::CheckFileForRead(fileName);
-  MEDFileUtilities::AutoFid fid=MEDfileOpen(fileName.c_str(), MED_ACC_RDONLY);
+  MEDFileUtilities::AutoFid fid(OpenMEDFileForRead(fileName));
   return new MEDFileJoints( fid, meshName );
 }
 
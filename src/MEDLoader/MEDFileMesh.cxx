@@ -2502,8 +2502,7 @@ MCAuto<MEDFileUMesh> MEDFileUMesh::LoadConnectivityOnlyPartOf(med_idt fid, const
  */
 MCAuto<MEDFileUMesh> MEDFileUMesh::LoadConnectivityOnlyPartOf(const std::string& fileName, const std::string& mName, const std::vector<INTERP_KERNEL::NormalizedCellType>& types, const std::vector<mcIdType>& slicPerTyp, int dt, int it, MEDFileMeshReadSelector *mrs)
 {
-  MEDFileUtilities::CheckFileForRead(fileName);
-  MEDFileUtilities::AutoFid fid(MEDfileOpen(fileName.c_str(),MED_ACC_RDONLY));
+  MEDFileUtilities::AutoFid fid(OpenMEDFileForRead(fileName));
   return MEDFileUMesh::LoadConnectivityOnlyPartOf(fid,mName,types,slicPerTyp,dt,it,mrs);
 }
 
@@ -2526,8 +2525,7 @@ MCAuto<MEDFileUMesh> MEDFileUMesh::LoadConnectivityOnlyPartOf(const std::string&
  */
 MEDFileUMesh *MEDFileUMesh::LoadPartOf(const std::string& fileName, const std::string& mName, const std::vector<INTERP_KERNEL::NormalizedCellType>& types, const std::vector<mcIdType>& slicPerTyp, int dt, int it, MEDFileMeshReadSelector *mrs)
 {
-  MEDFileUtilities::CheckFileForRead(fileName);
-  MEDFileUtilities::AutoFid fid(MEDfileOpen(fileName.c_str(),MED_ACC_RDONLY));
+  MEDFileUtilities::AutoFid fid(OpenMEDFileForRead(fileName));
   return MEDFileUMesh::LoadPartOf(fid,mName,types,slicPerTyp,dt,it,mrs);
 }
 
@@ -2590,7 +2588,7 @@ MCAuto<DataArrayDouble>& coords, MCAuto<PartDefinition>& partCoords, MCAuto<Data
 std::size_t MEDFileUMesh::getHeapMemorySizeWithoutChildren() const
 {
   std::size_t ret(MEDFileMesh::getHeapMemorySizeWithoutChildren());
-  ret+=_ms.capacity()*(sizeof(MCAuto<MEDFileUMeshSplitL1>))+_elt_str.capacity()*sizeof(MCAuto<MEDFileEltStruct4Mesh>);
+  ret+=_ms.capacity()*(sizeof(MCAuto<MEDFileUMeshSplitL1>))+_elt_str.capacity()*sizeof(MCAuto<MEDFileEltStruct4Mesh>)+_pending_levels.capacity()/8;
   return ret;
 }
 
@@ -2608,6 +2606,7 @@ std::vector<const BigMemoryObject *> MEDFileUMesh::getDirectChildrenWithNull() c
     ret.push_back((const MEDFileUMeshSplitL1*) *it);
   for(std::vector< MCAuto<MEDFileEltStruct4Mesh> >::const_iterator it=_elt_str.begin();it!=_elt_str.end();it++)
     ret.push_back((const MEDFileEltStruct4Mesh *)*it);
+  ret.push_back((const MEDFileUMeshLazyLevels *)_lazy_levels);
   return ret;
 }
 
@@ -2624,6 +2623,7 @@ MEDFileMesh *MEDFileUMesh::createNewEmpty() const
 
 MEDFileUMesh *MEDFileUMesh::deepCopy() const
 {
+  loadAllLevelsIfNecessary();// the copy must not share the reader of the levels left in file
   MCAuto<MEDFileUMesh> ret(new MEDFileUMesh(*this));
   ret->deepCpyEquivalences(*this);
   if(_coords.isNotNull())
@@ -2666,6 +2666,8 @@ bool MEDFileUMesh::isEqual(const MEDFileMesh *other, double eps, std::string& wh
       what="Mesh types differ ! This is unstructured and other is NOT !";
       return false;
     }
+  loadAllLevelsIfNecessary();
+  otherC->loadAllLevelsIfNecessary();
   clearNonDiscrAttributes();
   otherC->clearNonDiscrAttributes();
   const DataArrayDouble *coo1=_coords;
@@ -2794,6 +2796,7 @@ bool MEDFileUMesh::isEqual(const MEDFileMesh *other, double eps, std::string& wh
  */
 void MEDFileUMesh::checkConsistency() const
 {
+  loadAllLevelsIfNecessary();
   if(!_coords || !_coords->isAllocated())
     {
       if(!_ms.size())
@@ -2870,6 +2873,7 @@ void MEDFileUMesh::checkSMESHConsistency() const
  */
 void MEDFileUMesh::clearNodeAndCellNumbers()
 {
+  loadAllLevelsIfNecessary();
   _num_coords.nullify();
   _rev_num_coords.nullify();
   _global_num_coords.nullify();
@@ -2886,6 +2890,7 @@ void MEDFileUMesh::clearNodeAndCellNumbers()
  */
 void MEDFileUMesh::clearNonDiscrAttributes() const
 {
+  loadAllLevelsIfNecessary();// a level read later would keep the attributes read from file
   MEDFileMesh::clearNonDiscrAttributes();
   if(_coords.isNotNull())
     _coords.iAmATrollConstCast()->setName("");//This parameter is not discriminant for comparison
@@ -3098,8 +3103,29 @@ void MEDFileUMesh::loadLL(med_idt fid, const std::string& mName, int dt, int it,
       std::ostringstream oss; oss << "Trying to load as unstructured an existing mesh with name '" << mName << "' !";
       throw INTERP_KERNEL::Exception(oss.str().c_str());
     }
-  loaderl2.loadAll(fid,mid,mName,dt,it,mrs);
+  if(mrs && mrs->isLevelsLazyLoading())
+    {
+      int mdim;
+      std::vector<std::string> infosOnComp(loaderl2.loadCommonPart(fid,mid,mName,dt,it,mdim));
+      if(mdim!=-4)
+        {
+          loaderl2.loadCoords(fid,infosOnComp,mName,dt,it);
+          _lazy_levels=MEDFileUMeshLazyLevels::New(fid,mName,dt,it,mdim,mrs);
+        }
+    }
+  else
+    loaderl2.loadAll(fid,mid,mName,dt,it,mrs);
   dispatchLoadedPart(fid,loaderl2,mName,mrs);
+  if(_lazy_levels.isNotNull())
+    {
+      int nbOfLevs(_lazy_levels->getNumberOfLevels());
+      _ms.resize(nbOfLevs);
+      _pending_levels.resize(nbOfLevs);
+      for(int i=0;i<nbOfLevs;i++)
+        _pending_levels[i]=!_lazy_levels->emptyLev(i);
+      if(nbOfLevs==0)
+        _lazy_levels.nullify();
+    }
   // Structure element part...
   med_int nModels(-1);
   {
@@ -3151,6 +3177,7 @@ MEDFileUMesh::~MEDFileUMesh()
 
 void MEDFileUMesh::writeMeshLL(med_idt fid) const
 {
+  loadAllLevelsIfNecessary();
   const DataArrayDouble *coo=_coords;
   INTERP_KERNEL::AutoPtr<char> maa=MEDLoaderBase::buildEmptyString(MED_NAME_SIZE);
   INTERP_KERNEL::AutoPtr<char> desc=MEDLoaderBase::buildEmptyString(MED_COMMENT_SIZE);
@@ -3193,9 +3220,15 @@ std::vector<int> MEDFileUMesh::getNonEmptyLevels() const
   std::vector<int> ret;
   int lev=0;
   for(std::vector< MCAuto<MEDFileUMeshSplitL1> >::const_iterator it=_ms.begin();it!=_ms.end();it++,lev--)
-    if((const MEDFileUMeshSplitL1 *)(*it)!=0)
-      if(!(*it)->empty())
+    {
+      if((const MEDFileUMeshSplitL1 *)(*it)!=0)
+        {
+          if(!(*it)->empty())
+            ret.push_back(lev);
+        }
+      else if(-lev<(int)_pending_levels.size() && _pending_levels[-lev])
         ret.push_back(lev);
+    }
   return ret;
 }
 
@@ -3218,6 +3251,7 @@ std::vector<int> MEDFileUMesh::getNonEmptyLevelsExt() const
 
 std::vector<int> MEDFileUMesh::getFamArrNonEmptyLevelsExt() const
 {
+  loadAllLevelsIfNecessary();
   std::vector<int> ret;
   const DataArrayIdType *famCoo(_fam_coords);
   if(famCoo)
@@ -3235,6 +3269,7 @@ std::vector<int> MEDFileUMesh::getFamArrNonEmptyLevelsExt() const
 
 std::vector<int> MEDFileUMesh::getNumArrNonEmptyLevelsExt() const
 {
+  loadAllLevelsIfNecessary();
   std::vector<int> ret;
   if(_num_coords.isNotNull())
     ret.push_back(1);
@@ -3251,6 +3286,7 @@ std::vector<int> MEDFileUMesh::getNumArrNonEmptyLevelsExt() const
 
 std::vector<int> MEDFileUMesh::getNameArrNonEmptyLevelsExt() const
 {
+  loadAllLevelsIfNecessary();
   std::vector<int> ret;
   const DataArrayAsciiChar *nameCoo(_name_coords);
   if(nameCoo)
@@ -3274,6 +3310,7 @@ std::vector<int> MEDFileUMesh::getNameArrNonEmptyLevelsExt() const
  */
 std::vector<mcIdType> MEDFileUMesh::getFamsNonEmptyLevels(const std::vector<std::string>& fams) const
 {
+  loadAllLevelsIfNecessary();
   std::vector<mcIdType> ret;
   std::vector<int> levs(getNonEmptyLevels());
   std::vector<mcIdType> famIds(getFamiliesIds(fams));
@@ -3308,6 +3345,7 @@ std::vector<mcIdType> MEDFileUMesh::getFamsNonEmptyLevelsExt(const std::vector<s
 
 mcIdType MEDFileUMesh::getMaxAbsFamilyIdInArrays() const
 {
+  loadAllLevelsIfNecessary();
   mcIdType ret=-std::numeric_limits<mcIdType>::max(),tmp=-1;
   if((const DataArrayIdType *)_fam_coords)
     {
@@ -3331,6 +3369,7 @@ mcIdType MEDFileUMesh::getMaxAbsFamilyIdInArrays() const
 
 mcIdType MEDFileUMesh::getMaxFamilyIdInArrays() const
 {
+  loadAllLevelsIfNecessary();
   mcIdType ret=-std::numeric_limits<mcIdType>::max(),tmp=-1;
   if((const DataArrayIdType *)_fam_coords)
     {
@@ -3354,6 +3393,7 @@ mcIdType MEDFileUMesh::getMaxFamilyIdInArrays() const
 
 mcIdType MEDFileUMesh::getMinFamilyIdInArrays() const
 {
+  loadAllLevelsIfNecessary();
   mcIdType ret=std::numeric_limits<mcIdType>::max(),tmp=-1;
   if((const DataArrayIdType *)_fam_coords)
     {
@@ -3384,8 +3424,12 @@ int MEDFileUMesh::getMeshDimension() const
 {
   int lev=0;
   for(std::vector< MCAuto<MEDFileUMeshSplitL1> >::const_iterator it=_ms.begin();it!=_ms.end();it++,lev++)
-    if((const MEDFileUMeshSplitL1 *)(*it)!=0)
-      return (*it)->getMeshDimension()+lev;
+    {
+      if((const MEDFileUMeshSplitL1 *)(*it)!=0)
+        return (*it)->getMeshDimension()+lev;
+      if(lev<(int)_pending_levels.size() && _pending_levels[lev])
+        return _lazy_levels->getMeshDimension();
+    }
   throw INTERP_KERNEL::Exception("MEDFileUMesh::getMeshDimension : impossible to find a mesh dimension !");
 }
 
@@ -3409,6 +3453,7 @@ int MEDFileUMesh::getSpaceDimension() const
  */
 std::string MEDFileUMesh::simpleRepr() const
 {
+  loadAllLevelsIfNecessary();
   std::ostringstream oss;
   oss << MEDFileMesh::simpleRepr();
   const DataArrayDouble *coo=_coords;
@@ -3596,6 +3641,7 @@ void MEDFileUMesh::whichAreNodesFetched(const MEDFileField1TSStructItem& st, con
 
 MEDFileMesh *MEDFileUMesh::cartesianize() const
 {
+  loadAllLevelsIfNecessary();
   if(getAxisType()==AX_CART)
     {
       incrRef();
@@ -3932,6 +3978,7 @@ void MEDFileUMesh::declarePartsUpdated() const
  */
 void MEDFileUMesh::forceComputationOfParts() const
 {
+  loadAllLevelsIfNecessary();
   for(std::vector< MCAuto<MEDFileUMeshSplitL1> >::const_iterator it=_ms.begin();it!=_ms.end();it++)
     {
       const MEDFileUMeshSplitL1 *elt(*it);
@@ -4059,6 +4106,7 @@ const MEDFileUMeshSplitL1 *MEDFileUMesh::getMeshAtLevSafe(int meshDimRelToMaxExt
   int tracucedRk=-meshDimRelToMaxExt;
   if(tracucedRk>=(int)_ms.size())
     throw INTERP_KERNEL::Exception("Invalid mesh dim relative to max given ! Too low !");
+  loadLevelIfNecessary(tracucedRk);
   if((const MEDFileUMeshSplitL1 *)_ms[tracucedRk]==0)
     throw INTERP_KERNEL::Exception("On specified lev (or entity) no cells exists !");
   return _ms[tracucedRk];
@@ -4073,6 +4121,7 @@ MEDFileUMeshSplitL1 *MEDFileUMesh::getMeshAtLevSafe(int meshDimRelToMaxExt)
   int tracucedRk=-meshDimRelToMaxExt;
   if(tracucedRk>=(int)_ms.size())
     throw INTERP_KERNEL::Exception("Invalid mesh dim relative to max given ! Too low !");
+  loadLevelIfNecessary(tracucedRk);
   if((const MEDFileUMeshSplitL1 *)_ms[tracucedRk]==0)
     throw INTERP_KERNEL::Exception("On specified lev (or entity) no cells exists !");
   return _ms[tracucedRk];
@@ -4091,6 +4140,11 @@ void MEDFileUMesh::checkMeshDimCoherency(int meshDim, int meshDimRelToMax) const
           if(ref+i!=meshDim-meshDimRelToMax)
             throw INTERP_KERNEL::Exception("MEDFileUMesh::checkMeshDimCoherency : no coherency between levels !");
         }
+      else if(i<(int)_pending_levels.size() && _pending_levels[i])
+        {
+          if(_lazy_levels->getMeshDimension()!=meshDim-meshDimRelToMax)
+            throw INTERP_KERNEL::Exception("MEDFileUMesh::checkMeshDimCoherency : no coherency between levels !");
+        }
     }
 }
 
@@ -4106,6 +4160,7 @@ void MEDFileUMesh::setCoords(DataArrayDouble *coords)
   if(coords==(DataArrayDouble *)_coords)
     return ;
   coords->checkAllocated();
+  loadAllLevelsIfNecessary();
   mcIdType nbOfTuples(coords->getNumberOfTuples());
   _coords.takeRef(coords);
   _fam_coords=DataArrayIdType::New();
@@ -4247,6 +4302,7 @@ MEDFileUMesh::crackAlong(const std::string &grp_name, bool grpMustBeFullyDup) {
 
 void MEDFileUMesh::openCrack(const std::map<mcIdType, std::map<mcIdType, mcIdType>> & c2o2nN, const double & factor) 
 {
+    loadAllLevelsIfNecessary();
     CrackAlgo::OpenCrack(this, c2o2nN, factor);
 }
 
@@ -4279,6 +4335,7 @@ void MEDFileUMesh::buildInnerBoundaryAlongM1Group(const std::string& grpNameM1,
   typedef MCAuto<MEDCouplingUMesh> MUMesh;
   typedef MCAuto<DataArrayIdType> DAInt;
 
+  loadAllLevelsIfNecessary();
   std::vector<int> levs=getNonEmptyLevels();
   if(std::find(levs.begin(),levs.end(),0)==levs.end() || std::find(levs.begin(),levs.end(),-1)==levs.end())
     throw INTERP_KERNEL::Exception("MEDFileUMesh::buildInnerBoundaryAlongM1Group : This method works only for mesh defined on level 0 and -1 !");
@@ -4487,6 +4544,7 @@ struct MEDLoaderAccVisit1
  */
 DataArrayIdType *MEDFileUMesh::zipCoords()
 {
+  loadAllLevelsIfNecessary();
   const DataArrayDouble *coo(getCoords());
   if(!coo)
     throw INTERP_KERNEL::Exception("MEDFileUMesh::zipCoords : no coordinates set in this !");
@@ -5316,6 +5374,8 @@ void MEDFileUMesh::unserialize(std::vector<double>& tinyDouble, std::vector<mcId
   mcIdType nbLevs(layer1.back()); layer1.pop_back();
   std::vector<mcIdType> levs(layer1.rbegin(),layer1.rbegin()+nbLevs); layer1.erase(layer1.end()-nbLevs,layer1.end());
   _ms.clear();
+  _pending_levels.clear();
+  _lazy_levels.nullify();
   mcIdType maxLev(-(*std::min_element(levs.begin(),levs.end())));
   _ms.resize(maxLev+1);
   for(mcIdType i=0;i<nbLevs;i++)
@@ -5408,6 +5468,7 @@ void MEDFileUMesh::removeMeshAtLevel(int meshDimRelToMax)
     throw INTERP_KERNEL::Exception("MEDFileUMesh::removeMeshAtLevel : the requested level is not existing !");
   int pos=(-meshDimRelToMax);
   _ms[pos]=0;
+  dropPendingLevel(pos);
 }
 
 /*!
@@ -5468,7 +5529,59 @@ MCAuto<MEDFileUMeshSplitL1>& MEDFileUMesh::checkAndGiveEntryInSplitL1(int meshDi
       return _ms[sz-1];
     }
   else
-    return _ms[-meshDimRelToMax];
+    {
+      dropPendingLevel(-meshDimRelToMax);
+      return _ms[-meshDimRelToMax];
+    }
+}
+
+/*!
+ * Reads from file the level \a levId of \a this if it has been left in file at loading (see MEDFileMeshReadSelector::setLevelsLazyLoading).
+ * The file is released as soon as all the levels have been read.
+ */
+void MEDFileUMesh::loadLevelIfNecessary(int levId) const
+{
+  if(levId<0 || levId>=(int)_pending_levels.size() || !_pending_levels[levId])
+    return ;
+  MCAuto<MEDFileUMeshSplitL1> lev(_lazy_levels->load(levId,const_cast<DataArrayDouble *>((const DataArrayDouble *)_coords)));
+  lev->setName(getName());
+  lev->synchronizeTinyInfo(*this);
+  _ms[levId]=lev;
+  _pending_levels[levId]=false;
+  if(std::find(_pending_levels.begin(),_pending_levels.end(),true)==_pending_levels.end())
+    {
+      _pending_levels.clear();
+      _lazy_levels.nullify();
+    }
+}
+
+void MEDFileUMesh::loadAllLevelsIfNecessary() const
+{
+  for(int levId=(int)_pending_levels.size()-1;levId>=0;levId--)
+    loadLevelIfNecessary(levId);
+}
+
+/*!
+ * Reads the levels left in file, if any, so that the file is released before \a this is written (possibly into that file).
+ */
+void MEDFileUMesh::loadContentLeftInFile() const
+{
+  loadAllLevelsIfNecessary();
+}
+
+/*!
+ * Forgets the level \a levId left in file, if any, because it is replaced or removed in \a this.
+ */
+void MEDFileUMesh::dropPendingLevel(int levId)
+{
+  if(levId<0 || levId>=(int)_pending_levels.size() || !_pending_levels[levId])
+    return ;
+  _pending_levels[levId]=false;
+  if(std::find(_pending_levels.begin(),_pending_levels.end(),true)==_pending_levels.end())
+    {
+      _pending_levels.clear();
+      _lazy_levels.nullify();
+    }
 }
 
 /*!
@@ -5654,6 +5767,7 @@ void MEDFileUMesh::setFamilyFieldArr(int meshDimRelToMaxExt, DataArrayIdType *fa
   int traducedRk=-meshDimRelToMaxExt;
   if(traducedRk>=(int)_ms.size())
     throw INTERP_KERNEL::Exception("Invalid mesh dim relative to max given ! Too low !");
+  loadLevelIfNecessary(traducedRk);
   if((MEDFileUMeshSplitL1 *)_ms[traducedRk]==0)
     throw INTERP_KERNEL::Exception("On specified lev (or entity) no cells exists !");
   return _ms[traducedRk]->setFamilyArr(famArr);
@@ -5687,6 +5801,7 @@ void MEDFileUMesh::setRenumFieldArr(int meshDimRelToMaxExt, DataArrayIdType *ren
   int traducedRk=-meshDimRelToMaxExt;
   if(traducedRk>=(int)_ms.size())
     throw INTERP_KERNEL::Exception("Invalid mesh dim relative to max given ! Too low !");
+  loadLevelIfNecessary(traducedRk);
   if((MEDFileUMeshSplitL1 *)_ms[traducedRk]==0)
     throw INTERP_KERNEL::Exception("On specified lev (or entity) no cells exists !");
   return _ms[traducedRk]->setRenumArr(renumArr);
@@ -5720,6 +5835,7 @@ void MEDFileUMesh::setNameFieldAtLevel(int meshDimRelToMaxExt, DataArrayAsciiCha
   int traducedRk=-meshDimRelToMaxExt;
   if(traducedRk>=(int)_ms.size())
     throw INTERP_KERNEL::Exception("Invalid mesh dim relative to max given ! Too low !");
+  loadLevelIfNecessary(traducedRk);
   if((MEDFileUMeshSplitL1 *)_ms[traducedRk]==0)
     throw INTERP_KERNEL::Exception("On specified lev (or entity) no cells exists !");
   return _ms[traducedRk]->setNameArr(nameArr);
@@ -5734,6 +5850,9 @@ void MEDFileUMesh::setGlobalNumFieldAtLevel(int meshDimRelToMaxExt, DataArrayIdT
   _global_num_coords.takeRef(globalNumArr);
 }
 
+/*!
+ * The levels left in file are not read here : they are synchronized when they are read, see loadLevelIfNecessary.
+ */
 void MEDFileUMesh::synchronizeTinyInfoOnLeaves() const
 {
   for(std::vector< MCAuto<MEDFileUMeshSplitL1> >::const_iterator it=_ms.begin();it!=_ms.end();it++)
@@ -5746,6 +5865,7 @@ void MEDFileUMesh::synchronizeTinyInfoOnLeaves() const
  */
 void MEDFileUMesh::changeFamilyIdArr(mcIdType oldId, mcIdType newId)
 {
+  loadAllLevelsIfNecessary();
   DataArrayIdType *arr=_fam_coords;
   if(arr)
     arr->changeValue(oldId,newId);
@@ -5761,6 +5881,7 @@ void MEDFileUMesh::changeFamilyIdArr(mcIdType oldId, mcIdType newId)
 
 std::list< MCAuto<DataArrayIdType> > MEDFileUMesh::getAllNonNullFamilyIds() const
 {
+  loadAllLevelsIfNecessary();
   std::list< MCAuto<DataArrayIdType> > ret;
   const DataArrayIdType *da(_fam_coords);
   if(da)
@@ -7665,6 +7786,13 @@ void MEDFileMeshMultiTS::killStructureElements()
       (*it)->killStructureElements();
 }
 
+void MEDFileMeshMultiTS::loadContentLeftInFile() const
+{
+  for(std::vector< MCAuto<MEDFileMesh> >::const_iterator it=_mesh_one_ts.begin();it!=_mesh_one_ts.end();it++)
+    if((*it).isNotNull())
+      (*it)->loadContentLeftInFile();
+}
+
 void MEDFileMeshMultiTS::writeLL(med_idt fid) const
 {
   MEDFileJoints *joints(getJoints());
@@ -7747,6 +7875,13 @@ MEDFileMeshes *MEDFileMeshes::New(const std::string& fileName)
   return New(fid);
 }
 
+void MEDFileMeshes::loadContentLeftInFile() const
+{
+  for(std::vector< MCAuto<MEDFileMeshMultiTS> >::const_iterator it=_meshes.begin();it!=_meshes.end();it++)
+    if((*it).isNotNull())
+      (*it)->loadContentLeftInFile();
+}
+
 void MEDFileMeshes::writeLL(med_idt fid) const
 {
   checkConsistencyLight();
@@ -284,6 +284,7 @@ MCAuto<DataArrayDouble>& coords, MCAuto<PartDefinition>& partCoords, MCAuto<Data
     MEDLOADER_EXPORT MEDFileMesh *createNewEmpty() const;
     MEDLOADER_EXPORT MEDFileUMesh *deepCopy() const;
     MEDLOADER_EXPORT MEDFileUMesh *shallowCpy() const;
+    MEDLOADER_EXPORT void loadContentLeftInFile() const override;
     MEDLOADER_EXPORT bool isEqual(const MEDFileMesh *other, double eps, std::string& what) const;
     MEDLOADER_EXPORT void checkConsistency() const;
     MEDLOADER_EXPORT void checkSMESHConsistency() const;
@@ -402,6 +403,9 @@ MCAuto<DataArrayDouble>& coords, MCAuto<PartDefinition>& partCoords, MCAuto<Data
     void changeFamilyIdArr(mcIdType oldId, mcIdType newId);
     std::list< MCAuto<DataArrayIdType> > getAllNonNullFamilyIds() const;
     MCAuto<MEDFileUMeshSplitL1>& checkAndGiveEntryInSplitL1(int meshDimRelToMax, MEDCouplingPointSet *m);
+    void loadLevelIfNecessary(int levId) const;
+    void loadAllLevelsIfNecessary() const;
+    void dropPendingLevel(int levId);
     static std::vector<std::shared_ptr<std::vector<mcIdType>>>
     findConnectedComponents(
         const std::map<mcIdType, std::set<mcIdType>> &graph
@@ -417,7 +421,9 @@ MCAuto<DataArrayDouble>& coords, MCAuto<PartDefinition>& partCoords, MCAuto<Data
   private:
     static const char SPE_FAM_STR_EXTRUDED_MESH[];
   private:
-    std::vector< MCAuto<MEDFileUMeshSplitL1> > _ms;   ///< The array of single-dimension constituting meshes, stored in decreasing order (dimRelativeToMax=0,-1,-2, ...)
+    mutable std::vector< MCAuto<MEDFileUMeshSplitL1> > _ms;   ///< The array of single-dimension constituting meshes, stored in decreasing order (dimRelativeToMax=0,-1,-2, ...)
+    mutable MCAuto<MEDFileUMeshLazyLevels> _lazy_levels; ///< Reader of the levels not yet loaded from file, null if none
+    mutable std::vector<bool> _pending_levels;        ///< For each level, true if it is in file and not yet loaded into _ms
     MCAuto<DataArrayDouble> _coords;
     MCAuto<DataArrayIdType> _fam_coords;              ///< Node family indices
     MCAuto<DataArrayIdType> _num_coords;
@@ -594,6 +600,7 @@ MCAuto<DataArrayDouble>& coords, MCAuto<PartDefinition>& partCoords, MCAuto<Data
     MEDLOADER_EXPORT void cartesianizeMe();
     MEDLOADER_EXPORT MEDFileMesh *getOneTimeStep() const;
     MEDLOADER_EXPORT void writeLL(med_idt fid) const;
+    MEDLOADER_EXPORT void loadContentLeftInFile() const override;
     MEDLOADER_EXPORT void setOneTimeStep(MEDFileMesh *mesh1TimeStep);
     MEDLOADER_EXPORT MEDFileJoints *getJoints() const;
     MEDLOADER_EXPORT void setJoints(MEDFileJoints* joints);
@@ -625,6 +632,7 @@ MCAuto<DataArrayDouble>& coords, MCAuto<PartDefinition>& partCoords, MCAuto<Data
     MEDLOADER_EXPORT std::string simpleRepr() const;
     MEDLOADER_EXPORT void simpleReprWithoutHeader(std::ostream& oss) const;
     MEDLOADER_EXPORT void writeLL(med_idt fid) const;
+    MEDLOADER_EXPORT void loadContentLeftInFile() const override;
     MEDLOADER_EXPORT int getNumberOfMeshes() const;
     MEDLOADER_EXPORT MEDFileMeshesIterator *iterator();
     MEDLOADER_EXPORT MEDFileMesh *getMeshAtPos(int i) const;
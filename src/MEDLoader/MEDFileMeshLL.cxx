@@ -34,6 +34,7 @@
 #include "MEDFilterEntity.hxx"
 #include <set>
 #include <iomanip>
+#include <algorithm>
 
 // From MEDLOader.cxx TU
 extern med_geometry_type typmai[MED_N_CELL_FIXED_GEO];
@@ -662,6 +663,21 @@ void MEDFileUMeshL2::loadConnectivity(med_idt fid, int mdim, const std::string&
   sortTypes();
 }
 
+/*!
+ * Loads the geometric types \a geoTypeIds (ids in typmai) of the level \a levId only. The other levels among the \a nbOfLevels ones are left empty.
+ */
+void MEDFileUMeshL2::loadConnectivityOfLevel(med_idt fid, int mdim, const std::string& mName, int dt, int it, int nbOfLevels, int levId, const std::vector<int>& geoTypeIds, MEDFileMeshReadSelector *mrs)
+{
+  _per_type_mesh.clear();
+  _per_type_mesh.resize(nbOfLevels);
+  for(std::vector<int>::const_iterator itt=geoTypeIds.begin();itt!=geoTypeIds.end();itt++)
+    {
+      MEDFileUMeshPerType *tmp(MEDFileUMeshPerType::New(fid,mName.c_str(),dt,it,mdim,typmai[*itt],typmai2[*itt],mrs));
+      if(tmp)
+        _per_type_mesh[levId].push_back(tmp);
+    }
+}
+
 void MEDFileUMeshL2::loadPartOfConnectivity(med_idt fid, int mdim, const std::string& mName, const std::vector<INTERP_KERNEL::NormalizedCellType>& types, const std::vector<mcIdType>& slicPerTyp, int dt, int it, MEDFileMeshReadSelector *mrs)
 {
   std::size_t nbOfTypes(types.size());
@@ -2402,3 +2418,65 @@ MEDFileEltStruct4Mesh::MEDFileEltStruct4Mesh(med_idt fid, const std::string& mNa
       _vars[i]=arr;
     }
 }
+
+MEDFileUMeshLazyLevels *MEDFileUMeshLazyLevels::New(med_idt fid, const std::string& mName, int dt, int it, int mdim, const MEDFileMeshReadSelector *mrs)
+{
+  return new MEDFileUMeshLazyLevels(fid,mName,dt,it,mdim,mrs);
+}
+
+/*!
+ * Levels are built the same way than MEDFileUMeshL2::sortTypes does : level \a i gathers the types of dimension \c _max_dim-i and
+ * the trailing empty levels are removed.
+ */
+MEDFileUMeshLazyLevels::MEDFileUMeshLazyLevels(med_idt fid, const std::string& mName, int dt, int it, int mdim, const MEDFileMeshReadSelector *mrs):_m_name(mName),_dt(dt),_it(it),_mdim(mdim),_max_dim(-1)
+{
+  if(mrs)
+    _mrs=*mrs;
+  _session=MEDFileReadSession::New(MEDFileWritable::FileNameFromFID(fid));
+  med_idt fid2(_session->getFid());
+  std::vector< std::vector<int> > geoTypesPerDim(4);
+  for(int j=0;j<MED_N_CELL_FIXED_GEO;j++)
+    {
+      med_entity_type whichEntity;
+      if(!MEDFileUMeshPerType::isExisting(fid2,mName.c_str(),dt,it,typmai[j],whichEntity))
+        continue;
+      int dim((int)INTERP_KERNEL::CellModel::GetCellModel(typmai2[j]).getDimension());
+      geoTypesPerDim[dim].push_back(j);
+      _max_dim=std::max(_max_dim,dim);
+    }
+  _geo_types_per_lev.resize(_max_dim+1);
+  for(int lev=0;lev<=_max_dim;lev++)
+    _geo_types_per_lev[lev]=geoTypesPerDim[_max_dim-lev];
+  while(!_geo_types_per_lev.empty() && _geo_types_per_lev.back().empty())
+    _geo_types_per_lev.pop_back();
+}
+
+std::size_t MEDFileUMeshLazyLevels::getHeapMemorySizeWithoutChildren() const
+{
+  std::size_t ret(_m_name.capacity()+_geo_types_per_lev.capacity()*sizeof(std::vector<int>));
+  for(std::vector< std::vector<int> >::const_iterator it=_geo_types_per_lev.begin();it!=_geo_types_per_lev.end();it++)
+    ret+=(*it).capacity()*sizeof(int);
+  return ret;
+}
+
+std::vector<const BigMemoryObject *> MEDFileUMeshLazyLevels::getDirectChildrenWithNull() const
+{
+  std::vector<const BigMemoryObject *> ret;
+  ret.push_back((const MEDFileReadSession *)_session);
+  return ret;
+}
+
+/*!
+ * Reads the level \a levId from file, its cells lying on \a coords.
+ *  \return MEDFileUMeshSplitL1 * - the level. The caller is to delete it using decrRef() as it is no more needed.
+ */
+MEDFileUMeshSplitL1 *MEDFileUMeshLazyLevels::load(int levId, DataArrayDouble *coords) const
+{
+  if(levId<0 || levId>=getNumberOfLevels())
+    throw INTERP_KERNEL::Exception("MEDFileUMeshLazyLevels::load : invalid level id !");
+  MEDFileMeshReadSelector mrs(_mrs);
+  MEDFileUMeshL2 loaderl2;
+  loaderl2.loadConnectivityOfLevel(_session->getFid(),_mdim,_m_name,_dt,_it,getNumberOfLevels(),levId,_geo_types_per_lev[levId],&mrs);
+  loaderl2.setCoords(coords);
+  return new MEDFileUMeshSplitL1(loaderl2,_m_name,levId);
+}
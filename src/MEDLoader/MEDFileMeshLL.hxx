@@ -23,6 +23,8 @@
 
 #include "MEDFileBasis.hxx"
 #include "MEDFileMeshElt.hxx"
+#include "MEDFileReadSession.hxx"
+#include "MEDFileMeshReadSelector.hxx"
 
 #include "MEDCouplingUMesh.hxx"
 #include "MEDCouplingCMesh.hxx"
@@ -39,8 +41,6 @@
 
 namespace MEDCoupling
 {
-  class MEDFileMeshReadSelector;
-
   class MeshOrStructMeshCls
   {
   protected:
@@ -125,6 +125,7 @@ namespace MEDCoupling
     void dealWithCoordsInLoadPart(med_idt fid, const MeshOrStructMeshCls *mId, const std::string& mName, const std::vector<std::string>& infosOnComp, const std::vector<INTERP_KERNEL::NormalizedCellType>& types, const std::vector<mcIdType>& slicPerTyp, int dt, int it, MEDFileMeshReadSelector *mrs);
     std::vector<std::string> loadPartConnectivityOnly(med_idt fid, const MeshOrStructMeshCls *mId, const std::string& mName, const std::vector<INTERP_KERNEL::NormalizedCellType>& types, const std::vector<mcIdType>& slicPerTyp, int dt, int it, MEDFileMeshReadSelector *mrs, int& Mdim);
     void loadConnectivity(med_idt fid, int mdim, const std::string& mName, int dt, int it, MEDFileMeshReadSelector *mrs);
+    void loadConnectivityOfLevel(med_idt fid, int mdim, const std::string& mName, int dt, int it, int nbOfLevels, int levId, const std::vector<int>& geoTypeIds, MEDFileMeshReadSelector *mrs);
     void loadPartOfConnectivity(med_idt fid, int mdim, const std::string& mName, const std::vector<INTERP_KERNEL::NormalizedCellType>& types, const std::vector<mcIdType>& slicPerTyp, int dt, int it, MEDFileMeshReadSelector *mrs);
     void loadPartOfConnectivityFromUserDistrib(med_idt fid, int mdim, const std::string& mName, const std::map<INTERP_KERNEL::NormalizedCellType,std::vector<mcIdType>>& distrib, int dt, int it, MEDFileMeshReadSelector *mrs);
 
@@ -139,6 +140,7 @@ namespace MEDCoupling
     bool isNumDefinedOnLev(int levId) const;
     bool isNamesDefinedOnLev(int levId) const;
     MCAuto<DataArrayDouble> getCoords() const { return _coords; }
+    void setCoords(DataArrayDouble *coords) { _coords.takeRef(coords); }
     MCAuto<DataArrayIdType> getCoordsFamily() const { return _fam_coords; }
     MCAuto<DataArrayIdType> getCoordsNum() const { return _num_coords; }
     MCAuto<DataArrayIdType> getCoordsGlobalNum() const { return _global_num_coords; }
@@ -376,6 +378,37 @@ MCAuto<DataArrayDouble>& _coords, MCAuto<DataArrayIdType>& _fam_coords, MCAuto<D
     MCAuto<MEDFileUMeshPerTypeCommon> _common;
     std::vector< MCAuto<DataArray> > _vars;
   };
+
+  /*!
+   * Levels of an unstructured mesh in a file whose reading is deferred until they are accessed (see MEDFileMeshReadSelector::setLevelsLazyLoading).
+   * Only the geometric types present in the file are scanned at construction. The file is kept opened through a MEDFileReadSession
+   * as long as \a this is alive.
+   */
+  class MEDFileUMeshLazyLevels : public RefCountObject
+  {
+  public:
+    static MEDFileUMeshLazyLevels *New(med_idt fid, const std::string& mName, int dt, int it, int mdim, const MEDFileMeshReadSelector *mrs);
+    std::string getClassName() const override { return std::string("MEDFileUMeshLazyLevels"); }
+    std::size_t getHeapMemorySizeWithoutChildren() const;
+    std::vector<const BigMemoryObject *> getDirectChildrenWithNull() const;
+    int getNumberOfLevels() const { return (int)_geo_types_per_lev.size(); }
+    bool emptyLev(int levId) const { return _geo_types_per_lev[levId].empty(); }
+    int getMeshDimension() const { return getNumberOfLevels()==0?-1:_max_dim; }
+    MEDFileUMeshSplitL1 *load(int levId, DataArrayDouble *coords) const;
+  private:
+    MEDFileUMeshLazyLevels(med_idt fid, const std::string& mName, int dt, int it, int mdim, const MEDFileMeshReadSelector *mrs);
+    ~MEDFileUMeshLazyLevels() { }
+  private:
+    MCAuto<MEDFileReadSession> _session;
+    std::string _m_name;
+    int _dt;
+    int _it;
+    int _mdim;
+    int _max_dim;
+    MEDFileMeshReadSelector _mrs;
+    //! for each level, the ids in typmai of the geometric types present in file
+    std::vector< std::vector<int> > _geo_types_per_lev;
+  };
 }
 
 #endif
@@ -26,11 +26,11 @@
 
 using namespace MEDCoupling;
 
-MEDFileMeshReadSelector::MEDFileMeshReadSelector():_nb_coords_load_sessions(1),_code(0xFFFFFFFF)
+MEDFileMeshReadSelector::MEDFileMeshReadSelector():_nb_coords_load_sessions(1),_levels_lazy_loading(false),_code(0xFFFFFFFF)
 {
 }
 
-MEDFileMeshReadSelector::MEDFileMeshReadSelector(unsigned int code):_code(code)
+MEDFileMeshReadSelector::MEDFileMeshReadSelector(unsigned int code):_nb_coords_load_sessions(1),_levels_lazy_loading(false),_code(code)
 {
 }
 
@@ -153,6 +153,7 @@ void MEDFileMeshReadSelector::reprAll(std::ostream& str) const
 {
   str << "MEDFileMeshReadSelector (code=" << _code << ") : \n";
   str << "Number of coords load part sessions : " << this->_nb_coords_load_sessions << std::endl;
+  str << "Lazy loading of levels : " << ReprStatus(isLevelsLazyLoading()) << std::endl;
   str << "Read family field on cells : " << ReprStatus(isCellFamilyFieldReading()) << std::endl;
   str << "Read family field on nodes : " << ReprStatus(isNodeFamilyFieldReading()) << std::endl;
   str << "Read name field on cells : " << ReprStatus(isCellNameFieldReading()) << std::endl;
@@ -37,6 +37,8 @@ namespace MEDCoupling
     void setCode(unsigned int newCode);
     mcIdType getNumberOfCoordsLoadSessions() const { return _nb_coords_load_sessions; }
     void setNumberOfCoordsLoadSessions(mcIdType newNbOfCoordsLoadSessions);
+    bool isLevelsLazyLoading() const { return _levels_lazy_loading; }
+    void setLevelsLazyLoading(bool b) { _levels_lazy_loading=b; }
     bool isCellFamilyFieldReading() const;
     bool isNodeFamilyFieldReading() const;
     bool isCellNameFieldReading() const;
@@ -56,6 +58,8 @@ namespace MEDCoupling
     static std::string ReprStatus(bool v);
   private:
     mcIdType _nb_coords_load_sessions;
+    //! If true, the connectivity of each level of a MEDFileUMesh is read from file only when first accessed.
+    bool _levels_lazy_loading;
     //bit #0 cell family field
     //bit #1 node family field
     //bit #2 cell name field
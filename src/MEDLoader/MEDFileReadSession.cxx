@@ -0,0 +1,202 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "MEDFileReadSession.hxx"
+#include "MEDFileSafeCaller.txx"
+#include "MEDLoaderBase.hxx"
+#include "MEDLoaderNS.hxx"
+
+#include "InterpKernelAutoPtr.hxx"
+
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <iterator>
+#include <algorithm>
+
+using namespace MEDCoupling;
+
+namespace
+{
+  //! Sessions currently opened, by file name. The sessions are not owned by the registry : they unregister themselves at destruction.
+  std::map<std::string,MEDFileReadSession *>& Sessions()
+  {
+    static std::map<std::string,MEDFileReadSession *> sessions;
+    return sessions;
+  }
+
+  std::mutex& SessionsMutex()
+  {
+    static std::mutex mutex;
+    return mutex;
+  }
+}
+
+/*!
+ * Opens \a fileName for reading and reads its catalog. If a session is already opened on \a fileName, it is returned instead.
+ *  \return MEDFileReadSession * - the session. The caller is to delete it using decrRef() as it is no more needed, the file being
+ *          closed when the last reference is released.
+ *  \throw If the file is not readable.
+ */
+MEDFileReadSession *MEDFileReadSession::New(const std::string& fileName)
+{
+  std::lock_guard<std::mutex> lock(SessionsMutex());
+  std::map<std::string,MEDFileReadSession *>::const_iterator it(Sessions().find(fileName));
+  if(it!=Sessions().end() && (*it).second->incrRefIfAlive())
+    return (*it).second;
+  // a session whose last reference is being released is replaced : its destructor does not unregister the new one
+  MEDFileReadSession *ret(new MEDFileReadSession(fileName));
+  Sessions()[fileName]=ret;
+  return ret;
+}
+
+/*!
+ * Returns the session currently opened on \a fileName, or NULL if none. The reference is taken under the lock of the registry, so
+ * that the session can not be closed by another thread while the caller uses it.
+ *  \return const MEDFileReadSession * - the session or NULL. The caller is to delete it using decrRef() as it is no more needed.
+ */
+const MEDFileReadSession *MEDFileReadSession::Find(const std::string& fileName)
+{
+  std::lock_guard<std::mutex> lock(SessionsMutex());
+  if(Sessions().empty())
+    return 0;
+  std::map<std::string,MEDFileReadSession *>::const_iterator it(Sessions().find(fileName));
+  return it!=Sessions().end() && (*it).second->incrRefIfAlive()?(*it).second:0;
+}
+
+MEDFileReadSession::MEDFileReadSession(const std::string& fileName):_file_name(fileName),_fid(-1)
+{
+  MEDFileUtilities::CheckFileForRead(fileName);
+  _fid=MEDfileOpen(fileName.c_str(),MED_ACC_RDONLY);
+  if(_fid<0)
+    {
+      std::ostringstream oss; oss << "MEDFileReadSession : unable to open file \"" << fileName << "\" for reading !";
+      throw INTERP_KERNEL::Exception(oss.str());
+    }
+  try
+    {
+      loadCatalog();
+    }
+  catch(...)
+    {
+      MEDfileClose(_fid);
+      throw;
+    }
+}
+
+MEDFileReadSession::~MEDFileReadSession()
+{
+  {
+    std::lock_guard<std::mutex> lock(SessionsMutex());
+    std::map<std::string,MEDFileReadSession *>::iterator it(Sessions().find(_file_name));
+    if(it!=Sessions().end() && (*it).second==this)
+      Sessions().erase(it);
+  }
+  MEDfileClose(_fid);
+}
+
+/*!
+ * Reads the names of the meshes, and for each field its mesh, its components and its time steps, in a single pass on the file.
+ */
+void MEDFileReadSession::loadCatalog()
+{
+  _mesh_names=MEDLoaderNS::getMeshNamesFid(_fid);
+  med_int nbFields(MEDnField(_fid));
+  _fields.resize(nbFields);
+  med_field_type typcha;
+  med_int numdt(0),numo(0);
+  med_float dt(0.);
+  med_bool localmesh;
+  INTERP_KERNEL::AutoPtr<char> maa_ass(MEDLoaderBase::buildEmptyString(MED_NAME_SIZE));
+  INTERP_KERNEL::AutoPtr<char> dt_unit(MEDLoaderBase::buildEmptyString(MED_LNAME_SIZE));
+  INTERP_KERNEL::AutoPtr<char> nomcha(MEDLoaderBase::buildEmptyString(MED_NAME_SIZE));
+  for(int i=0;i<nbFields;i++)
+    {
+      med_int ncomp(MEDfieldnComponent(_fid,i+1));
+      INTERP_KERNEL::AutoPtr<char> comp(new char[ncomp*MED_SNAME_SIZE+1]);
+      INTERP_KERNEL::AutoPtr<char> unit(new char[ncomp*MED_SNAME_SIZE+1]);
+      med_int nbPdt;
+      MEDFILESAFECALLERRD0(MEDfieldInfo,(_fid,i+1,nomcha,maa_ass,&localmesh,&typcha,comp,unit,dt_unit,&nbPdt));
+      FieldEntry& field(_fields[i]);
+      field._name=MEDLoaderBase::buildStringFromFortran(nomcha,MED_NAME_SIZE+1);
+      field._mesh_name=MEDLoaderBase::buildStringFromFortran(maa_ass,MED_NAME_SIZE);
+      field._components.resize(ncomp);
+      for(int j=0;j<ncomp;j++)
+        field._components[j]=std::pair<std::string,std::string>(MEDLoaderBase::buildStringFromFortran(((char *)comp)+j*MED_SNAME_SIZE,MED_SNAME_SIZE),
+                                                                 MEDLoaderBase::buildStringFromFortran(((char *)unit)+j*MED_SNAME_SIZE,MED_SNAME_SIZE));
+      field._iterations.resize(nbPdt);
+      for(int k=0;k<nbPdt;k++)
+        {
+          MEDFILESAFECALLERRD0(MEDfieldComputingStepInfo,(_fid,nomcha,k+1,&numdt,&numo,&dt));
+          field._iterations[k]=std::make_pair(std::make_pair((int)numdt,(int)numo),(double)dt);
+        }
+    }
+}
+
+std::size_t MEDFileReadSession::getHeapMemorySizeWithoutChildren() const
+{
+  std::size_t ret(_file_name.capacity()+_mesh_names.capacity()*sizeof(std::string)+_fields.capacity()*sizeof(FieldEntry));
+  for(std::vector<FieldEntry>::const_iterator it=_fields.begin();it!=_fields.end();it++)
+    ret+=(*it)._components.capacity()*sizeof(std::pair<std::string,std::string>)+(*it)._iterations.capacity()*sizeof(std::pair< std::pair<int,int>, double>);
+  return ret;
+}
+
+std::vector<const BigMemoryObject *> MEDFileReadSession::getDirectChildrenWithNull() const
+{
+  return std::vector<const BigMemoryObject *>();
+}
+
+std::vector<std::string> MEDFileReadSession::getFieldNames() const
+{
+  std::vector<std::string> ret;
+  for(std::vector<FieldEntry>::const_iterator it=_fields.begin();it!=_fields.end();it++)
+    ret.push_back((*it)._name);
+  return ret;
+}
+
+std::vector<std::string> MEDFileReadSession::getFieldNamesOnMesh(const std::string& meshName) const
+{
+  std::vector<std::string> ret;
+  for(std::vector<FieldEntry>::const_iterator it=_fields.begin();it!=_fields.end();it++)
+    if((*it)._mesh_name==meshName)
+      ret.push_back((*it)._name);
+  return ret;
+}
+
+std::vector< std::pair<std::string,std::string> > MEDFileReadSession::getComponentsNamesOfField(const std::string& fieldName) const
+{
+  return getFieldEntry(fieldName,"GetComponentsNamesOfField")._components;
+}
+
+std::vector< std::pair< std::pair<int,int>, double> > MEDFileReadSession::getFieldIterations(const std::string& fieldName) const
+{
+  return getFieldEntry(fieldName,"GetAllFieldIterations")._iterations;
+}
+
+const MEDFileReadSession::FieldEntry& MEDFileReadSession::getFieldEntry(const std::string& fieldName, const std::string& methodName) const
+{
+  for(std::vector<FieldEntry>::const_iterator it=_fields.begin();it!=_fields.end();it++)
+    if((*it)._name==fieldName)
+      return *it;
+  std::ostringstream oss; oss << methodName << " : no such field \"" << fieldName << "\" in file \"" << _file_name << "\" !" << std::endl;
+  oss << "Possible field names are : " << std::endl;
+  std::vector<std::string> fields(getFieldNames());
+  std::copy(fields.begin(),fields.end(),std::ostream_iterator<std::string>(oss," "));
+  throw INTERP_KERNEL::Exception(oss.str());
+}
@@ -0,0 +1,81 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#ifndef __MEDFILEREADSESSION_HXX__
+#define __MEDFILEREADSESSION_HXX__
+
+#include "MEDLoaderDefines.hxx"
+#include "MEDFileUtilities.hxx"
+
+#include "MEDCouplingRefCountObject.hxx"
+
+#include <string>
+#include <vector>
+
+namespace MEDCoupling
+{
+  /*!
+   * A MED file opened once for reading, with the catalog of its meshes, fields and time steps read in a single pass at the opening.
+   * As long as an instance is alive on a file name, all the readers taking this file name (MEDFileMesh::New, MEDFileField1TS::New,
+   * MEDFileFields::New, MEDFileParameters::New, MEDFileJoints::New, ReadUMeshFromFile, ReadField...) reuse its file descriptor instead of
+   * opening the file again, and the MEDLoader functions giving the names of the meshes and fields and the time steps
+   * (GetMeshNames, GetAllFieldNames, GetAllFieldIterations...) answer from the catalog without reading the file.
+   * The file is closed when the last reference on the session is released.
+   *
+   * The file name given to the readers has to be the same string as the one given to New. The file must not be modified while a
+   * session is opened on it.
+   */
+  class MEDFileReadSession : public RefCountObject
+  {
+  public:
+    MEDLOADER_EXPORT static MEDFileReadSession *New(const std::string& fileName);
+    MEDLOADER_EXPORT static const MEDFileReadSession *Find(const std::string& fileName);
+    MEDLOADER_EXPORT std::string getClassName() const override { return std::string("MEDFileReadSession"); }
+    MEDLOADER_EXPORT std::size_t getHeapMemorySizeWithoutChildren() const;
+    MEDLOADER_EXPORT std::vector<const BigMemoryObject *> getDirectChildrenWithNull() const;
+    MEDLOADER_EXPORT std::string getFileName() const { return _file_name; }
+    MEDLOADER_EXPORT med_idt getFid() const { return _fid; }
+    MEDLOADER_EXPORT std::vector<std::string> getMeshNames() const { return _mesh_names; }
+    MEDLOADER_EXPORT std::vector<std::string> getFieldNames() const;
+    MEDLOADER_EXPORT std::vector<std::string> getFieldNamesOnMesh(const std::string& meshName) const;
+    MEDLOADER_EXPORT std::vector< std::pair<std::string,std::string> > getComponentsNamesOfField(const std::string& fieldName) const;
+    MEDLOADER_EXPORT std::vector< std::pair< std::pair<int,int>, double> > getFieldIterations(const std::string& fieldName) const;
+  private:
+    MEDFileReadSession(const std::string& fileName);
+    ~MEDFileReadSession();
+    void loadCatalog();
+  private:
+    class FieldEntry
+    {
+    public:
+      std::string _name;
+      std::string _mesh_name;
+      std::vector< std::pair<std::string,std::string> > _components;
+      std::vector< std::pair< std::pair<int,int>, double> > _iterations;
+    };
+    const FieldEntry& getFieldEntry(const std::string& fieldName, const std::string& methodName) const;
+  private:
+    std::string _file_name;
+    med_idt _fid;
+    std::vector<std::string> _mesh_names;
+    std::vector<FieldEntry> _fields;
+  };
+}
+
+#endif
@@ -19,6 +19,7 @@
 // Author : Anthony Geay (CEA/DEN)
 
 #include "MEDFileUtilities.hxx"
+#include "MEDFileReadSession.hxx"
 #include "MEDFileSafeCaller.txx"
 #include "MEDLoaderBase.hxx"
 #include "MEDLoader.hxx"
@@ -120,9 +121,17 @@ MEDFileUtilities::AutoFid::AutoFid(med_idt fid):_fid(fid)
 {
 }
 
+/*!
+ * \a fid is owned by \a owner, on which the reference given by the caller is kept until the destruction of \a this.
+ */
+MEDFileUtilities::AutoFid::AutoFid(med_idt fid, const MEDCoupling::RefCountObject *owner):_fid(fid),_owner(owner)
+{
+}
+
 MEDFileUtilities::AutoFid::~AutoFid()
 {
-  MEDfileClose(_fid);
+  if(_owner.isNull())
+    MEDfileClose(_fid);
 }
 
 MEDCoupling::MEDFileWritable::MEDFileWritable():_too_long_str(0),_zipconn_pol(2)
@@ -168,12 +177,28 @@ std::string MEDCoupling::MEDFileWritable::FileNameFromFID(med_idt fid)
   return std::string(tmp);
 }
 
+/*!
+ * Opens \a fileName for reading. If a MEDFileReadSession is opened on \a fileName, its file descriptor is returned (and will not be
+ * closed by the returned AutoFid, which keeps the session alive) and the file is not checked again.
+ */
 MEDFileUtilities::AutoFid MEDCoupling::OpenMEDFileForRead(const std::string& fileName)
 {
+  if(const MEDFileReadSession *session=MEDFileReadSession::Find(fileName))
+    return MEDFileUtilities::AutoFid(session->getFid(),session);
   MEDFileUtilities::CheckFileForRead(fileName);
   return MEDFileUtilities::AutoFid(MEDfileOpen(fileName.c_str(),MED_ACC_RDONLY));
 }
 
+/*!
+ * Returns the mutex to lock by the threads reading MED files concurrently (MEDFileAnyTypeFieldMultiTSPrefetchIterator),
+ * the MED file and HDF5 libraries not being thread safe.
+ */
+std::mutex& MEDCoupling::MEDFileReadMutex()
+{
+  static std::mutex mutex;
+  return mutex;
+}
+
 /*!
  * Writes \a this mesh into a MED file specified by its name.
  *  \param [in] fileName - the MED file name.
@@ -186,6 +211,7 @@ MEDFileUtilities::AutoFid MEDCoupling::OpenMEDFileForRead(const std::string& fil
  */
 void MEDCoupling::MEDFileWritableStandAlone::write(const std::string& fileName, int mode) const
 {
+  loadContentLeftInFile();
   med_access_mode medmod(MEDFileUtilities::TraduceWriteMode(mode));
   MEDFileUtilities::AutoFid fid(MEDfileOpen(fileName.c_str(),medmod));
   std::ostringstream oss; oss << "MEDFileWritableStandAlone : error on attempt to write in file : \"" << fileName << "\""; 
@@ -211,6 +237,7 @@ void MEDCoupling::MEDFileWritableStandAlone::write40(const std::string& fileName
 void MEDCoupling::MEDFileWritableStandAlone::writeXX(const std::string& fileName, int mode, med_int maj, med_int min, med_int rel) const
 {
 #if ( MED_NUM_MAJEUR>4 || ( MED_NUM_MAJEUR==4 && MED_NUM_MINEUR>=1 ) )
+  loadContentLeftInFile();
   med_access_mode medmod(MEDFileUtilities::TraduceWriteMode(mode));
   MEDFileUtilities::AutoFid fid(MEDfileVersionOpen(fileName.c_str(),medmod,maj,min,rel));
   writeLL(fid);
@@ -29,6 +29,8 @@
 
 #include "med.h"
 
+#include <mutex>
+
 namespace MEDFileUtilities
 {
   med_access_mode TraduceWriteMode(int medloaderwritemode);
@@ -40,10 +42,13 @@ namespace MEDFileUtilities
   {
   public:
     AutoFid(med_idt fid);
+    AutoFid(med_idt fid, const MEDCoupling::RefCountObject *owner);
     operator med_idt() const { return _fid; }
     ~AutoFid();
   private:
     med_idt _fid;
+    //! if not null, the MEDFileReadSession owning \a _fid, kept alive by \a this. \a _fid is then not closed by \a this.
+    MEDCoupling::MCConstAuto<MEDCoupling::RefCountObject> _owner;
   };
 }
 
@@ -69,6 +74,8 @@ namespace MEDCoupling
   {
   public:
     MEDLOADER_EXPORT virtual void writeLL(med_idt fid) const = 0;
+    //! Reads the data left in file by a lazy loading and releases that file. Called by write before opening the target file, which may be the same.
+    MEDLOADER_EXPORT virtual void loadContentLeftInFile() const { }
     MEDLOADER_EXPORT virtual void write(const std::string& fileName, int mode) const;
     MEDLOADER_EXPORT virtual void write33(const std::string& fileName, int mode) const;
     MEDLOADER_EXPORT virtual void write30(const std::string& fileName, int mode) const;
@@ -94,6 +101,7 @@ namespace MEDCoupling
     med_int _rel;
   };
   MEDFileUtilities::AutoFid OpenMEDFileForRead(const std::string& fileName);
+  MEDLOADER_EXPORT std::mutex& MEDFileReadMutex();
 }
 
 #endif
@@ -21,6 +21,7 @@
 #include "MEDLoader.hxx"
 #include "MEDLoaderBase.hxx"
 #include "MEDFileUtilities.hxx"
+#include "MEDFileReadSession.hxx"
 #include "MEDLoaderNS.hxx"
 #include "MEDFileSafeCaller.txx"
 #include "MEDFileMesh.hxx"
@@ -459,17 +460,23 @@ std::vector< std::vector< std::pair<INTERP_KERNEL::NormalizedCellType,int> > > M
 
 void MEDCoupling::CheckFileForRead(const std::string& fileName)
 {
-  MEDFileUtilities::CheckFileForRead(fileName);
+  MCConstAuto<MEDFileReadSession> session(MEDFileReadSession::Find(fileName));
+  if(session.isNull())// otherwise already checked at the opening of the session
+    MEDFileUtilities::CheckFileForRead(fileName);
 }
 
 std::vector<std::string> MEDCoupling::GetMeshNames(const std::string& fileName)
 {
+  if(MCConstAuto<MEDFileReadSession> session=MEDFileReadSession::Find(fileName))
+    return session->getMeshNames();
   MEDFileUtilities::AutoFid fid(MEDCoupling::OpenMEDFileForRead(fileName));
   return MEDLoaderNS::getMeshNamesFid(fid);
 }
 
 std::vector< std::pair<std::string,std::string> > MEDCoupling::GetComponentsNamesOfField(const std::string& fileName, const std::string& fieldName)
 {
+  if(MCConstAuto<MEDFileReadSession> session=MEDFileReadSession::Find(fileName))
+    return session->getComponentsNamesOfField(fieldName);
   MEDFileUtilities::AutoFid fid(MEDCoupling::OpenMEDFileForRead(fileName));
   med_int nbFields(MEDnField(fid));
   std::vector<std::string> fields(nbFields);
@@ -709,6 +716,8 @@ std::vector<MEDCoupling::TypeOfField> MEDCoupling::GetTypesOfField(const std::st
 
 std::vector<std::string> MEDCoupling::GetAllFieldNames(const std::string& fileName)
 {
+  if(MCConstAuto<MEDFileReadSession> session=MEDFileReadSession::Find(fileName))
+    return session->getFieldNames();
   std::vector<std::string> ret;
   MEDFileUtilities::AutoFid fid(MEDCoupling::OpenMEDFileForRead(fileName));
   med_int nbFields=MEDnField(fid);
@@ -731,6 +740,8 @@ std::vector<std::string> MEDCoupling::GetAllFieldNames(const std::string& fileNa
 
 std::vector<std::string> MEDCoupling::GetAllFieldNamesOnMesh(const std::string& fileName, const std::string& meshName)
 {
+  if(MCConstAuto<MEDFileReadSession> session=MEDFileReadSession::Find(fileName))
+    return session->getFieldNamesOnMesh(meshName);
   std::vector<std::string> ret;
   MEDFileUtilities::AutoFid fid(MEDCoupling::OpenMEDFileForRead(fileName));
   med_int nbFields=MEDnField(fid);
@@ -864,6 +875,8 @@ std::vector<std::string> MEDCoupling::GetNodeFieldNamesOnMesh(const std::string&
 
 std::vector< std::pair< std::pair<int,int>, double> > MEDCoupling::GetAllFieldIterations(const std::string& fileName, const std::string& fieldName)
 {
+  if(MCConstAuto<MEDFileReadSession> session=MEDFileReadSession::Find(fileName))
+    return session->getFieldIterations(fieldName);
   std::vector< std::pair< std::pair<int,int>, double > > ret;
   MEDFileUtilities::AutoFid fid(MEDCoupling::OpenMEDFileForRead(fileName));
   med_int nbFields=MEDnField(fid);
@@ -906,6 +919,16 @@ std::vector< std::pair< std::pair<int,int>, double> > MEDCoupling::GetAllFieldIt
 
 double MEDCoupling::GetTimeAttachedOnFieldIteration(const std::string& fileName, const std::string& fieldName, int iteration, int order)
 {
+  if(MCConstAuto<MEDFileReadSession> session=MEDFileReadSession::Find(fileName))
+    {
+      std::vector< std::pair< std::pair<int,int>, double> > its(session->getFieldIterations(fieldName));
+      for(std::vector< std::pair< std::pair<int,int>, double> >::const_iterator it=its.begin();it!=its.end();it++)
+        if((*it).first.first==iteration && (*it).first.second==order)
+          return (*it).second;
+      std::ostringstream oss;
+      oss << "No such field with name \"" << fieldName << "\" and iteration,order=(" << iteration << "," << order << ") exists in file \"" << fileName << "\" !";
+      throw INTERP_KERNEL::Exception(oss.str().c_str());
+    }
   MEDFileUtilities::AutoFid fid(MEDCoupling::OpenMEDFileForRead(fileName));
   med_int nbFields=MEDnField(fid);
   //
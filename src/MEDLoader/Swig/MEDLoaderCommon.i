@@ -38,6 +38,7 @@
 #include "MEDFileEntities.hxx"
 #include "MEDFileMeshReadSelector.hxx"
 #include "MEDFileFieldOverView.hxx"
+#include "MEDFileReadSession.hxx"
 #include "MEDCouplingTypemaps.i"
 #include "MEDLoaderTypemaps.i"
 #include "SauvReader.hxx"
@@ -148,6 +149,8 @@ using namespace MEDCoupling;
 %newobject MEDCoupling::MEDFileMeshSupports::New;
 %newobject MEDCoupling::MEDFileMeshSupports::getSupMeshWithName;
 
+%newobject MEDCoupling::MEDFileReadSession::New;
+
 %newobject MEDCoupling::MEDFileStructureElements::New;
 
 %newobject MEDCoupling::MEDFileFields::New;
@@ -175,6 +178,7 @@ using namespace MEDCoupling;
 %newobject MEDCoupling::MEDFileAnyTypeFieldMultiTS::getTimeStep;
 %newobject MEDCoupling::MEDFileAnyTypeFieldMultiTS::getTimeStepGivenTime;
 %newobject MEDCoupling::MEDFileAnyTypeFieldMultiTS::__iter__;
+%newobject MEDCoupling::MEDFileAnyTypeFieldMultiTS::prefetchIterator;
 %newobject MEDCoupling::MEDFileAnyTypeFieldMultiTS::extractPart;
 %newobject MEDCoupling::MEDFileAnyTypeFieldMultiTS::buildNewEmpty;
 %newobject MEDCoupling::MEDFileFieldMultiTS::New;
@@ -344,6 +348,7 @@ using namespace MEDCoupling;
 %feature("unref") MEDFileInt64FieldMultiTS "$this->decrRef();"
 %feature("unref") MEDFileFloatFieldMultiTS "$this->decrRef();"
 %feature("unref") MEDFileMeshSupports "$this->decrRef();"
+%feature("unref") MEDFileReadSession "$this->decrRef();"
 %feature("unref") MEDFileStructureElements "$this->decrRef();"
 %feature("unref") MEDFileFields "$this->decrRef();"
 %feature("unref") MEDFileParameter1TS "$this->decrRef();"
@@ -685,6 +690,8 @@ namespace MEDCoupling
     MEDFileMeshReadSelector(unsigned int code);
     mcIdType getNumberOfCoordsLoadSessions();
     void setNumberOfCoordsLoadSessions(mcIdType newNbOfCoordsLoadSessions);
+    bool isLevelsLazyLoading() const;
+    void setLevelsLazyLoading(bool b);
     unsigned int getCode() const;
     void setCode(unsigned int newCode);
     bool isCellFamilyFieldReading() const;
@@ -2730,6 +2737,25 @@ namespace MEDCoupling
     }
   };
 
+  class MEDFileAnyTypeFieldMultiTSPrefetchIterator
+  {
+  public:
+    %extend
+    {
+      PyObject *next()
+      {
+        MEDFileAnyTypeField1TS *ret=self->nextt();
+        if(ret)
+          return convertMEDFileField1TS(ret, SWIG_POINTER_OWN | 0 );
+        else
+          {
+            PyErr_SetString(PyExc_StopIteration,"No more data.");
+            return 0;
+          }
+      }
+    }
+  };
+
   class MEDFileAnyTypeFieldMultiTS : public RefCountObject, public MEDFileFieldGlobsReal, public MEDFileWritableStandAlone
   {
   public:
@@ -2751,6 +2777,7 @@ namespace MEDCoupling
     void eraseEmptyTS();
     int getPosOfTimeStep(int iteration, int order) const;
     int getPosGivenTime(double time, double eps=1e-8) const;
+    MEDFileAnyTypeFieldMultiTSPrefetchIterator *prefetchIterator(int nbOfPrefetchedTS=1);
     void loadArrays();
     void loadArraysIfNecessary();
     void unloadArrays();
@@ -3510,6 +3537,18 @@ namespace MEDCoupling
     MEDFileStructureElements();
   };
 
+  class MEDFileReadSession : public RefCountObject
+  {
+  public:
+    static MEDFileReadSession *New(const std::string& fileName);
+    std::string getFileName() const;
+    std::vector<std::string> getMeshNames() const;
+    std::vector<std::string> getFieldNames() const;
+    std::vector<std::string> getFieldNamesOnMesh(const std::string& meshName) const;
+  private:
+    MEDFileReadSession();
+  };
+
   class MEDFileFields : public RefCountObject, public MEDFileFieldGlobsReal, public MEDFileWritableStandAlone
   {
   public:
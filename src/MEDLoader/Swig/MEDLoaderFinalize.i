@@ -26,6 +26,8 @@ MEDFileUMesh.fuseNodesAndCells = MEDLoaderFinalize.MEDFileUMeshFuseNodesAndCells
 del MEDLoaderFinalize
 MEDFileMeshesIterator.__next__ = MEDFileMeshesIterator.next
 MEDFileAnyTypeFieldMultiTSIterator.__next__ = MEDFileAnyTypeFieldMultiTSIterator.next
+MEDFileAnyTypeFieldMultiTSPrefetchIterator.__next__ = MEDFileAnyTypeFieldMultiTSPrefetchIterator.next
+MEDFileAnyTypeFieldMultiTSPrefetchIterator.__iter__ = lambda self : self
 MEDFileFieldsIterator.__next__ = MEDFileFieldsIterator.next
 %}
 
@@ -29,6 +29,8 @@
 #include "MEDCouplingMemArray.hxx"
 #include "TestInterpKernelUtils.hxx"  // getResourceFile()
 #include "MEDFileMesh.hxx"
+#include "MEDFileReadSession.hxx"
+#include "MEDFileFieldMultiTS.hxx"
 
 #include <algorithm>
 #include <numeric>
@@ -803,6 +805,215 @@ void MEDLoaderTest::testGetAllFieldNamesRW1()
 }
 
 
+void MEDLoaderTest::testReadSession1()
+{
+  const char fileName[]="file28.med";
+  MEDCouplingUMesh *mesh=build2DMesh_2();
+  MEDCouplingFieldDouble *f1=MEDCouplingFieldDouble::New(ON_CELLS,ONE_TIME);
+  f1->setName("Field1");
+  f1->setTime(3.44,5,6);
+  f1->setMesh(mesh);
+  f1->fillFromAnalytic(2,"x+y");
+  WriteField(fileName,f1,true);
+  f1->setTime(1002.3,7,8);
+  f1->fillFromAnalytic(2,"x+77.*y");
+  WriteFieldUsingAlreadyWrittenMesh(fileName,f1);
+  f1->setName("Field2");
+  WriteFieldUsingAlreadyWrittenMesh(fileName,f1);
+  f1->decrRef();
+  CPPUNIT_ASSERT(!MCConstAuto<MEDFileReadSession>(MEDFileReadSession::Find(fileName)));
+  MCAuto<MEDFileReadSession> session(MEDFileReadSession::New(fileName));
+  CPPUNIT_ASSERT(MCConstAuto<MEDFileReadSession>(MEDFileReadSession::Find(fileName))==(const MEDFileReadSession *)session);
+  {// a second session on the same file is the first one
+    MCAuto<MEDFileReadSession> session2(MEDFileReadSession::New(fileName));
+    CPPUNIT_ASSERT(session2==session);
+  }
+  CPPUNIT_ASSERT(MCConstAuto<MEDFileReadSession>(MEDFileReadSession::Find(fileName))==(const MEDFileReadSession *)session);
+  // catalog
+  std::vector<std::string> ms(GetMeshNames(fileName));
+  CPPUNIT_ASSERT_EQUAL(1,(int)ms.size());
+  CPPUNIT_ASSERT(ms[0]==mesh->getName());
+  std::vector<std::string> fs(GetAllFieldNames(fileName));
+  CPPUNIT_ASSERT_EQUAL(2,(int)fs.size());
+  CPPUNIT_ASSERT(fs[0]=="Field1");
+  CPPUNIT_ASSERT(fs[1]=="Field2");
+  CPPUNIT_ASSERT_EQUAL(2,(int)GetAllFieldNamesOnMesh(fileName,mesh->getName()).size());
+  CPPUNIT_ASSERT_EQUAL(2,(int)GetComponentsNamesOfField(fileName,"Field1").size());
+  std::vector< std::pair< std::pair<int,int>, double> > its(GetAllFieldIterations(fileName,"Field1"));
+  CPPUNIT_ASSERT_EQUAL(2,(int)its.size());
+  CPPUNIT_ASSERT_EQUAL(5,its[0].first.first); CPPUNIT_ASSERT_EQUAL(6,its[0].first.second); CPPUNIT_ASSERT_DOUBLES_EQUAL(3.44,its[0].second,1e-14);
+  CPPUNIT_ASSERT_EQUAL(7,its[1].first.first); CPPUNIT_ASSERT_EQUAL(8,its[1].first.second); CPPUNIT_ASSERT_DOUBLES_EQUAL(1002.3,its[1].second,1e-14);
+  CPPUNIT_ASSERT_EQUAL(1,(int)GetAllFieldIterations(fileName,"Field2").size());
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1002.3,GetTimeAttachedOnFieldIteration(fileName,"Field1",7,8),1e-14);
+  CPPUNIT_ASSERT_THROW(GetAllFieldIterations(fileName,"Field3"),INTERP_KERNEL::Exception);
+  CPPUNIT_ASSERT_THROW(GetTimeAttachedOnFieldIteration(fileName,"Field1",7,9),INTERP_KERNEL::Exception);
+  // readers reuse the file descriptor of the session
+  MEDCouplingUMesh *mesh2=ReadUMeshFromFile(fileName,mesh->getName(),0);
+  CPPUNIT_ASSERT_EQUAL(mesh->getNumberOfCells(),mesh2->getNumberOfCells());
+  CPPUNIT_ASSERT_EQUAL(mesh->getNumberOfNodes(),mesh2->getNumberOfNodes());
+  mesh2->decrRef();
+  for(int i=0;i<2;i++)
+    {// several reads of the same field
+      MCAuto<MEDCouplingField> f2(ReadField(fileName,"Field1",7,8));
+      MCAuto<MEDCouplingFieldDouble> f2d(DynamicCast<MEDCouplingField,MEDCouplingFieldDouble>(f2));
+      int it,order;
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1002.3,f2d->getTime(it,order),1e-14);
+      CPPUNIT_ASSERT_EQUAL(7,it); CPPUNIT_ASSERT_EQUAL(8,order);
+      CPPUNIT_ASSERT_EQUAL(mesh->getNumberOfCells(),f2d->getArray()->getNumberOfTuples());
+    }
+  MCAuto<MEDFileMesh> mm(MEDFileMesh::New(fileName));
+  CPPUNIT_ASSERT(mm->getName()==mesh->getName());
+  // the file is closed when the session is released
+  session=(MEDFileReadSession *)0;
+  CPPUNIT_ASSERT(!MCConstAuto<MEDFileReadSession>(MEDFileReadSession::Find(fileName)));
+  CPPUNIT_ASSERT_EQUAL(2,(int)GetAllFieldIterations(fileName,"Field1").size());
+  mesh->decrRef();
+}
+
+void MEDLoaderTest::testLazyLevels1()
+{
+  const char fileName[]="file24.med";
+  MCAuto<MEDCouplingUMesh> m0(build2DMesh_2());
+  MCAuto<DataArrayIdType> d(DataArrayIdType::New()),di(DataArrayIdType::New()),rd(DataArrayIdType::New()),rdi(DataArrayIdType::New());
+  MCAuto<MEDCouplingUMesh> m1(m0->buildDescendingConnectivity(d,di,rd,rdi));
+  MCAuto<MEDFileUMesh> mm(MEDFileUMesh::New());
+  mm->setMeshAtLevel(0,m0,true);
+  mm->setMeshAtLevel(-1,m1,true);
+  MCAuto<DataArrayIdType> grp(DataArrayIdType::New()); grp->alloc(2,1); grp->setIJ(0,0,1); grp->setIJ(1,0,3); grp->setName("grp0");
+  std::vector<const DataArrayIdType *> grps(1,grp);
+  mm->setGroupsAtLevel(0,grps);
+  mm->write(fileName,2);
+  //
+  MCAuto<MEDFileUMesh> ref(MEDFileUMesh::New(fileName));
+  MEDFileMeshReadSelector mrs;
+  CPPUNIT_ASSERT(!mrs.isLevelsLazyLoading());
+  mrs.setLevelsLazyLoading(true);
+  MCAuto<MEDFileUMesh> lazy(MEDFileUMesh::New(fileName,&mrs));
+  // levels are known without reading them
+  std::vector<int> levs(lazy->getNonEmptyLevels());
+  CPPUNIT_ASSERT_EQUAL(2,(int)levs.size());
+  CPPUNIT_ASSERT_EQUAL(0,levs[0]); CPPUNIT_ASSERT_EQUAL(-1,levs[1]);
+  CPPUNIT_ASSERT_EQUAL(2,lazy->getMeshDimension());
+  CPPUNIT_ASSERT(lazy->getGroupsNames()==ref->getGroupsNames());
+  CPPUNIT_ASSERT(lazy->getCoords()->isEqual(*ref->getCoords(),1e-14));
+  // only the requested level is read
+  MCAuto<DataArrayIdType> grpRead(lazy->getGroupArr(0,"grp0")),grpRef(ref->getGroupArr(0,"grp0"));
+  CPPUNIT_ASSERT(grpRead->isEqual(*grpRef));
+  MCAuto<MEDCouplingUMesh> lev0(lazy->getMeshAtLevel(0));
+  MCAuto<MEDCouplingUMesh> lev0Ref(ref->getMeshAtLevel(0));
+  CPPUNIT_ASSERT(lev0->isEqual(lev0Ref,1e-14));
+  CPPUNIT_ASSERT(lazy->getHeapMemorySize()<ref->getHeapMemorySize());
+  // the other levels are read when needed, the file being then released
+  std::string what;
+  CPPUNIT_ASSERT(lazy->isEqual(ref,1e-14,what));
+  CPPUNIT_ASSERT(!MCConstAuto<MEDFileReadSession>(MEDFileReadSession::Find(fileName)));
+  // a level left in file can be removed without being read
+  MCAuto<MEDFileUMesh> lazy2(MEDFileUMesh::New(fileName,&mrs));
+  lazy2->removeMeshAtLevel(-1);
+  levs=lazy2->getNonEmptyLevels();
+  CPPUNIT_ASSERT_EQUAL(1,(int)levs.size());
+  CPPUNIT_ASSERT_EQUAL(0,levs[0]);
+  MCAuto<MEDCouplingUMesh> lev0Bis(lazy2->getMeshAtLevel(0));
+  CPPUNIT_ASSERT(lev0Bis->isEqual(lev0Ref,1e-14));
+  CPPUNIT_ASSERT(!MCConstAuto<MEDFileReadSession>(MEDFileReadSession::Find(fileName)));
+}
+
+void MEDLoaderTest::testLazyLevels2()
+{
+  const char fileName[]="file27.med";
+  MCAuto<MEDCouplingUMesh> m0(build2DMesh_2());
+  MCAuto<DataArrayIdType> d(DataArrayIdType::New()),di(DataArrayIdType::New()),rd(DataArrayIdType::New()),rdi(DataArrayIdType::New());
+  MCAuto<MEDCouplingUMesh> m1(m0->buildDescendingConnectivity(d,di,rd,rdi));
+  MCAuto<MEDFileUMesh> mm(MEDFileUMesh::New());
+  mm->setMeshAtLevel(0,m0,true);
+  mm->setMeshAtLevel(-1,m1,true);
+  mm->write(fileName,2);
+  //
+  MEDFileMeshReadSelector mrs;
+  mrs.setLevelsLazyLoading(true);
+  // a deep copy does not share the levels left in file
+  MCAuto<MEDFileUMesh> lazy(MEDFileUMesh::New(fileName,&mrs));
+  MCAuto<MEDFileUMesh> cpy(lazy->deepCopy());
+  std::string what;
+  CPPUNIT_ASSERT(cpy->isEqual(mm,1e-14,what));
+  // the time and description set before a level is read are given to it
+  MCAuto<MEDFileUMesh> lazy3(MEDFileUMesh::New(fileName,&mrs));
+  lazy3->setTime(3,4,5.6);
+  lazy3->setDescription("desc");
+  MCAuto<MEDCouplingUMesh> lev1(lazy3->getMeshAtLevel(-1));
+  CPPUNIT_ASSERT_EQUAL(std::string("desc"),lev1->getDescription());
+  int it,order;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(5.6,lev1->getTime(it,order),1e-14);
+  CPPUNIT_ASSERT_EQUAL(3,it); CPPUNIT_ASSERT_EQUAL(4,order);
+  // round trip : the levels left in file are read before writing back into the same file
+  for(int mode=0;mode<3;mode+=2)
+    {
+      MCAuto<MEDFileUMesh> lazy2(MEDFileUMesh::New(fileName,&mrs));
+      lazy2->setDescription("modified");
+      lazy2->write(fileName,mode);
+      MCAuto<MEDFileUMesh> reread(MEDFileUMesh::New(fileName));
+      CPPUNIT_ASSERT_EQUAL(std::string("modified"),reread->getDescription());
+      MCAuto<MEDCouplingUMesh> lev0(reread->getMeshAtLevel(0)),lev1(reread->getMeshAtLevel(-1));
+      CPPUNIT_ASSERT(lev0->isEqual(m0,1e-14));
+      CPPUNIT_ASSERT(lev1->isEqual(m1,1e-14));
+    }
+}
+
+void MEDLoaderTest::testPrefetchIterator1()
+{
+  const char fileName[]="file25.med";
+  const int nbOfTS=5;
+  MCAuto<MEDCouplingUMesh> mesh(build2DMesh_2());
+  MCAuto<MEDCouplingFieldDouble> f1(MEDCouplingFieldDouble::New(ON_CELLS,ONE_TIME));
+  f1->setName("Field1");
+  f1->setMesh(mesh);
+  for(int i=0;i<nbOfTS;i++)
+    {
+      f1->setTime((double)i,i,0);
+      f1->fillFromAnalytic(2,"x+y");
+      f1->getArray()->applyLin(1.,(double)i);
+      if(i==0)
+        WriteField(fileName,f1,true);
+      else
+        WriteFieldUsingAlreadyWrittenMesh(fileName,f1);
+    }
+  auto ArrayOf=[](const MEDFileAnyTypeField1TS *f1ts) { return dynamic_cast<const MEDFileField1TS&>(*f1ts).getUndergroundDataArray(); };
+  MCAuto<MEDFileAnyTypeFieldMultiTS> ref(MEDFileAnyTypeFieldMultiTS::New(fileName,"Field1",true));
+  MCAuto<MEDFileAnyTypeFieldMultiTS> fmts(MEDFileAnyTypeFieldMultiTS::New(fileName,"Field1",false));
+  for(int nbOfPrefetched=0;nbOfPrefetched<3;nbOfPrefetched++)
+    {
+      MEDFileAnyTypeFieldMultiTSPrefetchIterator *it(fmts->prefetchIterator(nbOfPrefetched));
+      MCAuto<MEDFileAnyTypeField1TS> prev;
+      int i(0);
+      for(MCAuto<MEDFileAnyTypeField1TS> f1ts(it->nextt());f1ts.isNotNull();f1ts=it->nextt(),i++)
+        {
+          CPPUNIT_ASSERT_EQUAL(i,f1ts->getIteration());
+          MCAuto<MEDFileAnyTypeField1TS> f1tsRef(ref->getTimeStepAtPos(i));
+          const DataArrayDouble *arr(ArrayOf(f1ts)),*arrRef(ArrayOf(f1tsRef));
+          CPPUNIT_ASSERT(arr->isAllocated());
+          CPPUNIT_ASSERT(arr->isEqualWithoutConsideringStr(*arrRef,1e-12));
+          if(prev.isNotNull())// the previous time step has been released
+            CPPUNIT_ASSERT(!ArrayOf(prev)->isAllocated());
+          prev=f1ts;
+        }
+      CPPUNIT_ASSERT_EQUAL(nbOfTS,i);
+      CPPUNIT_ASSERT(MCConstAuto<MEDFileReadSession>(MEDFileReadSession::Find(fileName)));
+      delete it;
+      CPPUNIT_ASSERT(!MCConstAuto<MEDFileReadSession>(MEDFileReadSession::Find(fileName)));
+      CPPUNIT_ASSERT(!ArrayOf(prev)->isAllocated());
+    }
+  // stopping the iteration before the end releases the prefetched time steps
+  MEDFileAnyTypeFieldMultiTSPrefetchIterator *it(fmts->prefetchIterator(2));
+  MCAuto<MEDFileAnyTypeField1TS> f1ts(it->nextt());
+  CPPUNIT_ASSERT_EQUAL(0,f1ts->getIteration());
+  delete it;
+  for(int i=0;i<nbOfTS;i++)
+    {
+      MCAuto<MEDFileAnyTypeField1TS> elt(fmts->getTimeStepAtPos(i));
+      CPPUNIT_ASSERT(!ArrayOf(elt)->isAllocated());
+    }
+}
+
 void MEDLoaderTest::testMEDLoaderRead1()
 {
   using namespace std;
@@ -55,6 +55,10 @@ namespace MEDCoupling
     CPPUNIT_TEST( testWriteUMeshesRW1 );
     CPPUNIT_TEST( testMixCellAndNodesFieldRW1 );
     CPPUNIT_TEST( testGetAllFieldNamesRW1 );
+    CPPUNIT_TEST( testReadSession1 );
+    CPPUNIT_TEST( testLazyLevels1 );
+    CPPUNIT_TEST( testLazyLevels2 );
+    CPPUNIT_TEST( testPrefetchIterator1 );
 
     // Previously in ParaMEDMEM:
     CPPUNIT_TEST(testMEDLoaderRead1);
@@ -86,6 +90,10 @@ namespace MEDCoupling
     void testWriteUMeshesRW1();
     void testMixCellAndNodesFieldRW1();
     void testGetAllFieldNamesRW1();
+    void testReadSession1();
+    void testLazyLevels1();
+    void testLazyLevels2();
+    void testPrefetchIterator1();
 
     void testMEDLoaderRead1();
     void testMEDLoaderPolygonRead();
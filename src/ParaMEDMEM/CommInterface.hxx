@@ -116,6 +116,12 @@ namespace MEDCoupling
     int Irecv(void* buffer, int count, MPI_Datatype datatype, int source,
               int tag, MPI_Comm comm, MPI_Request* request) const { return MPI_Irecv(buffer,count, datatype, source, tag, comm, request); }
 
+    int sendInit(const void* buffer, int count, MPI_Datatype datatype, int target,
+                 int tag, MPI_Comm comm, MPI_Request *request) const { return MPI_Send_init(const_cast<void*>(buffer),count, datatype, target, tag, comm, request); }
+    int recvInit(void* buffer, int count, MPI_Datatype datatype, int source,
+                 int tag, MPI_Comm comm, MPI_Request* request) const { return MPI_Recv_init(buffer,count, datatype, source, tag, comm, request); }
+    int startAll(int count, MPI_Request *array_of_requests) const { return MPI_Startall(count, array_of_requests); }
+
     int wait(MPI_Request *request, MPI_Status *status) const { return MPI_Wait(request, status); }
     int test(MPI_Request *request, int *flag, MPI_Status *status) const { return MPI_Test(request, flag, status); }
     int requestFree(MPI_Request *request) const { return MPI_Request_free(request); }
@@ -0,0 +1,127 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+
+#include "DECRequest.hxx"
+#include "CommInterface.hxx"
+
+namespace MEDCoupling
+{
+  /*!
+   * Builds an already completed request, for exchanges done synchronously.
+   */
+  DECRequest::DECRequest():_comm_interface(0),_completed(true)
+  {
+  }
+
+  /*!
+   * Request of an exchange made of the MPI requests \a requests. \a completion is called once all of them are completed.
+   */
+  DECRequest::DECRequest(const CommInterface& commInterface, const std::vector<MPI_Request>& requests, const std::function<void()>& completion):
+    _comm_interface(&commInterface),_requests(requests),_completion(completion),_completed(false)
+  {
+  }
+
+  /*!
+   * Request of an exchange whose state is given by \a test. \a completion is called once, when \a test returns true or on wait(),
+   * and must then wait for the end of the exchange.
+   */
+  DECRequest::DECRequest(const std::function<bool()>& test, const std::function<void()>& completion):
+    _comm_interface(0),_test(test),_completion(completion),_completed(false)
+  {
+  }
+
+  DECRequest::DECRequest(DECRequest&& other):_comm_interface(other._comm_interface),_requests(std::move(other._requests)),
+                                             _test(std::move(other._test)),_completion(std::move(other._completion)),_completed(other._completed)
+  {
+    other._completed=true;
+  }
+
+  DECRequest& DECRequest::operator=(DECRequest&& other)
+  {
+    if(this!=&other)
+      {
+        wait();
+        _comm_interface=other._comm_interface;
+        _requests=std::move(other._requests);
+        _test=std::move(other._test);
+        _completion=std::move(other._completion);
+        _completed=other._completed;
+        other._completed=true;
+      }
+    return *this;
+  }
+
+  /*!
+   * Waits for the request if it is not completed yet. Errors raised meanwhile are swallowed, as a destructor must not throw :
+   * complete the request explicitly with test() or wait() to get them.
+   */
+  DECRequest::~DECRequest()
+  {
+    try
+      {
+        wait();
+      }
+    catch(...)
+      {
+      }
+  }
+
+  /*!
+   * Returns true if the exchange is over, without blocking. The received values are then available in the field attached to the DEC.
+   */
+  bool DECRequest::test()
+  {
+    if(_completed)
+      return true;
+    bool done(true);
+    if(_test)
+      done=_test();
+    else if(!_requests.empty())
+      {
+        int flag(0);
+        std::vector<MPI_Status> status(_requests.size());
+        _comm_interface->testall((int)_requests.size(),_requests.data(),&flag,status.data());
+        done=(flag!=0);
+      }
+    if(done)
+      complete();
+    return done;
+  }
+
+  /*!
+   * Blocks until the exchange is over. The received values are then available in the field attached to the DEC.
+   */
+  void DECRequest::wait()
+  {
+    if(_completed)
+      return ;
+    if(!_test && !_requests.empty())
+      {
+        std::vector<MPI_Status> status(_requests.size());
+        _comm_interface->waitall((int)_requests.size(),_requests.data(),status.data());
+      }
+    complete();
+  }
+
+  void DECRequest::complete()
+  {
+    _completed=true;
+    if(_completion)
+      _completion();
+  }
+}
@@ -0,0 +1,73 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+
+#pragma once
+
+#include <mpi.h>
+#include <vector>
+#include <functional>
+
+namespace MEDCoupling
+{
+  class CommInterface;
+
+  /*!
+   * Completion handle of an asynchronous exchange of a DEC, returned by DisjointDEC::isendData() and DisjointDEC::irecvData().
+   *
+   * The exchange progresses in background while the caller goes on computing. test() tells without blocking whether it is over,
+   * wait() blocks until it is. The received values are stored in the field attached to the DEC only once the request is completed
+   * (by test() returning true or by wait()), and the attached field must not be modified or read in the meantime.
+   *
+   * A request must be completed before the next exchange in the same direction and before the destruction of its DEC.
+   * The destructor waits for the request if it is not completed yet, but swallows the errors raised meanwhile : complete the
+ * request explicitly with test() or wait() to get them. test() and wait() throw an INTERP_KERNEL::Exception if the DEC has been
+ * released or synchronized again in the meantime. A request can be moved but not copied.
+   *
+   * \code
+   * DECRequest req(dec.irecvData());
+   * while(!req.test())
+   *   solver.iterate();
+   * \endcode
+   */
+  class DECRequest
+  {
+  public:
+    DECRequest();
+    DECRequest(const CommInterface& commInterface, const std::vector<MPI_Request>& requests, const std::function<void()>& completion);
+    DECRequest(const std::function<bool()>& test, const std::function<void()>& completion);
+    DECRequest(DECRequest&& other);
+    DECRequest& operator=(DECRequest&& other);
+    DECRequest(const DECRequest&) = delete;
+    DECRequest& operator=(const DECRequest&) = delete;
+    ~DECRequest();
+    bool test();
+    void wait();
+    bool isCompleted() const { return _completed; }
+  private:
+    void complete();
+  private:
+    const CommInterface *_comm_interface;
+    //! MPI requests of the exchange, if it is not followed by _test
+    std::vector<MPI_Request> _requests;
+    //! tells without blocking whether the exchange is over, if it is not described by _requests
+    std::function<bool()> _test;
+    //! called once when the exchange is over. It waits for its end if it is described by _test, and unpacks the received values.
+    std::function<void()> _completion;
+    bool _completed;
+  };
+}
@@ -376,6 +376,26 @@ namespace MEDCoupling
       }
   }
 
+  /*!
+   * Receives the data without waiting for the end of the exchange, which is completed by the returned request.
+   * This default implementation calls recvData() and returns a completed request.
+   */
+  DECRequest DisjointDEC::irecvData()
+  {
+    recvData();
+    return DECRequest();
+  }
+
+  /*!
+   * Sends the data without waiting for the end of the exchange, which is completed by the returned request.
+   * This default implementation calls sendData() and returns a completed request.
+   */
+  DECRequest DisjointDEC::isendData()
+  {
+    sendData();
+    return DECRequest();
+  }
+
   /*!
     If way==true, source procs call sendData() and target procs call recvData().
     if way==false, it's the other way round.
@@ -23,6 +23,7 @@
 #include "MEDCouplingFieldDouble.hxx"
 #include "NormalizedUnstructuredMesh.hxx"
 #include "DEC.hxx"
+#include "DECRequest.hxx"
 
 #include <mpi.h>
 #include <set>
@@ -50,6 +51,9 @@ namespace MEDCoupling
    * sending side.
    *
    * The data is sent or received through calls to the (abstract) methods recvData() and sendData().
+   * The non-blocking methods irecvData() and isendData() start the exchange and return a \ref MEDCoupling::DECRequest "DECRequest"
+   * completing it, so that the transfer overlaps with the computations of the caller. The DECs not implementing them exchange
+   * synchronously and return a completed request.
    *
    * One can attach either a \c MEDCoupling::ParaFIELD, or a
    * \c ICoCo::Field, or directly a \c MEDCoupling::MEDCouplingFieldDouble instance.
@@ -90,6 +94,8 @@ namespace MEDCoupling
     virtual void prepareTargetDE() = 0;
     virtual void recvData() = 0;
     virtual void sendData() = 0;
+    virtual DECRequest irecvData();
+    virtual DECRequest isendData();
     void sendRecvData(bool way=true);
     virtual void synchronize() = 0;
 
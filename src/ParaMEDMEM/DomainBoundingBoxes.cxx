@@ -0,0 +1,133 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#include "DomainBoundingBoxes.hxx"
+#include "MEDCouplingPointSet.hxx"
+#include "MEDCouplingMemArray.hxx"
+#include "MCAuto.hxx"
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+using namespace MEDCoupling;
+
+/*!
+ * Fills \a boxes with the hierarchy of boxes of \a mesh. The global box is the bounding box of the nodes of \a mesh, as in the single box
+ * description, enlarged to contain the boxes of the clusters (quadratic cells may go beyond their nodes).
+ * If \a mesh has less than 2^NB_OF_LEVELS clusters of cells, the remaining boxes are empty.
+ */
+void DomainBoundingBoxes::Fill(const MEDCouplingPointSet *mesh, int spaceDim, double *boxes)
+{
+  FillEmpty(spaceDim,boxes);
+  mesh->getBoundingBox(boxes);
+  MCAuto<DataArrayDouble> clusters(mesh->getBoundingBoxesOfCellClusters(NB_OF_LEVELS));
+  std::copy(clusters->begin(),clusters->end(),boxes+2*spaceDim);
+  for(mcIdType i=0;i<clusters->getNumberOfTuples();i++)
+    for(int idim=0;idim<spaceDim;idim++)
+      {
+        boxes[2*idim]=std::min(boxes[2*idim],clusters->getIJ(i,2*idim));
+        boxes[2*idim+1]=std::max(boxes[2*idim+1],clusters->getIJ(i,2*idim+1));
+      }
+}
+
+void DomainBoundingBoxes::FillEmpty(int spaceDim, double *boxes)
+{
+  for(int i=0;i<GetNumberOfBoxes()*spaceDim;i++)
+    {
+      boxes[2*i]=std::numeric_limits<double>::max();
+      boxes[2*i+1]=-std::numeric_limits<double>::max();
+    }
+}
+
+/*!
+ * Fills \a boxes with a domain covering the whole space, used for the procs having a -1D mesh.
+ */
+void DomainBoundingBoxes::FillInfinite(int spaceDim, double *boxes)
+{
+  FillEmpty(spaceDim,boxes);
+  for(int i=0;i<2*spaceDim;i++)
+    {
+      boxes[2*i]=-std::numeric_limits<double>::max();
+      boxes[2*i+1]=std::numeric_limits<double>::max();
+    }
+}
+
+/*!
+ * Returns true if the domains described by \a boxes1 and \a boxes2 may interact, that is if their global boxes intersect and if at least one
+ * box of the clusters of \a boxes1 intersects one box of the clusters of \a boxes2. The boxes are enlarged by the absolute distance \a eps.
+ */
+bool DomainBoundingBoxes::Intersect(const double *boxes1, const double *boxes2, int spaceDim, double eps)
+{
+  if(!IntersectBox(boxes1,boxes2,spaceDim,eps))
+    return false;
+  int nbOfBoxes(GetNumberOfBoxes());
+  for(int i=1;i<nbOfBoxes;i++)
+    {
+      const double *box1(boxes1+2*spaceDim*i);
+      if(IsEmpty(box1,spaceDim))
+        continue;
+      for(int j=1;j<nbOfBoxes;j++)
+        if(IntersectBox(box1,boxes2+2*spaceDim*j,spaceDim,eps))
+          return true;
+    }
+  return false;
+}
+
+/*!
+ * Returns the ids, sorted, of the cells of \a mesh whose bounding box intersects at least one box of the clusters of the domain \a boxes.
+ * \a eps is the relative adjustment of the bounding boxes of the cells, as in MEDCouplingPointSet::getCellsInBoundingBox.
+ */
+DataArrayIdType *DomainBoundingBoxes::GetCellsIn(const MEDCouplingPointSet *mesh, const double *boxes, int spaceDim, double eps)
+{
+  std::vector< MCAuto<DataArrayIdType> > cellsPerBox;
+  int nbOfBoxes(GetNumberOfBoxes());
+  for(int i=1;i<nbOfBoxes;i++)
+    {
+      const double *box(boxes+2*spaceDim*i);
+      if(!IsEmpty(box,spaceDim))
+        cellsPerBox.push_back(mesh->getCellsInBoundingBox(box,eps));
+    }
+  if(cellsPerBox.empty())
+    {
+      MCAuto<DataArrayIdType> ret(DataArrayIdType::New()); ret->alloc(0,1);
+      return ret.retn();
+    }
+  std::vector<const DataArrayIdType *> cellsPerBoxPtr(cellsPerBox.begin(),cellsPerBox.end());
+  return DataArrayIdType::BuildUnion(cellsPerBoxPtr);
+}
+
+bool DomainBoundingBoxes::IsEmpty(const double *box, int spaceDim)
+{
+  for(int idim=0;idim<spaceDim;idim++)
+    if(box[2*idim]>box[2*idim+1])
+      return true;
+  return false;
+}
+
+bool DomainBoundingBoxes::IntersectBox(const double *box1, const double *box2, int spaceDim, double eps)
+{
+  for(int idim=0;idim<spaceDim;idim++)
+    {
+      bool intersects=(box2[2*idim]<box1[2*idim+1]+eps) && (box1[2*idim]<box2[2*idim+1]+eps);
+      if(!intersects)
+        return false;
+    }
+  return true;
+}
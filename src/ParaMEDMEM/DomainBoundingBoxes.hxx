@@ -0,0 +1,55 @@
+// Copyright (C) 2007-2024  CEA, EDF
+//
+// This library is free software; you can redistribute it and/or
+// modify it under the terms of the GNU Lesser General Public
+// License as published by the Free Software Foundation; either
+// version 2.1 of the License, or (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+// Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public
+// License along with this library; if not, write to the Free Software
+// Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307 USA
+//
+// See http://www.salome-platform.org/ or email : webmaster.salome@opencascade.com
+//
+
+#pragma once
+
+#include "MCType.hxx"
+
+namespace MEDCoupling
+{
+  class MEDCouplingPointSet;
+
+  /*! Internal class, not part of the public API. Used by ElementLocator and OverlapElementLocator.
+   *
+   * Describes the region covered by the cells of a local mesh with a small hierarchy of axis-aligned boxes, exchanged between
+   * the procs to find the ones interacting and the cells to send to them : the global bounding box, then the bounding boxes of
+   * 2^NB_OF_LEVELS clusters of cells (see MEDCouplingPointSet::getBoundingBoxesOfCellClusters). A thin, curved or L-shaped domain
+   * is thus described much more tightly than by its single bounding box.
+   *
+   * The boxes of a domain are stored contiguously in GetDataSize(spaceDim) doubles, each box as xMin, xMax, yMin, yMax, zMin, zMax (if in 3D).
+   * The unused boxes are empty (min > max), so that they do not intersect anything.
+   */
+  class DomainBoundingBoxes
+  {
+  public:
+    static int GetNumberOfBoxes() { return 1+(1<<NB_OF_LEVELS); }
+    static int GetDataSize(int spaceDim) { return 2*spaceDim*GetNumberOfBoxes(); }
+    static void Fill(const MEDCouplingPointSet *mesh, int spaceDim, double *boxes);
+    static void FillEmpty(int spaceDim, double *boxes);
+    static void FillInfinite(int spaceDim, double *boxes);
+    static bool Intersect(const double *boxes1, const double *boxes2, int spaceDim, double eps);
+    static DataArrayIdType *GetCellsIn(const MEDCouplingPointSet *mesh, const double *boxes, int spaceDim, double eps);
+  public:
+    //! number of bisections of the cells of a domain : 8 boxes in addition to the global one
+    static const int NB_OF_LEVELS=3;
+  private:
+    static bool IsEmpty(const double *box, int spaceDim);
+    static bool IntersectBox(const double *box1, const double *box2, int spaceDim, double eps);
+  };
+}
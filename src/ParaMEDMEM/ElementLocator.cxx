@@ -29,6 +29,7 @@
 #include "MEDCouplingFieldDouble.hxx"
 #include "MCAuto.hxx"
 #include "DirectedBoundingBox.hxx"
+#include "DomainBoundingBoxes.hxx"
 
 #include <map>
 #include <set>
@@ -95,8 +96,8 @@ namespace MEDCoupling
     dbb.setData(distant_bb);
     elems=_local_cell_mesh->getCellsInBoundingBox(dbb,getBoundingBoxAdjustment());
 #else
-    double* distant_bb = _domain_bounding_boxes+rank*2*_local_cell_mesh_space_dim;
-    elems=_local_cell_mesh->getCellsInBoundingBox(distant_bb,getBoundingBoxAdjustment());
+    double* distant_bb = _domain_bounding_boxes+rank*DomainBoundingBoxes::GetDataSize(_local_cell_mesh_space_dim);
+    elems=DomainBoundingBoxes::GetCellsIn(_local_cell_mesh,distant_bb,_local_cell_mesh_space_dim,getBoundingBoxAdjustment());
 #endif
     
     DataArrayIdType *distant_ids_send;
@@ -161,17 +162,13 @@ namespace MEDCoupling
     if ( dbbData.size() < bbSize ) dbbData.resize(bbSize,0);
     double * minmax= &dbbData[0];
 #else
-    int bbSize = 2*_local_cell_mesh_space_dim;
+    int bbSize = DomainBoundingBoxes::GetDataSize(_local_cell_mesh_space_dim);
     _domain_bounding_boxes = new double[bbSize*_union_group->size()];
     double * minmax=new double [bbSize];
     if(_local_cell_mesh->getMeshDimension() != -1)
-      _local_cell_mesh->getBoundingBox(minmax);
+      DomainBoundingBoxes::Fill(_local_cell_mesh,_local_cell_mesh_space_dim,minmax);
     else
-      for(int i=0;i<_local_cell_mesh_space_dim;i++)
-        {
-          minmax[i*2]=-std::numeric_limits<double>::max();
-          minmax[i*2+1]=std::numeric_limits<double>::max();
-        }
+      DomainBoundingBoxes::FillInfinite(_local_cell_mesh_space_dim,minmax);
 #endif
 
     comm_interface.allGather(minmax, bbSize, MPI_DOUBLE,
@@ -206,17 +203,12 @@ namespace MEDCoupling
     distant_dbb.setData( _domain_bounding_boxes+irank*distant_dbb.dataSize( _local_cell_mesh_space_dim ));
     return !local_dbb.isDisjointWith( distant_dbb );
 #else
-    double*  local_bb = _domain_bounding_boxes+_union_group->myRank()*2*_local_cell_mesh_space_dim;
-    double*  distant_bb =  _domain_bounding_boxes+irank*2*_local_cell_mesh_space_dim;
+    int bbSize = DomainBoundingBoxes::GetDataSize(_local_cell_mesh_space_dim);
+    double*  local_bb = _domain_bounding_boxes+_union_group->myRank()*bbSize;
+    double*  distant_bb =  _domain_bounding_boxes+irank*bbSize;
 
     const double eps = 1e-12;
-    for (int idim=0; idim < _local_cell_mesh_space_dim; idim++)
-      {
-        bool intersects = (distant_bb[idim*2]<local_bb[idim*2+1]+eps)
-          && (local_bb[idim*2]<distant_bb[idim*2+1]+eps);
-        if (!intersects) return false; 
-      }
-    return true;
+    return DomainBoundingBoxes::Intersect(local_bb,distant_bb,_local_cell_mesh_space_dim,eps);
 #endif
   } 
 
@@ -29,9 +29,36 @@
 #include "InterpolationMatrix.hxx"
 #include "InterpKernelDEC.hxx"
 #include "ElementLocator.hxx"
+#include "InterpKernelException.hxx"
 
 namespace MEDCoupling
 {
+  namespace
+  {
+    /*!
+     * Request of an exchange started on \a matrix. \a alive expires when \a matrix is deleted by the DEC, the request
+     * then refuses to go on instead of using a dangling pointer.
+     */
+    DECRequest BuildMatrixRequest(const InterpolationMatrix *matrix, const std::weak_ptr<bool>& alive, bool transpose,
+                                  const std::vector<MEDCouplingFieldDouble *>& fields)
+    {
+      auto checkAlive = [alive]()
+        {
+          if(alive.expired())
+            throw INTERP_KERNEL::Exception("DECRequest : the InterpKernelDEC of this request has been released or synchronized again before its completion !");
+        };
+      if(transpose)
+        {
+          matrix->startTransposeMultiply(fields);
+          return DECRequest([matrix,checkAlive]() { checkAlive(); return matrix->testTransposeMultiply(); },
+                            [matrix,fields,checkAlive]() { checkAlive(); matrix->finishTransposeMultiply(fields); });
+        }
+      matrix->startMultiply(fields);
+      return DECRequest([matrix,checkAlive]() { checkAlive(); return matrix->testMultiply(); },
+                        [matrix,fields,checkAlive]() { checkAlive(); matrix->finishMultiply(fields); });
+    }
+  }
+
   InterpKernelDEC::InterpKernelDEC():
     DisjointDEC(),
     _interpolation_matrix(0)
@@ -113,6 +140,7 @@ namespace MEDCoupling
 
   void InterpKernelDEC::release()
   {
+    _matrix_alive.reset();
     if (_interpolation_matrix != nullptr)
       delete _interpolation_matrix;
     _interpolation_matrix = nullptr;
@@ -137,8 +165,10 @@ namespace MEDCoupling
   {
     if(!isInUnion())
       return ;
+    _matrix_alive.reset();
     delete _interpolation_matrix;
     _interpolation_matrix = new InterpolationMatrix (_local_field, *_source_group,*_target_group,*this,*this); 
+    _matrix_alive = std::make_shared<bool>(true);
 
     //setting up the communication DEC on both sides  
     if (_source_group->containsMyRank())
@@ -280,6 +310,70 @@ namespace MEDCoupling
       _interpolation_matrix->transposeMultiply(*_local_field->getField());
   }
 
+  /*!
+    Receives the values of several fields in a single message per couple of procs, whether the processor is on the working side or on
+    the lazy side. It must match a \a sendData(fields) call on the other side, with as many fields having the same numbers of components.
+    The fields must lie on the support of the field attached to the DEC, which is not modified. Forced renormalization is not supported.
+    \param fields the fields receiving the values (target side) or giving them (source side, reverse exchange)
+  */
+  void InterpKernelDEC::recvData(const std::vector<MEDCouplingFieldDouble *>& fields)
+  {
+    if (getForcedRenormalization())
+      throw INTERP_KERNEL::Exception("InterpKernelDEC::recvData : forced renormalization is not supported when exchanging several fields !");
+    if (_source_group->containsMyRank())
+      _interpolation_matrix->transposeMultiply(fields);
+    else if (_target_group->containsMyRank())
+      _interpolation_matrix->multiply(fields);
+  }
+
+  /*!
+    Sends the values of several fields in a single message per couple of procs, whether the processor is on the working side or on
+    the lazy side. It must match a \a recvData(fields) call on the other side.
+    \param fields the fields to send, lying on the support of the field attached to the DEC
+  */
+  void InterpKernelDEC::sendData(const std::vector<MEDCouplingFieldDouble *>& fields)
+  {
+    if (getForcedRenormalization())
+      throw INTERP_KERNEL::Exception("InterpKernelDEC::sendData : forced renormalization is not supported when exchanging several fields !");
+    if (_source_group->containsMyRank())
+      _interpolation_matrix->multiply(fields);
+    else if (_target_group->containsMyRank())
+      _interpolation_matrix->transposeMultiply(fields);
+  }
+
+  /*!
+    Receives the data without waiting for the end of the exchange, whether the processor is on the working side or on the lazy side.
+    It must match an \a isendData() call on the other side. The attached field is updated when the returned request is completed, and
+    must not be used in the meantime. With forced renormalization, which is collective, the exchange is synchronous.
+  */
+  DECRequest InterpKernelDEC::irecvData()
+  {
+    if (getForcedRenormalization())
+      return DisjointDEC::irecvData();
+    std::vector<MEDCouplingFieldDouble *> fields(1,_local_field->getField());
+    if (_source_group->containsMyRank())
+      return BuildMatrixRequest(_interpolation_matrix,_matrix_alive,true,fields);
+    if (_target_group->containsMyRank())
+      return BuildMatrixRequest(_interpolation_matrix,_matrix_alive,false,fields);
+    return DECRequest();
+  }
+
+  /*!
+    Sends the data without waiting for the end of the exchange, whether the processor is on the working side or on the lazy side.
+    It must match an \a irecvData() call on the other side. The attached field can be modified as soon as this method returns.
+  */
+  DECRequest InterpKernelDEC::isendData()
+  {
+    if (getForcedRenormalization())
+      return DisjointDEC::isendData();
+    std::vector<MEDCouplingFieldDouble *> fields(1,_local_field->getField());
+    if (_source_group->containsMyRank())
+      return BuildMatrixRequest(_interpolation_matrix,_matrix_alive,false,fields);
+    if (_target_group->containsMyRank())
+      return BuildMatrixRequest(_interpolation_matrix,_matrix_alive,true,fields);
+    return DECRequest();
+  }
+
   /*!
     Sends the data available at time \a time in asynchronous mode. 
     \param time time at which the value is available
@@ -24,6 +24,8 @@
 #include "MxN_Mapping.hxx"
 #include "InterpolationOptions.hxx"
 
+#include <memory>
+
 namespace MEDCoupling
 {
   class InterpolationMatrix;
@@ -66,9 +68,10 @@ namespace MEDCoupling
     - A setup phase during which the intersection volumes are computed and the communication structures are
     setup. This corresponds to calling the InterpKernelDEC::synchronize() method.
     - A running phase during which the projections are actually performed. This corresponds to the calls to
-    sendData() and recvData() which actually trigger the data exchange. The data exchange are synchronous
-    in the current version of the library so that recvData() and sendData() calls must be synchronized
-    on code A and code B processor groups.
+    sendData() and recvData() which actually trigger the data exchange. These data exchanges are synchronous
+    so that recvData() and sendData() calls must be synchronized on code A and code B processor groups.
+    The non-blocking isendData() and irecvData() start the exchange and return a DECRequest : the transfer then
+    overlaps with the computations of the caller until the request is completed by DECRequest::test() or DECRequest::wait().
 
     The following code excerpt illustrates a typical use of the InterpKernelDEC class.
 
@@ -143,6 +146,10 @@ namespace MEDCoupling
     void recvData(double time);
     void sendData();
     void sendData(double time , double deltatime);
+    void recvData(const std::vector<MEDCouplingFieldDouble *>& fields);
+    DECRequest irecvData();
+    DECRequest isendData();
+    void sendData(const std::vector<MEDCouplingFieldDouble *>& fields);
     void prepareSourceDE() { }
     void prepareTargetDE() { }
   private:
@@ -150,6 +157,8 @@ namespace MEDCoupling
     MCAuto<DataArrayIdType> retrieveNonFetchedIdsTarget() const;
   private:
     InterpolationMatrix* _interpolation_matrix;
+    //! expires when _interpolation_matrix is deleted, to detect the pending DECRequest that outlive it
+    std::shared_ptr<bool> _matrix_alive;
   };
 }
 
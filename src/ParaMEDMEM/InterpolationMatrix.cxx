@@ -867,49 +867,100 @@ namespace MEDCoupling
    */
   void InterpolationMatrix::multiply(MEDCouplingFieldDouble& field) const
   {
-    mcIdType nbcomp = ToIdType(field.getArray()->getNumberOfComponents());
-    vector<double> target_value(_col_offsets.size()* nbcomp,0.0);
-    //computing the matrix multiply on source side
-    if (_source_group.containsMyRank())
-      {
-        mcIdType nbrows = ToIdType(_coeffs.size());
-        // performing W.S
-        // W is the intersection matrix
-        // S is the source vector
+    multiply(std::vector<MEDCouplingFieldDouble *>(1,&field));
+  }
+
+  /*!
+     \brief performs t=Ws for each field of \a fields. The values of all the fields are exchanged in a single message per couple of procs.
+
+     \param fields source fields on processors involved on the source side,
+     target fields on processors on the target side
+   */
+  void InterpolationMatrix::multiply(const std::vector<MEDCouplingFieldDouble *>& fields) const
+  {
+    startMultiply(fields);
+    finishMultiply(fields);
+  }
 
-        for (mcIdType irow=0; irow<nbrows; irow++)
+  /*!
+     \brief starts multiply without waiting for the end of the exchange : on the source side W.S is computed and its sending is posted,
+     on the target side the receptions are posted. It must be followed by finishMultiply with the same fields.
+   */
+  void InterpolationMatrix::startMultiply(const std::vector<MEDCouplingFieldDouble *>& fields) const
+  {
+    std::vector< vector<double> > target_values(fields.size());
+    std::vector<const double *> target_ptrs(fields.size());
+    for (std::size_t ifield=0; ifield<fields.size(); ifield++)
+      {
+        MEDCouplingFieldDouble& field(*fields[ifield]);
+        mcIdType nbcomp = ToIdType(field.getArray()->getNumberOfComponents());
+        vector<double>& target_value(target_values[ifield]);
+        target_value.resize(_col_offsets.size()* nbcomp,0.0);
+        target_ptrs[ifield]=target_value.data();
+        //computing the matrix multiply on source side
+        if (_source_group.containsMyRank())
           {
-            for (mcIdType icomp=0; icomp< nbcomp; icomp++)
+            mcIdType nbrows = ToIdType(_coeffs.size());
+            // performing W.S
+            // W is the intersection matrix
+            // S is the source vector
+
+            for (mcIdType irow=0; irow<nbrows; irow++)
               {
-                double coeff_row = field.getIJ(irow,icomp);
-                for (mcIdType icol=_row_offsets[irow]; icol< _row_offsets[irow+1];icol++)
+                for (mcIdType icomp=0; icomp< nbcomp; icomp++)
                   {
-                    int colid= _coeffs[irow][icol-_row_offsets[irow]].first;
-                    double value = _coeffs[irow][icol-_row_offsets[irow]].second;
-                    double deno = _deno_multiply[irow][icol-_row_offsets[irow]];
-                    target_value[colid*nbcomp+icomp]+=value*coeff_row/deno;
+                    double coeff_row = field.getIJ(irow,icomp);
+                    for (mcIdType icol=_row_offsets[irow]; icol< _row_offsets[irow+1];icol++)
+                      {
+                        int colid= _coeffs[irow][icol-_row_offsets[irow]].first;
+                        double value = _coeffs[irow][icol-_row_offsets[irow]].second;
+                        double deno = _deno_multiply[irow][icol-_row_offsets[irow]];
+                        target_value[colid*nbcomp+icomp]+=value*coeff_row/deno;
+                      }
                   }
               }
           }
       }
 
+    //on source side : sending  T=VT^(-1).(W.S)
+    //on target side :: posting the reception of T
+    _mapping.startSendRecv(target_ptrs,fields);
+  }
+
+  /*!
+     \brief returns true if the exchange started by startMultiply is over, without blocking.
+   */
+  bool InterpolationMatrix::testMultiply() const
+  {
+    return _mapping.testSendRecv();
+  }
+
+  /*!
+     \brief ends the multiply started by startMultiply : on the target side, T is received and stored in \a fields.
+   */
+  void InterpolationMatrix::finishMultiply(const std::vector<MEDCouplingFieldDouble *>& fields) const
+  {
     if (_target_group.containsMyRank())
       {
-        field.getArray()->fillWithZero();
+        for (std::size_t ifield=0; ifield<fields.size(); ifield++)
+          fields[ifield]->getArray()->fillWithZero();
       }
 
-    //on source side : sending  T=VT^(-1).(W.S)
     //on target side :: receiving T and storing it in field
-    _mapping.sendRecv(target_value.data(),field);
+    _mapping.finishSendRecv(fields);
 
     if( _target_group.containsMyRank() )
     {
-      if( this->_presence_dft_value )
+      if( this->_presence_dft_value && !fields.empty() )
       {
-        const MCAuto<DataArrayIdType> nonFetchedEntities = _mapping.retrieveNonFetchedIdsTarget(field.getArray()->getNumberOfTuples());
-        double *fieldPtr( field.getArray()->getPointerSilent() );
-        for( const mcIdType *eltId = nonFetchedEntities->begin() ; eltId != nonFetchedEntities->end() ; ++eltId)
-          std::fill( fieldPtr + (*eltId)*nbcomp, fieldPtr + ((*eltId)+1)*nbcomp, this->_dft_value );
+        const MCAuto<DataArrayIdType> nonFetchedEntities = _mapping.retrieveNonFetchedIdsTarget(fields[0]->getArray()->getNumberOfTuples());
+        for (std::size_t ifield=0; ifield<fields.size(); ifield++)
+          {
+            std::size_t nbcomp = fields[ifield]->getArray()->getNumberOfComponents();
+            double *fieldPtr( fields[ifield]->getArray()->getPointerSilent() );
+            for( const mcIdType *eltId = nonFetchedEntities->begin() ; eltId != nonFetchedEntities->end() ; ++eltId)
+              std::fill( fieldPtr + (*eltId)*nbcomp, fieldPtr + ((*eltId)+1)*nbcomp, this->_dft_value );
+          }
       }
     }
   }
@@ -949,43 +1000,91 @@ namespace MEDCoupling
      */
   void InterpolationMatrix::transposeMultiply(MEDCouplingFieldDouble& field) const
   {
-    std::size_t nbcomp = field.getArray()->getNumberOfComponents();
-    vector<double> source_value(_col_offsets.size()* nbcomp,0.0);
-    _mapping.reverseSendRecv(&source_value[0],field);
+    transposeMultiply(std::vector<MEDCouplingFieldDouble *>(1,&field));
+  }
+
+  /**!
+   \brief performs s=WTt for each field of \a fields. The values of all the fields are exchanged in a single message per couple of procs.
+
+     param fields source fields on processors involved on the source side,
+     target fields on processors on the target side
+     */
+  void InterpolationMatrix::transposeMultiply(const std::vector<MEDCouplingFieldDouble *>& fields) const
+  {
+    startTransposeMultiply(fields);
+    finishTransposeMultiply(fields);
+  }
+
+  /**!
+   \brief starts transposeMultiply without waiting for the end of the exchange : on the target side the sending of T is posted,
+   on the source side its reception. It must be followed by finishTransposeMultiply with the same fields.
+   */
+  void InterpolationMatrix::startTransposeMultiply(const std::vector<MEDCouplingFieldDouble *>& fields) const
+  {
+    _mapping.startReverseSendRecv(std::vector<const MEDCouplingFieldDouble *>(fields.begin(),fields.end()));
+  }
+
+  /**!
+   \brief returns true if the exchange started by startTransposeMultiply is over, without blocking.
+   */
+  bool InterpolationMatrix::testTransposeMultiply() const
+  {
+    return _mapping.testReverseSendRecv();
+  }
+
+  /**!
+   \brief ends the transposeMultiply started by startTransposeMultiply : on the source side, T is received and S=VS^(-1).(WT.T)
+   is computed to update \a fields.
+   */
+  void InterpolationMatrix::finishTransposeMultiply(const std::vector<MEDCouplingFieldDouble *>& fields) const
+  {
+    std::vector< vector<double> > source_values(fields.size());
+    std::vector<double *> source_ptrs(fields.size());
+    for (std::size_t ifield=0; ifield<fields.size(); ifield++)
+      {
+        source_values[ifield].resize(_col_offsets.size()*fields[ifield]->getArray()->getNumberOfComponents(),0.0);
+        source_ptrs[ifield]=source_values[ifield].data();
+      }
+    _mapping.finishReverseSendRecv(source_ptrs,std::vector<const MEDCouplingFieldDouble *>(fields.begin(),fields.end()));
 
     //treatment of the transpose matrix multiply on the source side
     if (_source_group.containsMyRank())
       {
-        mcIdType nbrows = ToIdType( _coeffs.size() );
-        double   *array = field.getArray()->getPointer() ;
+        for (std::size_t ifield=0; ifield<fields.size(); ifield++)
+          {
+            std::size_t nbcomp = fields[ifield]->getArray()->getNumberOfComponents();
+            const vector<double>& source_value(source_values[ifield]);
+            mcIdType nbrows = ToIdType( _coeffs.size() );
+            double   *array = fields[ifield]->getArray()->getPointer() ;
 
-        // Initialization
-        std::fill(array, array+nbrows*nbcomp, 0.0) ;
+            // Initialization
+            std::fill(array, array+nbrows*nbcomp, 0.0) ;
 
-        //performing WT.T
-        //WT is W transpose
-        //T is the target vector
-        for (mcIdType irow = 0; irow < nbrows; irow++)
-          {
-            if( _row_offsets[irow+1] > _row_offsets[irow] )
-            {
-              for (mcIdType icol = _row_offsets[irow]; icol < _row_offsets[irow+1]; icol++)
+            //performing WT.T
+            //WT is W transpose
+            //T is the target vector
+            for (mcIdType irow = 0; irow < nbrows; irow++)
+              {
+                if( _row_offsets[irow+1] > _row_offsets[irow] )
                 {
-                  int colid    = _coeffs[irow][icol-_row_offsets[irow]].first;
-                  double value = _coeffs[irow][icol-_row_offsets[irow]].second;
-                  double deno = _deno_reverse_multiply[irow][icol-_row_offsets[irow]];
-                  for (std::size_t icomp=0; icomp<nbcomp; icomp++)
+                  for (mcIdType icol = _row_offsets[irow]; icol < _row_offsets[irow+1]; icol++)
                     {
-                      double coeff_row = source_value[colid*nbcomp+icomp];
-                      array[irow*nbcomp+icomp] += value*coeff_row/deno;
+                      int colid    = _coeffs[irow][icol-_row_offsets[irow]].first;
+                      double value = _coeffs[irow][icol-_row_offsets[irow]].second;
+                      double deno = _deno_reverse_multiply[irow][icol-_row_offsets[irow]];
+                      for (std::size_t icomp=0; icomp<nbcomp; icomp++)
+                        {
+                          double coeff_row = source_value[colid*nbcomp+icomp];
+                          array[irow*nbcomp+icomp] += value*coeff_row/deno;
+                        }
                     }
                 }
-            }
-            else
-            {
-              if( _presence_dft_value )
-                std::fill(array+irow*nbcomp,array+(irow+1)*nbcomp,this->_dft_value);
-            }
+                else
+                {
+                  if( _presence_dft_value )
+                    std::fill(array+irow*nbcomp,array+(irow+1)*nbcomp,this->_dft_value);
+                }
+              }
           }
       }
   }
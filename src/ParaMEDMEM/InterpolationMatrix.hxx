@@ -56,8 +56,16 @@ namespace MEDCoupling
     void finishContributionL(ElementLocator& elementLocator);
     MCAuto<DataArrayIdType> retrieveNonFetchedIdsTarget(mcIdType nbTuples) const;
     void multiply(MEDCouplingFieldDouble& field) const;
+    void multiply(const std::vector<MEDCouplingFieldDouble *>& fields) const;
+    void startMultiply(const std::vector<MEDCouplingFieldDouble *>& fields) const;
+    bool testMultiply() const;
+    void finishMultiply(const std::vector<MEDCouplingFieldDouble *>& fields) const;
     MCAuto<DataArrayIdType> retrieveNonFetchedIdsSource() const;
     void transposeMultiply(MEDCouplingFieldDouble& field)const;
+    void transposeMultiply(const std::vector<MEDCouplingFieldDouble *>& fields) const;
+    void startTransposeMultiply(const std::vector<MEDCouplingFieldDouble *>& fields) const;
+    bool testTransposeMultiply() const;
+    void finishTransposeMultiply(const std::vector<MEDCouplingFieldDouble *>& fields) const;
     void prepare();
     mcIdType getNbRows() const { return ToIdType(_row_offsets.size()); }
     MPIAccessDEC* getAccessDEC() { return _mapping.getAccessDEC(); }
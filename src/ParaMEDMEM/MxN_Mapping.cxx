@@ -23,6 +23,8 @@
 #include "MPIAccessDEC.hxx"
 #include "MxN_Mapping.hxx"
 
+#include <numeric>
+
 using namespace std;
 
 namespace MEDCoupling
@@ -42,6 +44,8 @@ namespace MEDCoupling
 
   MxN_Mapping::~MxN_Mapping()
   {
+    freeExchangePlan(_direct_plan);
+    freeExchangePlan(_reverse_plan);
     delete _union_group;
     delete _access_DEC;
   }
@@ -111,9 +115,11 @@ namespace MEDCoupling
         recvdispls[i]=_recv_proc_offsets[i];
       }
     vector<int> offsets = _send_proc_offsets;
+    _send_positions.resize(_sending_ids.size());
     for (std::size_t i=0; i<_sending_ids.size();i++)
       {
         int iproc = _sending_ids[i].first;
+        _send_positions[i]=offsets[iproc];
         isendbuf[offsets[iproc]]=_sending_ids[i].second;
         offsets[iproc]++;
       }
@@ -132,6 +138,9 @@ namespace MEDCoupling
     delete[]recvcounts;
     delete[]senddispls;
     delete[] recvdispls;
+    // the exchange pattern has changed : the plans are rebuilt at the next exchanges
+    freeExchangePlan(_direct_plan);
+    freeExchangePlan(_reverse_plan);
   }
 
   MCAuto<DataArrayIdType> MxN_Mapping::retrieveNonFetchedIdsTarget(mcIdType nbTuples) const
@@ -160,78 +169,7 @@ namespace MEDCoupling
    */ 
   void MxN_Mapping::sendRecv(double* sendfield, MEDCouplingFieldDouble& field) const 
   {
-    CommInterface comm_interface=_union_group->getCommInterface();
-    const MPIProcessorGroup* group = static_cast<const MPIProcessorGroup*>(_union_group);
- 
-    int nbcomp=(int)field.getArray()->getNumberOfComponents();
-    double* sendbuf=0;
-    double* recvbuf=0;
-    if (_sending_ids.size() >0)
-      sendbuf = new double[_sending_ids.size()*nbcomp];
-    if (_recv_ids.size()>0)
-      recvbuf = new double[_recv_ids.size()*nbcomp];
-    int* sendcounts = new int[_union_group->size()];
-    int* senddispls=new int[_union_group->size()];
-    int* recvcounts=new int[_union_group->size()];
-    int* recvdispls=new int[_union_group->size()];
-  
-    for (int i=0; i< _union_group->size(); i++)
-      {
-        sendcounts[i]=nbcomp*(_send_proc_offsets[i+1]-_send_proc_offsets[i]);
-        senddispls[i]=nbcomp*(_send_proc_offsets[i]);
-        recvcounts[i]=nbcomp*(_recv_proc_offsets[i+1]-_recv_proc_offsets[i]);
-        recvdispls[i]=nbcomp*(_recv_proc_offsets[i]);
-      }
-    //building the buffer of the elements to be sent
-    vector<int> offsets = _send_proc_offsets;
-
-    for (int i=0; i<(int)_sending_ids.size();i++)
-      { 
-        int iproc = _sending_ids[i].first;
-        for (int icomp=0; icomp<nbcomp; icomp++)
-          sendbuf[offsets[iproc]*nbcomp+icomp]=sendfield[i*nbcomp+icomp];
-        offsets[iproc]++;
-      }
-  
-    //communication phase
-    switch (getAllToAllMethod())
-      {
-      case Native:
-        {
-          const MPI_Comm* comm = group->getComm();
-          comm_interface.allToAllV(sendbuf, sendcounts, senddispls, MPI_DOUBLE,
-                                   recvbuf, recvcounts, recvdispls, MPI_DOUBLE,
-                                   *comm);
-        }
-        break;
-      case PointToPoint:
-        _access_DEC->allToAllv(sendbuf, sendcounts, senddispls, MPI_DOUBLE,
-                               recvbuf, recvcounts, recvdispls, MPI_DOUBLE);
-        break;
-      }
-  
-    //setting the received values in the field
-    DataArrayDouble *fieldArr=field.getArray();
-    double* recvptr=recvbuf;
-    for (int i=0; i< _recv_proc_offsets[_union_group->size()]; i++)
-      {
-        mcIdType recvId(_recv_ids[i]);
-        for (int icomp=0; icomp<nbcomp; icomp++)
-          {
-            double temp = fieldArr->getIJ(recvId,icomp);
-            fieldArr->setIJ(recvId,icomp,temp+*recvptr);
-            recvptr++;
-          }
-      }
-    if (sendbuf!=0 && getAllToAllMethod()== Native)
-      delete[] sendbuf;
-    if (recvbuf !=0)
-      delete[] recvbuf;
-    delete[] sendcounts;
-    delete[] recvcounts;
-    delete[] senddispls; 
-    delete[] recvdispls;
-  
+    sendRecv(std::vector<const double *>(1,sendfield),std::vector<MEDCouplingFieldDouble *>(1,&field));
   }
 
   /*! Exchanging field data between two groups of processes
@@ -243,74 +181,277 @@ namespace MEDCoupling
    */ 
   void MxN_Mapping::reverseSendRecv(double* recvfield, MEDCouplingFieldDouble& field) const 
   {
-    CommInterface comm_interface=_union_group->getCommInterface();
-    const MPIProcessorGroup* group = static_cast<const MPIProcessorGroup*>(_union_group);
+    reverseSendRecv(std::vector<double *>(1,recvfield),std::vector<const MEDCouplingFieldDouble *>(1,&field));
+  }
 
-    int nbcomp=(int)field.getArray()->getNumberOfComponents();
-    double* sendbuf=0;
-    double* recvbuf=0;
-    if (_recv_ids.size() >0)
-      sendbuf = new double[_recv_ids.size()*nbcomp];
-    if (_sending_ids.size()>0)
-      recvbuf = new double[_sending_ids.size()*nbcomp];
+  /*! Exchanging the data of several fields between two groups of processes, in a single message per couple of processes.
+   *
+   * \param sendfields the values to be sent for each field, in the order of the ids defined by addElementFromSource method
+   * \param fields MEDCoupling fields in which the received values are added
+   */
+  void MxN_Mapping::sendRecv(const std::vector<const double *>& sendfields, const std::vector<MEDCouplingFieldDouble *>& fields) const
+  {
+    startSendRecv(sendfields,fields);
+    finishSendRecv(fields);
+  }
 
-    int* sendcounts = new int[_union_group->size()];
-    int* senddispls=new int[_union_group->size()];
-    int* recvcounts=new int[_union_group->size()];
-    int* recvdispls=new int[_union_group->size()];
+  /*! Exchanging the data of several fields between two groups of processes in the reverse direction, in a single message per couple
+   * of processes.
+   *
+   * \param recvfields the arrays receiving the values of each field, in the order of the ids defined by addElementFromSource method
+   * \param fields MEDCoupling fields containing the values to be sent
+   */
+  void MxN_Mapping::reverseSendRecv(const std::vector<double *>& recvfields, const std::vector<const MEDCouplingFieldDouble *>& fields) const
+  {
+    startReverseSendRecv(fields);
+    finishReverseSendRecv(recvfields,fields);
+  }
 
-    for (int i=0; i< _union_group->size(); i++)
+  /*! Starts the exchange of sendRecv without waiting for its end : the values to send are packed and the communications are posted.
+   * It must be followed by finishSendRecv, with the same fields, before the next exchange in this direction.
+   * With the PointToPoint method, the exchange is entirely done here.
+   */
+  void MxN_Mapping::startSendRecv(const std::vector<const double *>& sendfields, const std::vector<MEDCouplingFieldDouble *>& fields) const
+  {
+    if(sendfields.size()!=fields.size())
+      throw INTERP_KERNEL::Exception("MxN_Mapping::startSendRecv : the number of arrays to send and the number of fields mismatch !");
+    if(_direct_plan._pending)
+      throw INTERP_KERNEL::Exception("MxN_Mapping::startSendRecv : the previous exchange is not finished !");
+    std::vector<int> nbcomps(NumberOfComponents(fields));
+    int nbcomp=std::accumulate(nbcomps.begin(),nbcomps.end(),0);
+    if (_direct_plan._nb_comps!=nbcomp)
+      buildExchangePlan(_direct_plan,nbcomp,false);
+    //building the buffer of the elements to be sent
+    double *sendbuf=_direct_plan._send_buffer.data();
+    for (std::size_t i=0; i<_sending_ids.size(); i++)
       {
-        sendcounts[i]=nbcomp*(_recv_proc_offsets[i+1]-_recv_proc_offsets[i]);
-        senddispls[i]=nbcomp*(_recv_proc_offsets[i]);
-        recvcounts[i]=nbcomp*(_send_proc_offsets[i+1]-_send_proc_offsets[i]);
-        recvdispls[i]=nbcomp*(_send_proc_offsets[i]);
+        double *sendptr=sendbuf+(std::size_t)_send_positions[i]*nbcomp;
+        for (std::size_t k=0; k<fields.size(); k++)
+          sendptr=std::copy(sendfields[k]+i*nbcomps[k],sendfields[k]+(i+1)*nbcomps[k],sendptr);
       }
-    //building the buffer of the elements to be sent
-    vector<int> offsets = _recv_proc_offsets;
-    DataArrayDouble *fieldArr=field.getArray();
-    for (int iproc=0; iproc<_union_group->size();iproc++)
-      for (int i=_recv_proc_offsets[iproc]; i<_recv_proc_offsets[iproc+1]; i++)
+
+    //communication phase
+    startExchange(_direct_plan,false);
+  }
+
+  /*! Returns true if the exchange started by startSendRecv is over, without blocking.
+   */
+  bool MxN_Mapping::testSendRecv() const
+  {
+    return testExchange(_direct_plan);
+  }
+
+  /*! Waits for the end of the exchange started by startSendRecv and adds the received values in \a fields.
+   */
+  void MxN_Mapping::finishSendRecv(const std::vector<MEDCouplingFieldDouble *>& fields) const
+  {
+    std::vector<int> nbcomps(NumberOfComponents(fields));
+    const double* recvptr=finishExchange(_direct_plan);
+
+    //setting the received values in the fields
+    if (_recv_ids.empty())
+      return ;
+    std::vector<double *> fieldPtrs(fields.size());
+    for (std::size_t k=0; k<fields.size(); k++)
+      fieldPtrs[k]=fields[k]->getArray()->getPointer();
+    for (std::size_t i=0; i<_recv_ids.size(); i++)
+      for (std::size_t k=0; k<fields.size(); k++)
         {
-          for (int icomp=0; icomp<nbcomp; icomp++)
-            sendbuf[i*nbcomp+icomp]=fieldArr->getIJ(_recv_ids[i],icomp);
+          double *fieldptr=fieldPtrs[k]+_recv_ids[i]*nbcomps[k];
+          for (int icomp=0; icomp<nbcomps[k]; icomp++)
+            fieldptr[icomp]+=*recvptr++;
         }
+  }
+
+  /*! Starts the exchange of reverseSendRecv without waiting for its end. It must be followed by finishReverseSendRecv, with the
+   * same fields, before the next exchange in this direction.
+   */
+  void MxN_Mapping::startReverseSendRecv(const std::vector<const MEDCouplingFieldDouble *>& fields) const
+  {
+    if(_reverse_plan._pending)
+      throw INTERP_KERNEL::Exception("MxN_Mapping::startReverseSendRecv : the previous exchange is not finished !");
+    std::vector<int> nbcomps(NumberOfComponents(fields));
+    int nbcomp=std::accumulate(nbcomps.begin(),nbcomps.end(),0);
+    if (_reverse_plan._nb_comps!=nbcomp)
+      buildExchangePlan(_reverse_plan,nbcomp,true);
+    //building the buffer of the elements to be sent
+    if (!_recv_ids.empty())
+      {
+        double *sendptr=_reverse_plan._send_buffer.data();
+        std::vector<const double *> fieldPtrs(fields.size());
+        for (std::size_t k=0; k<fields.size(); k++)
+          fieldPtrs[k]=fields[k]->getArray()->begin();
+        for (std::size_t i=0; i<_recv_ids.size(); i++)
+          for (std::size_t k=0; k<fields.size(); k++)
+            sendptr=std::copy(fieldPtrs[k]+_recv_ids[i]*nbcomps[k],fieldPtrs[k]+(_recv_ids[i]+1)*nbcomps[k],sendptr);
+      }
 
     //communication phase
+    startExchange(_reverse_plan,true);
+  }
+
+  /*! Returns true if the exchange started by startReverseSendRecv is over, without blocking.
+   */
+  bool MxN_Mapping::testReverseSendRecv() const
+  {
+    return testExchange(_reverse_plan);
+  }
+
+  /*! Waits for the end of the exchange started by startReverseSendRecv and stores the received values in \a recvfields.
+   */
+  void MxN_Mapping::finishReverseSendRecv(const std::vector<double *>& recvfields, const std::vector<const MEDCouplingFieldDouble *>& fields) const
+  {
+    if(recvfields.size()!=fields.size())
+      throw INTERP_KERNEL::Exception("MxN_Mapping::finishReverseSendRecv : the number of arrays to receive and the number of fields mismatch !");
+    std::vector<int> nbcomps(NumberOfComponents(fields));
+    const double* recvptr=finishExchange(_reverse_plan);
+
+    //setting the received values in the arrays
+    for (std::size_t i=0; i<_sending_ids.size(); i++)
+      for (std::size_t k=0; k<fields.size(); k++)
+        {
+          std::copy(recvptr,recvptr+nbcomps[k],recvfields[k]+i*nbcomps[k]);
+          recvptr+=nbcomps[k];
+        }
+  }
+
+  /*!
+   * Builds the buffers of \a plan for the exchanges of \a nbComps values per element, from the elements defined by addElementFromSource
+   * method to the received ones (or the reverse if \a reverse is true). With the Native method, the persistent requests of these
+   * exchanges are created too, once for all the following exchanges.
+   */
+  void MxN_Mapping::buildExchangePlan(ExchangePlan& plan, int nbComps, bool reverse) const
+  {
+    freeExchangePlan(plan);
+    const vector<int>& sendOffsets(reverse?_recv_proc_offsets:_send_proc_offsets);
+    const vector<int>& recvOffsets(reverse?_send_proc_offsets:_recv_proc_offsets);
+    int nbProcs=_union_group->size();
+    plan._nb_comps=nbComps;
+    plan._send_buffer.resize((std::size_t)sendOffsets[nbProcs]*nbComps);
+    plan._recv_buffer.resize((std::size_t)recvOffsets[nbProcs]*nbComps);
+    if (getAllToAllMethod()!=Native)
+      return ;
+    CommInterface comm_interface=_union_group->getCommInterface();
+    const MPIProcessorGroup* group = static_cast<const MPIProcessorGroup*>(_union_group);
+    const MPI_Comm* comm = group->getComm();
+    int tag=reverse?TAG_REVERSE_EXCHANGE:TAG_DIRECT_EXCHANGE;
+    for (int i=0; i<nbProcs; i++)
+      if (recvOffsets[i+1]>recvOffsets[i])
+        {
+          MPI_Request request;
+          comm_interface.recvInit(plan._recv_buffer.data()+(std::size_t)recvOffsets[i]*nbComps,(recvOffsets[i+1]-recvOffsets[i])*nbComps,MPI_DOUBLE,
+                                  i,tag,*comm,&request);
+          plan._requests.push_back(request);
+        }
+    for (int i=0; i<nbProcs; i++)
+      if (sendOffsets[i+1]>sendOffsets[i])
+        {
+          MPI_Request request;
+          comm_interface.sendInit(plan._send_buffer.data()+(std::size_t)sendOffsets[i]*nbComps,(sendOffsets[i+1]-sendOffsets[i])*nbComps,MPI_DOUBLE,
+                                  i,tag,*comm,&request);
+          plan._requests.push_back(request);
+        }
+  }
+
+  void MxN_Mapping::freeExchangePlan(ExchangePlan& plan) const
+  {
+    // an active persistent request can not be freed before its completion
+    finishExchange(plan);
+    CommInterface comm_interface=_union_group->getCommInterface();
+    for (std::vector<MPI_Request>::iterator it=plan._requests.begin(); it!=plan._requests.end(); it++)
+      comm_interface.requestFree(&(*it));
+    plan._requests.clear();
+    plan._nb_comps=0;
+  }
+
+  /*!
+   * Sends the values packed in the send buffer of \a plan and posts the receptions of the ones of the distant procs in its receive buffer.
+   * With the Native method the persistent requests of \a plan are started. With the PointToPoint method the exchange goes through
+   * MPIAccessDEC, which takes the ownership of a copy of the send buffer as asynchronous sends may outlive this call, and is done here.
+   */
+  void MxN_Mapping::startExchange(ExchangePlan& plan, bool reverse) const
+  {
     switch (getAllToAllMethod())
       {
       case Native:
-        {
-          const MPI_Comm* comm = group->getComm();
-          comm_interface.allToAllV(sendbuf, sendcounts, senddispls, MPI_DOUBLE,
-                                   recvbuf, recvcounts, recvdispls, MPI_DOUBLE,
-                                   *comm);
-        }
+        if (!plan._requests.empty())
+          {
+            CommInterface comm_interface=_union_group->getCommInterface();
+            comm_interface.startAll((int)plan._requests.size(),plan._requests.data());
+          }
         break;
       case PointToPoint:
-        _access_DEC->allToAllv(sendbuf, sendcounts, senddispls, MPI_DOUBLE,
-                               recvbuf, recvcounts, recvdispls, MPI_DOUBLE);
+        {
+          const vector<int>& sendOffsets(reverse?_recv_proc_offsets:_send_proc_offsets);
+          const vector<int>& recvOffsets(reverse?_send_proc_offsets:_recv_proc_offsets);
+          int nbProcs=_union_group->size();
+          vector<int> sendcounts(nbProcs),senddispls(nbProcs),recvcounts(nbProcs),recvdispls(nbProcs);
+          for (int i=0; i<nbProcs; i++)
+            {
+              sendcounts[i]=plan._nb_comps*(sendOffsets[i+1]-sendOffsets[i]);
+              senddispls[i]=plan._nb_comps*sendOffsets[i];
+              recvcounts[i]=plan._nb_comps*(recvOffsets[i+1]-recvOffsets[i]);
+              recvdispls[i]=plan._nb_comps*recvOffsets[i];
+            }
+          double* sendbuf=0;
+          if (!plan._send_buffer.empty())
+            {
+              sendbuf=new double[plan._send_buffer.size()];
+              std::copy(plan._send_buffer.begin(),plan._send_buffer.end(),sendbuf);
+            }
+          _access_DEC->allToAllv(sendbuf, sendcounts.data(), senddispls.data(), MPI_DOUBLE,
+                                 plan._recv_buffer.empty()?0:plan._recv_buffer.data(), recvcounts.data(), recvdispls.data(), MPI_DOUBLE);
+        }
         break;
       }
+    plan._pending=true;
+  }
+
+  /*!
+   * Returns true if the exchange started on \a plan is over, without blocking. The requests of \a plan remain to be completed by finishExchange.
+   */
+  bool MxN_Mapping::testExchange(ExchangePlan& plan) const
+  {
+    if (!plan._pending || plan._requests.empty())
+      return true;
+    CommInterface comm_interface=_union_group->getCommInterface();
+    int flag=0;
+    std::vector<MPI_Status> status(plan._requests.size());
+    comm_interface.testall((int)plan._requests.size(),plan._requests.data(),&flag,status.data());
+    if (flag)
+      plan._pending=false;
+    return flag!=0;
+  }
 
-    //setting the received values in the field
-    double* recvptr=recvbuf;                         
-    for (int i=0; i< _send_proc_offsets[_union_group->size()]; i++)
+  /*!
+   * Waits for the end of the exchange started on \a plan and returns the buffer holding the received values.
+   */
+  const double *MxN_Mapping::finishExchange(ExchangePlan& plan) const
+  {
+    if (plan._pending && !plan._requests.empty())
       {
-        for (int icomp=0; icomp<nbcomp; icomp++)
-          {
-            recvfield[i*nbcomp+icomp]=*recvptr;
-            recvptr++;
-          }
+        CommInterface comm_interface=_union_group->getCommInterface();
+        std::vector<MPI_Status> status(plan._requests.size());
+        comm_interface.waitall((int)plan._requests.size(),plan._requests.data(),status.data());
       }
-    if (sendbuf!=0 && getAllToAllMethod() == Native)
-      delete[] sendbuf;
-    if (recvbuf!=0)
-      delete[] recvbuf;
-    delete[] sendcounts;
-    delete[] recvcounts;
-    delete[] senddispls; 
-    delete[] recvdispls;
+    plan._pending=false;
+    return plan._recv_buffer.data();
+  }
+
+  std::vector<int> MxN_Mapping::NumberOfComponents(const std::vector<MEDCouplingFieldDouble *>& fields)
+  {
+    std::vector<int> ret(fields.size());
+    for (std::size_t k=0; k<fields.size(); k++)
+      ret[k]=(int)fields[k]->getArray()->getNumberOfComponents();
+    return ret;
+  }
+
+  std::vector<int> MxN_Mapping::NumberOfComponents(const std::vector<const MEDCouplingFieldDouble *>& fields)
+  {
+    std::vector<int> ret(fields.size());
+    for (std::size_t k=0; k<fields.size(); k++)
+      ret[k]=(int)fields[k]->getArray()->getNumberOfComponents();
+    return ret;
   }
 
   ostream & operator<< (ostream & f ,const AllToAllMethod & alltoallmethod )
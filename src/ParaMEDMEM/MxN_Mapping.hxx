@@ -48,6 +48,14 @@ namespace MEDCoupling
     MCAuto<DataArrayIdType> retrieveNonFetchedIdsTarget(mcIdType nbTuples) const;
     void sendRecv(double* sendfield, MEDCouplingFieldDouble& field) const ;
     void reverseSendRecv(double* recvfield, MEDCouplingFieldDouble& field) const ;
+    void sendRecv(const std::vector<const double *>& sendfields, const std::vector<MEDCouplingFieldDouble *>& fields) const;
+    void reverseSendRecv(const std::vector<double *>& recvfields, const std::vector<const MEDCouplingFieldDouble *>& fields) const;
+    void startSendRecv(const std::vector<const double *>& sendfields, const std::vector<MEDCouplingFieldDouble *>& fields) const;
+    bool testSendRecv() const;
+    void finishSendRecv(const std::vector<MEDCouplingFieldDouble *>& fields) const;
+    void startReverseSendRecv(const std::vector<const MEDCouplingFieldDouble *>& fields) const;
+    bool testReverseSendRecv() const;
+    void finishReverseSendRecv(const std::vector<double *>& recvfields, const std::vector<const MEDCouplingFieldDouble *>& fields) const;
  
     //
     const std::vector<std::pair<int,mcIdType> >& getSendingIds() const { return _sending_ids; }
@@ -55,6 +63,29 @@ namespace MEDCoupling
     void initialize();
 
     MPIAccessDEC* getAccessDEC(){ return _access_DEC; }
+  private :
+    /*! Persistent requests and buffers of the exchanges in one direction. They are built at the first exchange with a given
+     * number of components and reused by the following ones, as the exchange pattern does not change after prepareSendRecv. */
+    struct ExchangePlan
+    {
+      ExchangePlan():_nb_comps(0),_pending(false) { }
+      int _nb_comps;
+      //! true between the start of an exchange and its end
+      bool _pending;
+      std::vector<double> _send_buffer;
+      std::vector<double> _recv_buffer;
+      std::vector<MPI_Request> _requests;
+    };
+    void buildExchangePlan(ExchangePlan& plan, int nbComps, bool reverse) const;
+    void freeExchangePlan(ExchangePlan& plan) const;
+    void startExchange(ExchangePlan& plan, bool reverse) const;
+    bool testExchange(ExchangePlan& plan) const;
+    const double *finishExchange(ExchangePlan& plan) const;
+    static std::vector<int> NumberOfComponents(const std::vector<MEDCouplingFieldDouble *>& fields);
+    static std::vector<int> NumberOfComponents(const std::vector<const MEDCouplingFieldDouble *>& fields);
+    //! tags not used by the other exchanges on the union communicator (ElementLocator uses 1111-1133, OverlapElementLocator 1140-1145)
+    static const int TAG_DIRECT_EXCHANGE=1150;
+    static const int TAG_REVERSE_EXCHANGE=1151;
   private :
     ProcessorGroup* _union_group;
     MPIAccessDEC * _access_DEC;
@@ -63,6 +94,10 @@ namespace MEDCoupling
     std::vector<mcIdType> _recv_ids;
     std::vector<int> _send_proc_offsets;
     std::vector<int> _recv_proc_offsets;
+    //! position in the packed send buffer (sorted by proc) of each item of _sending_ids, computed by prepareSendRecv
+    std::vector<int> _send_positions;
+    mutable ExchangePlan _direct_plan;
+    mutable ExchangePlan _reverse_plan;
   };
 
   std::ostream & operator<< (std::ostream &,const AllToAllMethod &);
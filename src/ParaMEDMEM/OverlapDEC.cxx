@@ -25,6 +25,7 @@
 #include "MPIProcessorGroup.hxx"
 #include "OverlapElementLocator.hxx"
 #include "OverlapInterpolationMatrix.hxx"
+#include "InterpKernelThreads.hxx"
 #include "ICoCoMEDDoubleField.hxx"
 
 namespace MEDCoupling
@@ -126,21 +127,15 @@ namespace MEDCoupling
     if (_target_field->getField()->getNumberOfComponents() != _source_field->getField()->getNumberOfComponents())
       throw INTERP_KERNEL::Exception("OverlapDEC::synchronize(): source and target field have different number of components!");
     delete _interpolation_matrix;
-    _locator = new OverlapElementLocator(_source_field,_target_field,*_group, getBoundingBoxAdjustmentAbs(), _load_balancing_algo);
+    _locator = new OverlapElementLocator(_source_field,_target_field,*_group, getBoundingBoxAdjustmentAbs(), _load_balancing_algo,
+                                         INTERP_KERNEL::EffectiveNumberOfThreads(getNbThreads()));
     _interpolation_matrix=new OverlapInterpolationMatrix(_source_field,_target_field,*_group,*this,*this, *_locator);
     _locator->copyOptions(*this);
-    _locator->exchangeMeshes(*_interpolation_matrix);
-    std::vector< std::pair<int,int> > jobs=_locator->getToDoList();
-    std::string srcMeth=_locator->getSourceMethod();
-    std::string trgMeth=_locator->getTargetMethod();
-    for(std::vector< std::pair<int,int> >::const_iterator it=jobs.begin();it!=jobs.end();it++)
-      {
-        const MEDCouplingPointSet *src=_locator->getSourceMesh((*it).first);
-        const DataArrayIdType *srcIds=_locator->getSourceIds((*it).first);
-        const MEDCouplingPointSet *trg=_locator->getTargetMesh((*it).second);
-        const DataArrayIdType *trgIds=_locator->getTargetIds((*it).second);
-        _interpolation_matrix->computeLocalIntersection(src,srcIds,srcMeth,(*it).first,trg,trgIds,trgMeth,(*it).second);
-      }
+    // the meshes are exchanged in the background : each intersection is computed as soon as its source and target meshes are available
+    _locator->postMeshesExchange(*_interpolation_matrix);
+    std::vector< std::pair<int,int> > jobs;
+    while(_locator->waitForReadyJobs(jobs))
+      _interpolation_matrix->computeLocalIntersections(*_locator,jobs);
     _interpolation_matrix->prepare(_locator->getProcsToSendFieldData());
     _interpolation_matrix->computeSurfacesAndDeno();
   }
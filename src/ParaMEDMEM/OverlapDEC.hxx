@@ -192,7 +192,13 @@ namespace MEDCoupling
 
       The interpolation is performed as the \ref MEDCoupling::MEDCouplingRemapper "remapper" does.
 
-      This operation is performed by OverlapInterpolationMatrix::addContribution method.
+      This operation is performed by OverlapInterpolationMatrix::computeLocalIntersections method.
+
+      When the \c NbThreads interpolation option is not 1 (see INTERP_KERNEL::InterpolationOptions::setNbThreads), the couples
+      of the \b local TODO list whose meshes are available are intersected concurrently by the threads of the proc, each
+      couple by one thread. A single couple is intersected using all the threads. The number of threads of each proc is
+      taken into account by the load balancing of \ref ParaMEDMEMOverlapDECAlgoStep2 "Step2" (work sharing algorithms 1 and 2),
+      so that a proc running 32 threads is given more couples than a proc running one.
 
       \subsection ParaMEDMEMOverlapDECAlgoStep5 Step 5 : Global matrix construction.
 
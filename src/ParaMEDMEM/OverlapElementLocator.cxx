@@ -28,12 +28,14 @@
 #include "ProcessorGroup.hxx"
 #include "MPIProcessorGroup.hxx"
 #include "OverlapInterpolationMatrix.hxx"
+#include "DomainBoundingBoxes.hxx"
 #include "MEDCouplingFieldDouble.hxx"
 #include "MEDCouplingFieldDiscretization.hxx"
 #include "DirectedBoundingBox.hxx"
 #include "InterpKernelAutoPtr.hxx"
 
 #include <limits>
+#include <algorithm>
 
 using namespace std;
 
@@ -42,7 +44,7 @@ namespace MEDCoupling
   const int OverlapElementLocator::START_TAG_MESH_XCH = 1140;
 
   OverlapElementLocator::OverlapElementLocator(const ParaFIELD *sourceField, const ParaFIELD *targetField,
-                                               const ProcessorGroup& group, double epsAbs, int workSharingAlgo)
+                                               const ProcessorGroup& group, double epsAbs, int workSharingAlgo, int nbThreads)
     : _local_source_field(sourceField),
       _local_target_field(targetField),
       _local_source_mesh(0),
@@ -58,6 +60,7 @@ namespace MEDCoupling
     _comm=getCommunicator();
 
     computeBoundingBoxesAndInteractionList();
+    gatherNumberOfThreads(nbThreads);
     switch(workSharingAlgo)
     {
       case 0:
@@ -75,6 +78,15 @@ namespace MEDCoupling
 
   OverlapElementLocator::~OverlapElementLocator()
   {
+    CommInterface comInterface=_group.getCommInterface();
+    for (MPI_Request& req: _recv_requests)
+      if(req!=MPI_REQUEST_NULL)
+        {
+          MPI_Status status;
+          comInterface.cancel(&req);
+          comInterface.wait(&req,&status);
+        }
+    completeSends();
     delete [] _domain_bounding_boxes;
   }
 
@@ -84,6 +96,20 @@ namespace MEDCoupling
     return group->getComm();
   }
 
+  /*!
+   * Gathers the number of threads \a nbThreads used by each proc to compute its interpolation couples, so that the work sharing
+   * gives more couples to the procs having more threads.
+   */
+  void OverlapElementLocator::gatherNumberOfThreads(int nbThreads)
+  {
+    CommInterface comm_interface=_group.getCommInterface();
+    int nbThreadsLoc(std::max(nbThreads,1));
+    _nb_threads_per_proc.resize(_group.size());
+    comm_interface.allGather(&nbThreadsLoc, 1, MPI_INT,
+                             &_nb_threads_per_proc[0], 1, MPI_INT,
+                             *_comm);
+  }
+
   void OverlapElementLocator::computeBoundingBoxesAndInteractionList()
   {
     CommInterface comm_interface=_group.getCommInterface();
@@ -95,30 +121,19 @@ namespace MEDCoupling
       _local_space_dim=_local_target_mesh->getSpaceDimension();
     //
     const MPI_Comm* comm = group->getComm();
-    int bbSize=2*2*_local_space_dim;//2 (for source/target) 2 (min/max)
+    int domainSize=DomainBoundingBoxes::GetDataSize(_local_space_dim);
+    int bbSize=2*domainSize;//2 (for source/target)
     _domain_bounding_boxes=new double[bbSize*_group.size()];
     INTERP_KERNEL::AutoPtr<double> minmax=new double[bbSize];
-    //Format minmax : Xmin_src,Xmax_src,Ymin_src,Ymax_src,Zmin_src,Zmax_src,Xmin_trg,Xmax_trg,Ymin_trg,Ymax_trg,Zmin_trg,Zmax_trg
+    //Format minmax : boxes of the source domain then boxes of the target domain, see DomainBoundingBoxes
     if(_local_source_mesh)
-      _local_source_mesh->getBoundingBox(minmax);
+      DomainBoundingBoxes::Fill(_local_source_mesh,_local_space_dim,minmax);
     else
-      {
-        for(int i=0;i<_local_space_dim;i++)
-          {
-            minmax[i*2]=std::numeric_limits<double>::max();
-            minmax[i*2+1]=-std::numeric_limits<double>::max();
-          }
-      }
+      DomainBoundingBoxes::FillEmpty(_local_space_dim,minmax);
     if(_local_target_mesh)
-      _local_target_mesh->getBoundingBox(minmax+2*_local_space_dim);
+      DomainBoundingBoxes::Fill(_local_target_mesh,_local_space_dim,minmax+domainSize);
     else
-      {
-        for(int i=0;i<_local_space_dim;i++)
-          {
-            minmax[i*2+2*_local_space_dim]=std::numeric_limits<double>::max();
-            minmax[i*2+1+2*_local_space_dim]=-std::numeric_limits<double>::max();
-          }
-      }
+      DomainBoundingBoxes::FillEmpty(_local_space_dim,minmax+domainSize);
     comm_interface.allGather(minmax, bbSize, MPI_DOUBLE,
                              _domain_bounding_boxes,bbSize, MPI_DOUBLE, 
                              *comm);
@@ -170,6 +185,7 @@ namespace MEDCoupling
    *    + select the job (i,j) for which proc#j is the less loaded
    *    + remove this job from proc#i, and mark it as 'unremovable' from proc#j
    *  - repeat until no more duplicates are found
+   * The load of a proc is its number of jobs divided by its number of threads (see gatherNumberOfThreads).
    */
   void OverlapElementLocator::computeTodoList_new(bool revertIter)
   {
@@ -219,12 +235,13 @@ namespace MEDCoupling
     //
     while (find((bool *)proc_valid, proc_valid+grp_size, true) != proc_valid+grp_size) // as long as proc_valid is not full of 'false'
       {
-        // Most loaded proc:
-        int max_sz = -1, max_id = -1;
+        // Most loaded proc, the load of a proc being its number of jobs per thread:
+        double max_sz = -1.;
+        int max_id = -1;
         int procID = 0;
         for(const auto& a_set: full_set)
           {
-            int sz = (int)a_set.size();
+            double sz = (double)a_set.size()/_nb_threads_per_proc[procID];
             if (proc_valid[procID] && sz > max_sz)
               {
                 max_sz = sz;
@@ -234,29 +251,37 @@ namespace MEDCoupling
           }
 
         // Nothing more to do:
-        if (max_sz == -1) break;
+        if (max_id == -1) break;
         // For this proc, job with less loaded second proc:
-        int min_sz = infinity;
+        double min_sz = std::numeric_limits<double>::max();
         map<ProcCouple, int> & max_map = full_set[max_id];
         ProcCouple hit_cpl = make_pair(-1,-1);
+        // load per thread of the other proc of a job, infinity for an unremovable job
+        auto loadOfOtherProc = [&](const pair<const ProcCouple, int>& job)
+          {
+            if (job.second == infinity)
+              return std::numeric_limits<double>::max();
+            int otherProcID = job.first.first == max_id ? job.first.second : job.first.first;
+            return (double)job.second/_nb_threads_per_proc[otherProcID];
+          };
         if(revertIter)
           {
           // Use a reverse iterator here increases our chances to hit a couple of the form (i, myProcId)
           // meaning that the final matrix computed won't have to be sent: save some comm.
           for(auto ritMap=max_map.rbegin(); ritMap != max_map.rend(); ritMap++)
-            if ((*ritMap).second < min_sz)
+            if (loadOfOtherProc(*ritMap) < min_sz)
               {
                 hit_cpl = (*ritMap).first;
-                min_sz = (*ritMap).second;
+                min_sz = loadOfOtherProc(*ritMap);
               }
           }
         else
           {
             for(const auto& mapIt : max_map)
-              if (mapIt.second < min_sz)
+              if (loadOfOtherProc(mapIt) < min_sz)
                 {
                   hit_cpl = mapIt.first;
-                  min_sz = mapIt.second;
+                  min_sz = loadOfOtherProc(mapIt);
                 }
           }
         if (hit_cpl.first == -1)
@@ -358,43 +383,82 @@ namespace MEDCoupling
 
   /*!
    * The aim of this method is to perform the communication to get data corresponding to '_to_do_list' attribute.
-   * The principle is the following : if proc n1 and n2 need to perform a cross sending with n1<n2, then n1 will send first and receive then.
+   * All the sends and receptions are posted at once (see postMeshesExchange), then this method waits for all of them.
+   * Use postMeshesExchange and waitForReadyJobs instead to start the intersections as soon as their meshes are received.
    */
   void OverlapElementLocator::exchangeMeshes(OverlapInterpolationMatrix& matrix)
+  {
+    postMeshesExchange(matrix);
+    while(progressReceptions());
+    completeSends();
+  }
+
+  /*!
+   * Posts the non blocking sends of the local meshes to the procs of _procs_to_send_mesh and the non blocking receptions of the remote meshes
+   * needed by '_to_do_list', and returns without waiting. As all the communications are posted at once, no ordering between procs is needed
+   * to avoid deadlocks.
+   * The meshes are then received by waitForReadyJobs, which gives the jobs of '_to_do_list' as soon as their meshes are available.
+   */
+  void OverlapElementLocator::postMeshesExchange(OverlapInterpolationMatrix& matrix)
   {
     int myProcId=_group.myRank();
-    //starting to receive every procs whose id is lower than myProcId.
-    std::vector<Proc_SrcOrTgt> firstRcv, secondRcv;
+    std::vector<Proc_SrcOrTgt> toRcv;
     for (const ProcCouple& pc: _to_do_list)
       {
         if(pc.first == pc.second) continue; // no xchg needed
 
         if(pc.first==myProcId)
-          {
-            if(pc.second<myProcId)      firstRcv.push_back(Proc_SrcOrTgt(pc.second,false));
-            else                        secondRcv.push_back(Proc_SrcOrTgt(pc.second, false));
-          }
-        else
-          {//pc.second==myProcId
-            if(pc.first<myProcId)       firstRcv.push_back(Proc_SrcOrTgt(pc.first,true));
-            else                        secondRcv.push_back(Proc_SrcOrTgt(pc.first,true));
-          }
+          toRcv.push_back(Proc_SrcOrTgt(pc.second,false));
+        else//pc.second==myProcId
+          toRcv.push_back(Proc_SrcOrTgt(pc.first,true));
+      }
+    std::sort(toRcv.begin(), toRcv.end());
+    toRcv.erase(std::unique(toRcv.begin(), toRcv.end()), toRcv.end());
+    // Receptions first, so that the buffers are ready when the data arrives
+    _recv_buffers.clear();
+    _recv_buffers.resize(toRcv.size());
+    _recv_requests.assign(3*toRcv.size(),MPI_REQUEST_NULL);
+    for (std::size_t i=0; i<toRcv.size(); i++)
+      {
+        _recv_buffers[i]._key=toRcv[i];
+        postReceiveRemoteMeshFrom(i);
       }
-    // Actual receiving, in order please to avoid deadlocks!
-    std::sort(firstRcv.begin(), firstRcv.end());
-    for (const Proc_SrcOrTgt& pst: firstRcv)
-      receiveRemoteMeshFrom(pst.first, pst.second);
-
-    // Sending source or target mesh to remote procs (_procs_to_send_mesh is sorted too!)
     for (const Proc_SrcOrTgt& pst: _procs_to_send_mesh)
       sendLocalMeshTo(pst.first, pst.second,matrix);
+    _pending_jobs=_to_do_list;
+  }
 
-    // Actual 2nd receiving, in order again please to avoid deadlocks!
-    std::sort(secondRcv.begin(), secondRcv.end());
-    for (const Proc_SrcOrTgt& pst: secondRcv)
-      receiveRemoteMeshFrom(pst.first, pst.second);
+  /*!
+   * Gives in \a jobs the jobs of '_to_do_list' whose source and target meshes are available and that were not given yet by a previous call,
+   * waiting for the reception of remote meshes if none is available. The jobs can then be computed while the other meshes are being received.
+   * \return false if all the jobs have already been given. In this case \a jobs is empty and all the sends are completed.
+   */
+  bool OverlapElementLocator::waitForReadyJobs(std::vector< ProcCouple >& jobs)
+  {
+    jobs.clear();
+    while(true)
+      {
+        std::vector< ProcCouple > notReady;
+        for (const ProcCouple& pc: _pending_jobs)
+          {
+            if(isJobReady(pc))
+              jobs.push_back(pc);
+            else
+              notReady.push_back(pc);
+          }
+        _pending_jobs.swap(notReady);
+        if(!jobs.empty())
+          return true;
+        if(_pending_jobs.empty())
+          {
+            completeSends();
+            return false;
+          }
+        if(!progressReceptions())
+          throw INTERP_KERNEL::Exception("OverlapElementLocator::waitForReadyJobs : remote meshes are missing for pending jobs ! Has postMeshesExchange been called ?");
+      }
   }
-  
+
   std::string OverlapElementLocator::getSourceMethod() const
   {
     return _local_source_field->getField()->getDiscretization()->getStringRepr();
@@ -453,26 +517,25 @@ namespace MEDCoupling
 
   bool OverlapElementLocator::intersectsBoundingBox(int isource, int itarget) const
   {
-    const double *source_bb=_domain_bounding_boxes+isource*2*2*_local_space_dim;
-    const double *target_bb=_domain_bounding_boxes+itarget*2*2*_local_space_dim+2*_local_space_dim;
+    return DomainBoundingBoxes::Intersect(getDomainBoundingBoxes(isource,true),getDomainBoundingBoxes(itarget,false),_local_space_dim,_epsAbs);
+  }
 
-    for (int idim=0; idim < _local_space_dim; idim++)
-      {
-        bool intersects = (target_bb[idim*2]<source_bb[idim*2+1]+_epsAbs)
-          && (source_bb[idim*2]<target_bb[idim*2+1]+_epsAbs);
-        if (!intersects)
-          return false; 
-      }
-    return true;
+  //! Boxes describing the source (\a sourceOrTarget true) or target domain of proc \a procId, see DomainBoundingBoxes
+  const double *OverlapElementLocator::getDomainBoundingBoxes(int procId, bool sourceOrTarget) const
+  {
+    int domainSize=DomainBoundingBoxes::GetDataSize(_local_space_dim);
+    return _domain_bounding_boxes+procId*2*domainSize+(sourceOrTarget?0:domainSize);
   }
 
+
   /*!
    * This methods sends (part of) local source if 'sourceOrTarget'==True to proc 'procId'.
    * This methods sends (part of) local target if 'sourceOrTarget'==False to proc 'procId'.
+   * The sends are non blocking, see postSendMesh.
    *
    * This method prepares the matrix too, for matrix assembling and future matrix-vector computation.
    */
-  void OverlapElementLocator::sendLocalMeshTo(int procId, bool sourceOrTarget, OverlapInterpolationMatrix& matrix) const
+  void OverlapElementLocator::sendLocalMeshTo(int procId, bool sourceOrTarget, OverlapInterpolationMatrix& matrix)
   {
 #ifdef DEC_DEBUG
     int rank = _group.myRank();
@@ -488,34 +551,38 @@ namespace MEDCoupling
    const ParaFIELD *field=0;
    if(sourceOrTarget)//source for local mesh but target for distant mesh
      {
-       distant_bb=_domain_bounding_boxes+procId*2*2*_local_space_dim+2*_local_space_dim;
+       distant_bb=getDomainBoundingBoxes(procId,false);
        local_mesh=_local_source_mesh;
        field=_local_source_field;
      }
    else//target for local but source for distant
      {
-       distant_bb=_domain_bounding_boxes+procId*2*2*_local_space_dim;
+       distant_bb=getDomainBoundingBoxes(procId,true);
        local_mesh=_local_target_mesh;
        field=_local_target_field;
      }
-   AutoDAInt elems=local_mesh->getCellsInBoundingBox(distant_bb,getBoundingBoxAdjustment());
+   AutoDAInt elems=DomainBoundingBoxes::GetCellsIn(local_mesh,distant_bb,_local_space_dim,getBoundingBoxAdjustment());
    DataArrayIdType *old2new_map;
    MEDCouplingPointSet *send_mesh=static_cast<MEDCouplingPointSet *>(field->getField()->buildSubMeshData(elems->begin(),elems->end(),old2new_map));
    if(sourceOrTarget)
      matrix.keepTracksOfSourceIds(procId,old2new_map);
    else
      matrix.keepTracksOfTargetIds(procId,old2new_map);
-   sendMesh(procId,send_mesh,old2new_map);
+   postSendMesh(procId,sourceOrTarget,send_mesh,old2new_map);
    send_mesh->decrRef();
    old2new_map->decrRef();
   }
 
   /*!
-   * This method receives source remote mesh on proc 'procId' if sourceOrTarget==True
-   * This method receives target remote mesh on proc 'procId' if sourceOrTarget==False
+   * This method posts the reception of the remote mesh of the buffer #recvId of '_recv_buffers', whose key gives the proc 'procId'
+   * and whether it is its source mesh (sourceOrTarget==True) or its target mesh (sourceOrTarget==False).
+   * Only the header is received for the moment : the receptions of the rest are posted by progressReceptions when it has arrived.
    */
-  void OverlapElementLocator::receiveRemoteMeshFrom(int procId, bool sourceOrTarget)
+  void OverlapElementLocator::postReceiveRemoteMeshFrom(std::size_t recvId)
   {
+    MeshBuffer& buffer(_recv_buffers[recvId]);
+    int procId(buffer._key.first);
+    bool sourceOrTarget(buffer._key.second);
 #ifdef DEC_DEBUG
     int rank = _group.myRank();
     std::string st = sourceOrTarget ? "src" : "tgt";
@@ -523,67 +590,137 @@ namespace MEDCoupling
     scout << "(" << rank << ") RCV part of " << st << " FROM: " << procId;
     std::cout << scout.str() << "\n";
 #endif
-    DataArrayIdType *old2new_map=0;
-    MEDCouplingPointSet *m=0;
-    receiveMesh(procId,m,old2new_map);
-    Proc_SrcOrTgt p(procId,sourceOrTarget);
-    _remote_meshes[p]=m;
-    _remote_elems[p]=old2new_map;
+    buffer._nb_of_pending_messages=3;
+    CommInterface comInterface=_group.getCommInterface();
+    comInterface.Irecv(buffer._header,4,MPI_ID_TYPE,procId,TagOf(sourceOrTarget,0),*_comm,&_recv_requests[3*recvId]);
   }
 
-  void OverlapElementLocator::sendMesh(int procId, const MEDCouplingPointSet *mesh, const DataArrayIdType *idsToSend) const
+  /*!
+   * Serializes \a mesh and \a idsToSend and posts their non blocking sends to 'procId'. The serialized data is kept in _send_buffers
+   * until completeSends.
+   */
+  void OverlapElementLocator::postSendMesh(int procId, bool sourceOrTarget, const MEDCouplingPointSet *mesh, const DataArrayIdType *idsToSend)
   {
     CommInterface comInterface=_group.getCommInterface();
-
-    // First stage : exchanging sizes
     vector<double> tinyInfoLocalD;//tinyInfoLocalD not used for the moment
     vector<mcIdType> tinyInfoLocal;
     vector<string> tinyInfoLocalS;
     mesh->getTinySerializationInformation(tinyInfoLocalD,tinyInfoLocal,tinyInfoLocalS);
-    const MPI_Comm *comm=getCommunicator();
-    //
-    mcIdType lgth[2];
-    lgth[0]=ToIdType(tinyInfoLocal.size());
-    lgth[1]=idsToSend->getNbOfElems();
-    comInterface.send(&lgth,2,MPI_ID_TYPE,procId,START_TAG_MESH_XCH,*_comm);
-    comInterface.send(&tinyInfoLocal[0],(int)tinyInfoLocal.size(),MPI_ID_TYPE,procId,START_TAG_MESH_XCH+1,*comm);
-    //
     DataArrayIdType *v1Local=0;
     DataArrayDouble *v2Local=0;
     mesh->serialize(v1Local,v2Local);
-    comInterface.send(v1Local->getPointer(),(int)v1Local->getNbOfElems(),MPI_ID_TYPE,procId,START_TAG_MESH_XCH+2,*comm);
-    comInterface.send(v2Local->getPointer(),(int)v2Local->getNbOfElems(),MPI_DOUBLE,procId,START_TAG_MESH_XCH+3,*comm);
-    //finished for mesh, ids now
-    comInterface.send(const_cast<mcIdType *>(idsToSend->getConstPointer()),(int)lgth[1],MPI_ID_TYPE,procId,START_TAG_MESH_XCH+4,*comm);
+    AutoDAInt v1LocalAuto(v1Local);
+    MCAuto<DataArrayDouble> v2LocalAuto(v2Local);
     //
-    v1Local->decrRef();
-    v2Local->decrRef();
+    _send_buffers.push_back(MeshBuffer());
+    MeshBuffer& buffer(_send_buffers.back());
+    buffer._key=Proc_SrcOrTgt(procId,sourceOrTarget);
+    buffer._header[0]=ToIdType(tinyInfoLocal.size());
+    buffer._header[1]=idsToSend->getNbOfElems();
+    buffer._header[2]=v1Local?v1Local->getNbOfElems():0;
+    buffer._header[3]=v2Local?v2Local->getNbOfElems():0;
+    buffer._ints.reserve(buffer._header[0]+buffer._header[1]+buffer._header[2]);
+    buffer._ints.insert(buffer._ints.end(),tinyInfoLocal.begin(),tinyInfoLocal.end());
+    if(v1Local)
+      buffer._ints.insert(buffer._ints.end(),v1Local->begin(),v1Local->end());
+    buffer._ints.insert(buffer._ints.end(),idsToSend->begin(),idsToSend->end());
+    if(v2Local)
+      buffer._doubles.assign(v2Local->begin(),v2Local->end());
+    buffer._nb_of_pending_messages=3;
+    //
+    MPI_Request requests[3];
+    comInterface.Isend(buffer._header,4,MPI_ID_TYPE,procId,TagOf(sourceOrTarget,0),*_comm,&requests[0]);
+    comInterface.Isend(buffer._ints.data(),(int)buffer._ints.size(),MPI_ID_TYPE,procId,TagOf(sourceOrTarget,1),*_comm,&requests[1]);
+    comInterface.Isend(buffer._doubles.data(),(int)buffer._doubles.size(),MPI_DOUBLE,procId,TagOf(sourceOrTarget,2),*_comm,&requests[2]);
+    _send_requests.insert(_send_requests.end(),requests,requests+3);
   }
 
-  void OverlapElementLocator::receiveMesh(int procId, MEDCouplingPointSet* &mesh, DataArrayIdType *&ids) const
+  /*!
+   * Waits for the completion of one of the pending receptions. When a header is received, the receptions of the integers and doubles of
+   * the same mesh are posted. When the last message of a mesh is received, the mesh is built and made available (see buildRemoteMesh).
+   * \return false if no reception is pending.
+   */
+  bool OverlapElementLocator::progressReceptions()
   {
-    mcIdType lgth[2];
-    MPI_Status status;
-    const MPI_Comm *comm=getCommunicator();
+    if(_recv_requests.empty())
+      return false;
     CommInterface comInterface=_group.getCommInterface();
-    comInterface.recv(lgth,2,MPI_ID_TYPE,procId,START_TAG_MESH_XCH,*_comm,&status);
-    std::vector<mcIdType> tinyInfoDistant(lgth[0]);
-    ids=DataArrayIdType::New();
-    ids->alloc(lgth[1],1);
-    comInterface.recv(&tinyInfoDistant[0],(int)lgth[0],MPI_ID_TYPE,procId,START_TAG_MESH_XCH+1,*comm,&status);
-    mesh=MEDCouplingPointSet::BuildInstanceFromMeshType((MEDCouplingMeshType)tinyInfoDistant[0]);
+    int index(MPI_UNDEFINED);
+    MPI_Status status;
+    comInterface.waitany((int)_recv_requests.size(),_recv_requests.data(),&index,&status);
+    if(index==MPI_UNDEFINED)
+      return false;
+    std::size_t recvId(index/3);
+    MeshBuffer& buffer(_recv_buffers[recvId]);
+    if(index%3==0)
+      {
+        buffer._ints.resize(buffer._header[0]+buffer._header[1]+buffer._header[2]);
+        buffer._doubles.resize(buffer._header[3]);
+        int procId(buffer._key.first);
+        comInterface.Irecv(buffer._ints.data(),(int)buffer._ints.size(),MPI_ID_TYPE,procId,TagOf(buffer._key.second,1),*_comm,&_recv_requests[index+1]);
+        comInterface.Irecv(buffer._doubles.data(),(int)buffer._doubles.size(),MPI_DOUBLE,procId,TagOf(buffer._key.second,2),*_comm,&_recv_requests[index+2]);
+      }
+    if(--buffer._nb_of_pending_messages==0)
+      buildRemoteMesh(recvId);
+    return true;
+  }
+
+  /*!
+   * Builds the remote mesh and its cell ids from the messages received in _recv_buffers[recvId], and frees the buffer.
+   */
+  void OverlapElementLocator::buildRemoteMesh(std::size_t recvId)
+  {
+    MeshBuffer& buffer(_recv_buffers[recvId]);
+    const mcIdType *ints(buffer._ints.data());
+    std::vector<mcIdType> tinyInfoDistant(ints,ints+buffer._header[0]);
+    AutoMCPointSet mesh(MEDCouplingPointSet::BuildInstanceFromMeshType((MEDCouplingMeshType)tinyInfoDistant[0]));
     std::vector<std::string> unusedTinyDistantSts;
     vector<double> tinyInfoDistantD(1);//tinyInfoDistantD not used for the moment
-    DataArrayIdType *v1Distant=DataArrayIdType::New();
-    DataArrayDouble *v2Distant=DataArrayDouble::New();
+    AutoDAInt v1Distant(DataArrayIdType::New());
+    MCAuto<DataArrayDouble> v2Distant(DataArrayDouble::New());
     mesh->resizeForUnserialization(tinyInfoDistant,v1Distant,v2Distant,unusedTinyDistantSts);
-    comInterface.recv(v1Distant->getPointer(),(int)v1Distant->getNbOfElems(),MPI_ID_TYPE,procId,START_TAG_MESH_XCH+2,*comm,&status);
-    comInterface.recv(v2Distant->getPointer(),(int)v2Distant->getNbOfElems(),MPI_DOUBLE,procId,START_TAG_MESH_XCH+3,*comm,&status);
+    if(v1Distant->isAllocated())
+      std::copy(ints+buffer._header[0],ints+buffer._header[0]+buffer._header[2],v1Distant->getPointer());
+    if(v2Distant->isAllocated())
+      std::copy(buffer._doubles.begin(),buffer._doubles.end(),v2Distant->getPointer());
     mesh->unserialization(tinyInfoDistantD,tinyInfoDistant,v1Distant,v2Distant,unusedTinyDistantSts);
     //finished for mesh, ids now
-    comInterface.recv(ids->getPointer(),(int)lgth[1],MPI_ID_TYPE,procId,1144,*comm,&status);
-    //
-    v1Distant->decrRef();
-    v2Distant->decrRef();
+    AutoDAInt ids(DataArrayIdType::New());
+    ids->alloc(buffer._header[1],1);
+    std::copy(ints+buffer._header[0]+buffer._header[2],ints+buffer._header[0]+buffer._header[2]+buffer._header[1],ids->getPointer());
+    _remote_meshes[buffer._key]=mesh;
+    _remote_elems[buffer._key]=ids;
+    std::vector<mcIdType>().swap(buffer._ints);
+    std::vector<double>().swap(buffer._doubles);
+  }
+
+  bool OverlapElementLocator::isJobReady(const ProcCouple& job) const
+  {
+    int myProcId=_group.myRank();
+    if(job.first!=myProcId && _remote_meshes.find(Proc_SrcOrTgt(job.first,true))==_remote_meshes.end())
+      return false;
+    if(job.second!=myProcId && _remote_meshes.find(Proc_SrcOrTgt(job.second,false))==_remote_meshes.end())
+      return false;
+    return true;
+  }
+
+  /*!
+   * Waits for the completion of the sends posted by postSendMesh and frees their buffers.
+   */
+  void OverlapElementLocator::completeSends()
+  {
+    if(_send_requests.empty())
+      return ;
+    CommInterface comInterface=_group.getCommInterface();
+    std::vector<MPI_Status> status(_send_requests.size());
+    comInterface.waitall((int)_send_requests.size(),_send_requests.data(),status.data());
+    _send_requests.clear();
+    _send_buffers.clear();
+  }
+
+  //! tag of the message \a stage (0 header, 1 integers, 2 doubles) of a source (\a sourceOrTarget true) or target mesh
+  int OverlapElementLocator::TagOf(bool sourceOrTarget, int stage)
+  {
+    return START_TAG_MESH_XCH+(sourceOrTarget?0:3)+stage;
   }
 }
@@ -29,6 +29,7 @@
 
 #include <mpi.h>
 #include <vector>
+#include <list>
 #include <map>
 #include <set>
 
@@ -46,10 +47,12 @@ namespace MEDCoupling
   {
   public:
     OverlapElementLocator(const ParaFIELD *sourceField, const ParaFIELD *targetField, const ProcessorGroup& group,
-                          double epsAbs, int workSharingAlgo);
+                          double epsAbs, int workSharingAlgo, int nbThreads=1);
     virtual ~OverlapElementLocator();
     const MPI_Comm *getCommunicator() const;
     void exchangeMeshes(OverlapInterpolationMatrix& matrix);
+    void postMeshesExchange(OverlapInterpolationMatrix& matrix);
+    bool waitForReadyJobs(std::vector< ProcCouple >& jobs);
     std::vector< std::pair<int,int> > getToDoList() const { return _to_do_list; }
     std::vector< int > getProcsToSendFieldData() const { return _procs_to_send_field; }  // same set as the set of procs we sent mesh data to
     std::string getSourceMethod() const;
@@ -64,17 +67,36 @@ namespace MEDCoupling
     void computeBoundingBoxesAndInteractionList();
     void computeTodoList_original();
     void computeTodoList_new(bool revertIter);
+    void gatherNumberOfThreads(int nbThreads);
     void fillProcToSend();
     bool intersectsBoundingBox(int i, int j) const;
-    void sendLocalMeshTo(int procId, bool sourceOrTarget, OverlapInterpolationMatrix& matrix) const;
-    void receiveRemoteMeshFrom(int procId, bool sourceOrTarget);
-    void sendMesh(int procId, const MEDCouplingPointSet *mesh, const DataArrayIdType *idsToSend) const;
-    void receiveMesh(int procId, MEDCouplingPointSet* &mesh, DataArrayIdType *&ids) const;
+    const double *getDomainBoundingBoxes(int procId, bool sourceOrTarget) const;
+    void sendLocalMeshTo(int procId, bool sourceOrTarget, OverlapInterpolationMatrix& matrix);
+    void postReceiveRemoteMeshFrom(std::size_t recvId);
+    void postSendMesh(int procId, bool sourceOrTarget, const MEDCouplingPointSet *mesh, const DataArrayIdType *idsToSend);
+    bool progressReceptions();
+    void buildRemoteMesh(std::size_t recvId);
+    bool isJobReady(const ProcCouple& job) const;
+    void completeSends();
+    static int TagOf(bool sourceOrTarget, int stage);
   private:
     typedef MCAuto< MEDCouplingPointSet >  AutoMCPointSet;
     typedef MCAuto< DataArrayIdType >      AutoDAInt;
     typedef std::pair<int,bool>  Proc_SrcOrTgt;  ///< a key indicating a proc ID and whether the data is for source mesh/field or target mesh/field
 
+    /*! A mesh in transit. It is exchanged in 3 messages : the header (sizes of the following messages), the integers (tiny information,
+     * serialized connectivity and ids of the cells) and the doubles (coordinates). */
+    struct MeshBuffer
+    {
+      Proc_SrcOrTgt _key;
+      //! size of the tiny information, number of ids, size of the serialized connectivity, number of doubles
+      mcIdType _header[4];
+      std::vector<mcIdType> _ints;
+      std::vector<double> _doubles;
+      //! number of messages of the mesh not received yet
+      int _nb_of_pending_messages;
+    };
+
     static const int START_TAG_MESH_XCH;
 
     const ParaFIELD *_local_source_field;
@@ -89,6 +111,8 @@ namespace MEDCoupling
     std::vector< std::vector< int > > _proc_pairs;
     //! todo lists per proc
     std::vector< std::vector< ProcCouple > > _all_todo_lists;
+    //! number of threads computing the interpolation couples, for each proc of _group
+    std::vector< int > _nb_threads_per_proc;
     //! list of interpolation couples to be done by this proc only. This is a simple extraction of the member above _all_todo_lists
     std::vector< ProcCouple > _to_do_list;
     //! list of procs the local proc will have to send mesh data to:
@@ -101,14 +125,23 @@ namespace MEDCoupling
     std::map< Proc_SrcOrTgt,  AutoMCPointSet > _remote_meshes;
     //! Set of cell ID mappings for the above distant meshes (because only part of the meshes are exchanged)
     std::map< Proc_SrcOrTgt, AutoDAInt > _remote_elems;
-    //! Bounding boxes (for source and target) for **all** procs.
-    //! Format minmax : Xmin_src,Xmax_src,Ymin_src,Ymax_src,Zmin_src,Zmax_src,Xmin_trg,Xmax_trg,Ymin_trg,Ymax_trg,Zmin_trg,Zmax_trg
+    //! Boxes describing the domains (for source and target) for **all** procs.
+    //! Format : boxes of the source domain then boxes of the target domain, see DomainBoundingBoxes and getDomainBoundingBoxes
     double* _domain_bounding_boxes;
     //! bounding box absolute adjustment
     double _epsAbs;
 
     std::vector<int> _distant_proc_ids;
 
+    //! meshes being sent, kept alive until their sends complete. A list, as the buffers must not move once the sends are posted.
+    std::list< MeshBuffer > _send_buffers;
+    std::vector< MPI_Request > _send_requests;
+    //! meshes being received, and their 3 requests each (header, integers, doubles) in _recv_requests
+    std::vector< MeshBuffer > _recv_buffers;
+    std::vector< MPI_Request > _recv_requests;
+    //! jobs of _to_do_list not yet given by waitForReadyJobs
+    std::vector< ProcCouple > _pending_jobs;
+
     const ProcessorGroup& _group;
     const MPI_Comm *_comm;
   };
@@ -38,6 +38,8 @@
 #include "NormalizedUnstructuredMesh.hxx"
 #include "ElementLocator.hxx"
 #include "InterpKernelAutoPtr.hxx"
+#include "InterpKernelThreads.hxx"
+#include "OverlapElementLocator.hxx"
 
 #include <algorithm>
 
@@ -86,11 +88,67 @@ namespace MEDCoupling
    */
   void OverlapInterpolationMatrix::computeLocalIntersection(const MEDCouplingPointSet *src, const DataArrayIdType *srcIds, const std::string& srcMeth, int srcProcId,
                                                    const MEDCouplingPointSet *trg, const DataArrayIdType *trgIds, const std::string& trgMeth, int trgProcId)
+  {
+    vector<SparseDoubleVec > sparse_matrix_part;
+    computeLocalMatrix(*this,src,srcMeth,trg,trgMeth,sparse_matrix_part);
+    /* Fill distributed matrix:
+       In sparse_matrix_part rows refer to target, and columns (=first param of map in SparseDoubleVec)
+       refer to source.
+     */
+    _mapping.addContributionST(sparse_matrix_part,srcIds,srcProcId,trgIds,trgProcId);
+  }
+
+  /**!
+   * Local run (on this proc) of the intersections of the (source proc, target proc) couples \a jobs, whose meshes are given by \a locator.
+   *
+   * When the NbThreads option is not 1 and there are several jobs, the jobs are dealt to the threads, each one intersecting its couples
+   * sequentially. Otherwise the couples are intersected one after the other, each one using the threads of the interpolator.
+   * The contributions are always added to the matrix in the order of \a jobs, so that the result does not depend on the number of threads.
+   */
+  void OverlapInterpolationMatrix::computeLocalIntersections(const OverlapElementLocator& locator, const std::vector< std::pair<int,int> >& jobs)
+  {
+    std::string srcMeth=locator.getSourceMethod();
+    std::string trgMeth=locator.getTargetMethod();
+    unsigned int nbThreads(INTERP_KERNEL::EffectiveNumberOfThreads(getNbThreads()));
+    if(nbThreads<=1 || jobs.size()<2)
+      {
+        for(std::vector< std::pair<int,int> >::const_iterator it=jobs.begin();it!=jobs.end();it++)
+          computeLocalIntersection(locator.getSourceMesh((*it).first),locator.getSourceIds((*it).first),srcMeth,(*it).first,
+                                   locator.getTargetMesh((*it).second),locator.getTargetIds((*it).second),trgMeth,(*it).second);
+        return ;
+      }
+    // each job is run by a single thread
+    INTERP_KERNEL::InterpolationOptions opts(*this);
+    opts.setNbThreads(1);
+    // the largest jobs are dealt first to balance the load
+    std::vector<std::size_t> order(jobs.size());
+    std::vector<mcIdType> cost(jobs.size());
+    for(std::size_t i=0;i<jobs.size();i++)
+      {
+        order[i]=i;
+        cost[i]=locator.getSourceMesh(jobs[i].first)->getNumberOfCells()+locator.getTargetMesh(jobs[i].second)->getNumberOfCells();
+      }
+    std::stable_sort(order.begin(),order.end(),[&cost](std::size_t a, std::size_t b) { return cost[a]>cost[b]; });
+    std::vector< vector<SparseDoubleVec > > sparse_matrix_parts(jobs.size());
+    INTERP_KERNEL::ParallelForEachChunk(nbThreads,jobs.size(),[&](unsigned int, std::size_t chunkId)
+      {
+        std::size_t i(order[chunkId]);
+        computeLocalMatrix(opts,locator.getSourceMesh(jobs[i].first),srcMeth,locator.getTargetMesh(jobs[i].second),trgMeth,sparse_matrix_parts[i]);
+      });
+    for(std::size_t i=0;i<jobs.size();i++)
+      _mapping.addContributionST(sparse_matrix_parts[i],locator.getSourceIds(jobs[i].first),jobs[i].first,locator.getTargetIds(jobs[i].second),jobs[i].second);
+  }
+
+  /**!
+   * Computes in \a sparse_matrix_part the interpolation matrix between \a src and \a trg with the options \a opts.
+   * This method does not modify \a this, so that it can be called concurrently by several threads.
+   */
+  void OverlapInterpolationMatrix::computeLocalMatrix(const INTERP_KERNEL::InterpolationOptions& opts, const MEDCouplingPointSet *src, const std::string& srcMeth,
+                                                      const MEDCouplingPointSet *trg, const std::string& trgMeth, std::vector<SparseDoubleVec>& sparse_matrix_part) const
   {
     std::string interpMethod(srcMeth);
     interpMethod+=trgMeth;
     //creating the interpolator structure
-    vector<SparseDoubleVec > sparse_matrix_part;
     mcIdType colSize=0;
     //computation of the intersection volumes between source and target elements
     const MEDCouplingUMesh *trgC=dynamic_cast<const MEDCouplingUMesh *>(trg);
@@ -100,19 +158,19 @@ namespace MEDCoupling
         if(trgC->getMeshDimension()==2 && trgC->getSpaceDimension()==2)
           {
             MEDCouplingNormalizedUnstructuredMesh<2,2> target_mesh_wrapper(trgC);
-            INTERP_KERNEL::Interpolation2D interpolation(*this);
+            INTERP_KERNEL::Interpolation2D interpolation(opts);
             colSize=interpolation.fromIntegralUniform(target_mesh_wrapper,sparse_matrix_part,trgMeth);
           }
         else if(trgC->getMeshDimension()==3 && trgC->getSpaceDimension()==3)
           {
             MEDCouplingNormalizedUnstructuredMesh<3,3> target_mesh_wrapper(trgC);
-            INTERP_KERNEL::Interpolation3D interpolation(*this);
+            INTERP_KERNEL::Interpolation3D interpolation(opts);
             colSize=interpolation.fromIntegralUniform(target_mesh_wrapper,sparse_matrix_part,trgMeth);
           }
         else if(trgC->getMeshDimension()==2 && trgC->getSpaceDimension()==3)
           {
             MEDCouplingNormalizedUnstructuredMesh<3,2> target_mesh_wrapper(trgC);
-            INTERP_KERNEL::Interpolation3DSurf interpolation(*this);
+            INTERP_KERNEL::Interpolation3DSurf interpolation(opts);
             colSize=interpolation.fromIntegralUniform(target_mesh_wrapper,sparse_matrix_part,trgMeth);
           }
         else
@@ -123,19 +181,19 @@ namespace MEDCoupling
         if(srcC->getMeshDimension()==2 && srcC->getSpaceDimension()==2)
           {
             MEDCouplingNormalizedUnstructuredMesh<2,2> local_mesh_wrapper(srcC);
-            INTERP_KERNEL::Interpolation2D interpolation(*this);
+            INTERP_KERNEL::Interpolation2D interpolation(opts);
             colSize=interpolation.toIntegralUniform(local_mesh_wrapper,sparse_matrix_part,srcMeth);
           }
         else if(srcC->getMeshDimension()==3 && srcC->getSpaceDimension()==3)
           {
             MEDCouplingNormalizedUnstructuredMesh<3,3> local_mesh_wrapper(srcC);
-            INTERP_KERNEL::Interpolation3D interpolation(*this);
+            INTERP_KERNEL::Interpolation3D interpolation(opts);
             colSize=interpolation.toIntegralUniform(local_mesh_wrapper,sparse_matrix_part,srcMeth);
           }
         else if(srcC->getMeshDimension()==2 && srcC->getSpaceDimension()==3)
           {
             MEDCouplingNormalizedUnstructuredMesh<3,2> local_mesh_wrapper(srcC);
-            INTERP_KERNEL::Interpolation3DSurf interpolation(*this);
+            INTERP_KERNEL::Interpolation3DSurf interpolation(opts);
             colSize=interpolation.toIntegralUniform(local_mesh_wrapper,sparse_matrix_part,srcMeth);
           }
         else
@@ -147,7 +205,7 @@ namespace MEDCoupling
         MEDCouplingNormalizedUnstructuredMesh<3,3> target_wrapper(trgC);
         MEDCouplingNormalizedUnstructuredMesh<3,3> source_wrapper(srcC);
         
-        INTERP_KERNEL::Interpolation2D3D interpolator (*this);
+        INTERP_KERNEL::Interpolation2D3D interpolator (opts);
         colSize=interpolator.interpolateMeshes(source_wrapper,target_wrapper,sparse_matrix_part,interpMethod);
       }
     else if ( src->getMeshDimension() == 3 && trg->getMeshDimension() == 2
@@ -156,7 +214,7 @@ namespace MEDCoupling
         MEDCouplingNormalizedUnstructuredMesh<3,3> target_wrapper(trgC);
         MEDCouplingNormalizedUnstructuredMesh<3,3> source_wrapper(srcC);
         
-        INTERP_KERNEL::Interpolation2D3D interpolator (*this);
+        INTERP_KERNEL::Interpolation2D3D interpolator (opts);
         vector<SparseDoubleVec > matrixTranspose;
         colSize=interpolator.interpolateMeshes(target_wrapper,source_wrapper,sparse_matrix_part,interpMethod);//not a bug target in source.
         TransposeMatrix(matrixTranspose,colSize,sparse_matrix_part);
@@ -168,7 +226,7 @@ namespace MEDCoupling
         MEDCouplingNormalizedUnstructuredMesh<2,2> target_wrapper(trgC);
         MEDCouplingNormalizedUnstructuredMesh<2,2> source_wrapper(srcC);
         
-        INTERP_KERNEL::Interpolation2D1D interpolator (*this);
+        INTERP_KERNEL::Interpolation2D1D interpolator (opts);
         colSize=interpolator.interpolateMeshes(source_wrapper,target_wrapper,sparse_matrix_part,interpMethod);
       }
     else if ( src->getMeshDimension() == 2 && trg->getMeshDimension() == 1
@@ -177,7 +235,7 @@ namespace MEDCoupling
         MEDCouplingNormalizedUnstructuredMesh<2,2> target_wrapper(trgC);
         MEDCouplingNormalizedUnstructuredMesh<2,2> source_wrapper(srcC);
         
-        INTERP_KERNEL::Interpolation2D1D interpolator (*this);
+        INTERP_KERNEL::Interpolation2D1D interpolator (opts);
         vector<SparseDoubleVec > matrixTranspose;
         colSize=interpolator.interpolateMeshes(target_wrapper,source_wrapper,matrixTranspose,interpMethod);//not a bug target in source.
         TransposeMatrix(matrixTranspose,colSize,sparse_matrix_part);
@@ -193,7 +251,7 @@ namespace MEDCoupling
         MEDCouplingNormalizedUnstructuredMesh<1,1> target_wrapper(trgC);
         MEDCouplingNormalizedUnstructuredMesh<1,1> source_wrapper(srcC);
 
-        INTERP_KERNEL::Interpolation1D interpolation(*this);
+        INTERP_KERNEL::Interpolation1D interpolation(opts);
         colSize=interpolation.interpolateMeshes(source_wrapper,target_wrapper,sparse_matrix_part,interpMethod);
       }
     else if( trg->getMeshDimension() == 1
@@ -202,7 +260,7 @@ namespace MEDCoupling
         MEDCouplingNormalizedUnstructuredMesh<2,1> target_wrapper(trgC);
         MEDCouplingNormalizedUnstructuredMesh<2,1> source_wrapper(srcC);
 
-        INTERP_KERNEL::Interpolation2DCurve interpolation(*this);
+        INTERP_KERNEL::Interpolation2DCurve interpolation(opts);
         colSize=interpolation.interpolateMeshes(source_wrapper,target_wrapper,sparse_matrix_part,interpMethod);
       }
     else if ( trg->getMeshDimension() == 2
@@ -211,7 +269,7 @@ namespace MEDCoupling
         MEDCouplingNormalizedUnstructuredMesh<3,2> target_wrapper(trgC);
         MEDCouplingNormalizedUnstructuredMesh<3,2> source_wrapper(srcC);
 
-        INTERP_KERNEL::Interpolation3DSurf interpolator (*this);
+        INTERP_KERNEL::Interpolation3DSurf interpolator (opts);
         colSize=interpolator.interpolateMeshes(source_wrapper,target_wrapper,sparse_matrix_part,interpMethod);
       }
     else if ( trg->getMeshDimension() == 2
@@ -220,7 +278,7 @@ namespace MEDCoupling
         MEDCouplingNormalizedUnstructuredMesh<2,2> target_wrapper(trgC);
         MEDCouplingNormalizedUnstructuredMesh<2,2> source_wrapper(srcC);
 
-        INTERP_KERNEL::Interpolation2D interpolator (*this);
+        INTERP_KERNEL::Interpolation2D interpolator (opts);
         colSize=interpolator.interpolateMeshes(source_wrapper,target_wrapper,sparse_matrix_part,interpMethod);
       }
     else if ( trg->getMeshDimension() == 3
@@ -229,18 +287,13 @@ namespace MEDCoupling
         MEDCouplingNormalizedUnstructuredMesh<3,3> target_wrapper(trgC);
         MEDCouplingNormalizedUnstructuredMesh<3,3> source_wrapper(srcC);
 
-        INTERP_KERNEL::Interpolation3D interpolator (*this);
+        INTERP_KERNEL::Interpolation3D interpolator (opts);
         colSize=interpolator.interpolateMeshes(source_wrapper,target_wrapper,sparse_matrix_part,interpMethod);
       }
     else
       {
         throw INTERP_KERNEL::Exception("No interpolator exists for these mesh and space dimensions!");
       }
-    /* Fill distributed matrix:
-       In sparse_matrix_part rows refer to target, and columns (=first param of map in SparseDoubleVec)
-       refer to source.
-     */
-    _mapping.addContributionST(sparse_matrix_part,srcIds,srcProcId,trgIds,trgProcId);
   }
 
   /*!
@@ -55,6 +55,8 @@ namespace MEDCoupling
     void computeLocalIntersection(const MEDCouplingPointSet *src, const DataArrayIdType *srcIds, const std::string& srcMeth, int srcProcId,
                          const MEDCouplingPointSet *trg, const DataArrayIdType *trgIds, const std::string& trgMeth, int trgProcId);
 
+    void computeLocalIntersections(const OverlapElementLocator& locator, const std::vector< std::pair<int,int> >& jobs);
+
     void prepare(const std::vector< int > & procsToSendField);
     
     void computeSurfacesAndDeno();
@@ -65,6 +67,8 @@ namespace MEDCoupling
     
     virtual ~OverlapInterpolationMatrix();
   private:
+    void computeLocalMatrix(const INTERP_KERNEL::InterpolationOptions& opts, const MEDCouplingPointSet *src, const std::string& srcMeth,
+                            const MEDCouplingPointSet *trg, const std::string& trgMeth, std::vector<SparseDoubleVec>& sparse_matrix_part) const;
 
     static void TransposeMatrix(const std::vector<SparseDoubleVec>& matIn, mcIdType nbColsMatIn,
                                 std::vector<SparseDoubleVec>& matOut);
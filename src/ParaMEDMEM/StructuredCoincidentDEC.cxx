@@ -28,11 +28,44 @@
 #include "InterpKernelUtilities.hxx"
 
 #include <iostream>
+#include <memory>
 
 using namespace std;
 
 namespace MEDCoupling
 {
+  namespace
+  {
+    /*!
+     * Request of the MPI requests \a requests posted on the buffers of a StructuredCoincidentDEC. \a alive expires when these
+     * buffers are deleted by the DEC, the request then refuses to go on instead of using dangling pointers.
+     */
+    DECRequest BuildBufferRequest(const std::vector<MPI_Request>& requests, const std::weak_ptr<bool>& alive, const std::function<void()>& completion)
+    {
+      auto checkAlive = [alive]()
+        {
+          if(alive.expired())
+            throw INTERP_KERNEL::Exception("DECRequest : the StructuredCoincidentDEC of this request has been released or synchronized again before its completion !");
+        };
+      auto pending(std::make_shared< std::vector<MPI_Request> >(requests));
+      return DECRequest([pending,checkAlive]()
+                        {
+                          checkAlive();
+                          int flag(0);
+                          std::vector<MPI_Status> status(pending->size());
+                          CommInterface().testall((int)pending->size(),pending->data(),&flag,status.data());
+                          return flag!=0;
+                        },
+                        [pending,checkAlive,completion]()
+                        {
+                          checkAlive();
+                          std::vector<MPI_Status> status(pending->size());
+                          CommInterface().waitall((int)pending->size(),pending->data(),status.data());
+                          if(completion)
+                            completion();
+                        });
+    }
+  }
 
   StructuredCoincidentDEC::StructuredCoincidentDEC():_topo_source(nullptr),_topo_target(nullptr),
                                                      _owns_topo_source(false), _owns_topo_target(false),
@@ -62,6 +95,7 @@ namespace MEDCoupling
    */
   void StructuredCoincidentDEC::release()
   {
+    _buffers_alive.reset();
     delete [] _send_buffer;
     delete [] _recv_buffer;
     delete [] _send_displs;
@@ -323,7 +357,13 @@ namespace MEDCoupling
     _comm_interface->allToAllV(_send_buffer, _send_counts, _send_displs, MPI_DOUBLE,
                                _recv_buffer, _recv_counts, _recv_displs, MPI_DOUBLE,comm);
     cout<<"end AllToAll"<<endl;
+    storeReceivedValues();
+  }
 
+  /*! Stores the values of _recv_buffer in the local field, in the order of its elements.
+   */
+  void StructuredCoincidentDEC::storeReceivedValues()
+  {
     mcIdType nb_local = _topo_target->getNbLocalElements();
     //double* value=new double[nb_local];
     double* value=const_cast<double*>(_local_field->getField()->getArray()->getPointer());
@@ -366,6 +406,44 @@ namespace MEDCoupling
     cout<<"end AllToAll"<<endl;
   }
 
+  /*! Receives the data without waiting for the end of the exchange, which is completed by the returned request.
+    It must match an isendData() call on the other side. The local field is updated when the request is completed.
+  */
+  DECRequest StructuredCoincidentDEC::irecvData()
+  {
+    if (!_target_group->containsMyRank())
+      return DECRequest();
+    MPI_Comm comm = *(dynamic_cast<MPIProcessorGroup*>(_union_group)->getComm());
+    std::vector<MPI_Request> requests;
+    for (int i=0; i<_union_group->size(); i++)
+      if (_recv_counts[i]>0)
+        {
+          MPI_Request request;
+          _comm_interface->Irecv(_recv_buffer+_recv_displs[i],_recv_counts[i],MPI_DOUBLE,i,TAG_ASYNCHRONOUS_DATA,comm,&request);
+          requests.push_back(request);
+        }
+    return BuildBufferRequest(requests,_buffers_alive,[this]() { storeReceivedValues(); });
+  }
+
+  /*! Sends the data without waiting for the end of the exchange, which is completed by the returned request.
+    It must match an irecvData() call on the other side.
+  */
+  DECRequest StructuredCoincidentDEC::isendData()
+  {
+    if (!_source_group->containsMyRank())
+      return DECRequest();
+    MPI_Comm comm = *(dynamic_cast<MPIProcessorGroup*>(_union_group)->getComm());
+    std::vector<MPI_Request> requests;
+    for (int i=0; i<_union_group->size(); i++)
+      if (_send_counts[i]>0)
+        {
+          MPI_Request request;
+          _comm_interface->Isend(_send_buffer+_send_displs[i],_send_counts[i],MPI_DOUBLE,i,TAG_ASYNCHRONOUS_DATA,comm,&request);
+          requests.push_back(request);
+        }
+    return BuildBufferRequest(requests,_buffers_alive,std::function<void()>());
+  }
+
   /*! Prepares a DEC for data exchange
 
     This method broadcasts the topologies from source to target
@@ -375,6 +453,7 @@ namespace MEDCoupling
 
   void StructuredCoincidentDEC::synchronize()
   {
+    _buffers_alive.reset();
     if (_source_group->containsMyRank())
       {
         synchronizeTopology();
@@ -385,6 +464,7 @@ namespace MEDCoupling
         synchronizeTopology();
         prepareTargetDE();
       }
+    _buffers_alive = std::make_shared<bool>(true);
     MESSAGE ("sync OK");
   }
 }
@@ -23,6 +23,8 @@
 #include "DisjointDEC.hxx"
 #include "BlockTopology.hxx"
 
+#include <memory>
+
 
 namespace MEDCoupling
 {
@@ -92,12 +94,18 @@ namespace MEDCoupling
     void synchronize();
     void recvData();
     void sendData();
+    DECRequest irecvData();
+    DECRequest isendData();
     void prepareSourceDE();
     void prepareTargetDE();
 
   private :
     void synchronizeTopology();
     void broadcastTopology(BlockTopology*&, int tag);
+    void storeReceivedValues();
+
+    //! tag of the messages of isendData/irecvData
+    static const int TAG_ASYNCHRONOUS_DATA=3000;
 
     BlockTopology* _topo_source;
     BlockTopology* _topo_target;
@@ -111,6 +119,8 @@ namespace MEDCoupling
     int* _recv_displs;
     double* _recv_buffer;
     double* _send_buffer;
+    //! expires when the buffers are deleted, to detect the pending DECRequest that outlive them
+    std::shared_ptr<bool> _buffers_alive;
   };
 }
 
@@ -48,6 +48,8 @@ class ParaMEDMEMTest : public CppUnit::TestFixture
   CPPUNIT_TEST(testInterpKernelDEC2DM1D_P0P0);      // 3 procs
   CPPUNIT_TEST(testInterpKernelDECPartialProcs);    // 3 procs
   CPPUNIT_TEST(testInterpKernelDEC3DSurfEmptyBBox); // 3 procs
+  CPPUNIT_TEST(testInterpKernelDECMultiFields);     // 3 procs
+  CPPUNIT_TEST(testInterpKernelDECAsynchronous);    // 3 procs
   CPPUNIT_TEST(testOverlapDEC1);                    // 3 procs
   CPPUNIT_TEST(testOverlapDEC1_bis);                // 3 procs
   CPPUNIT_TEST(testOverlapDEC1_ter);                // 3 procs
@@ -76,6 +78,7 @@ class ParaMEDMEMTest : public CppUnit::TestFixture
   CPPUNIT_TEST(testNonCoincidentDEC_3D);
 #endif
   CPPUNIT_TEST(testStructuredCoincidentDEC);     // 5 procs
+  CPPUNIT_TEST(testStructuredCoincidentDECAsynchronous);     // 5 procs
   CPPUNIT_TEST(testICoco1);           // 2 procs
   CPPUNIT_TEST(testGauthier1);        // 4 procs
   CPPUNIT_TEST(testGauthier2);        // >= 2 procs
@@ -117,6 +120,8 @@ public:
   void testInterpKernelDEC2DM1D_P0P0();
   void testInterpKernelDECPartialProcs();
   void testInterpKernelDEC3DSurfEmptyBBox();
+  void testInterpKernelDECMultiFields();
+  void testInterpKernelDECAsynchronous();
   void testOverlapDEC1();
   void testOverlapDEC1_bis();
   void testOverlapDEC1_ter();
@@ -133,6 +138,7 @@ public:
   void testNonCoincidentDEC_3D();
 #endif
   void testStructuredCoincidentDEC();
+  void testStructuredCoincidentDECAsynchronous();
   void testSynchronousEqualInterpKernelWithoutInterpNativeDEC_2D();
   void testSynchronousEqualInterpKernelWithoutInterpDEC_2D();
   void testSynchronousEqualInterpKernelDEC_2D();
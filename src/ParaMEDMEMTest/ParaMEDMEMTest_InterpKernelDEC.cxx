@@ -1986,6 +1986,235 @@ void ParaMEDMEMTest::testInterpKernelDECPartialProcs()
   MPI_Barrier(MPI_COMM_WORLD);
 }
 
+/*!
+ * Exchanges two fields (1 and 2 components) in a single message with sendData/recvData taking several fields, in both directions
+ * and twice to reuse the communication plans of the DEC. Proc 0 is the source (a quad), proc 1 the target (2 triangles), proc 2 is idle.
+ */
+void ParaMEDMEMTest::testInterpKernelDECMultiFields()
+{
+  int size;
+  int rank;
+  MPI_Comm_size(MPI_COMM_WORLD,&size);
+  MPI_Comm_rank(MPI_COMM_WORLD,&rank);
+  //
+  if(size!=3)
+    return ;
+  set<int> procs_source;
+  set<int> procs_target;
+  procs_source.insert(0);
+  procs_target.insert(1);
+  //
+  MEDCoupling::CommInterface interface;
+  MPI_Barrier(MPI_COMM_WORLD);
+  double coords[8]={ 0.,0., 1., 0., 0., 1., 1., 1. };
+  // the groups of the DEC have to form a partition of their communicator : proc 2 is left out of it
+  int grpIds[2]={0,1};
+  MPI_Group grp,group_world;
+  interface.commGroup(MPI_COMM_WORLD,&group_world);
+  interface.groupIncl(group_world,2,grpIds,&grp);
+  MPI_Comm partialComm;
+  interface.commCreate(MPI_COMM_WORLD,grp,&partialComm);
+  if(rank==0 || rank==1)
+    {
+      MEDCoupling::MPIProcessorGroup source_group(interface,procs_source,partialComm);
+      MEDCoupling::MPIProcessorGroup target_group(interface,procs_target,partialComm);
+      MCAuto<MEDCouplingUMesh> mesh(MEDCouplingUMesh::New("mesh",2));
+      MCAuto<DataArrayDouble> myCoords(DataArrayDouble::New());
+      myCoords->alloc(4,2);
+      std::copy(coords,coords+8,myCoords->getPointer());
+      mesh->setCoords(myCoords);
+      if(rank==0)
+        {
+          mcIdType conn[4]={0,2,3,1};
+          mesh->allocateCells(1);
+          mesh->insertNextCell(INTERP_KERNEL::NORM_QUAD4,4,conn);
+        }
+      else
+        {
+          mcIdType conn[6]={0,2,1,2,3,1};
+          mesh->allocateCells(2);
+          mesh->insertNextCell(INTERP_KERNEL::NORM_TRI3,3,conn);
+          mesh->insertNextCell(INTERP_KERNEL::NORM_TRI3,3,conn+3);
+        }
+      mesh->finishInsertingCells();
+      MEDCoupling::ComponentTopology comptopo;
+      const ProcessorGroup& local_group(rank==0?static_cast<const ProcessorGroup&>(source_group):target_group);
+      ParaMESH paramesh(mesh,local_group,"mesh");
+      ParaFIELD parafield(ON_CELLS,NO_TIME,&paramesh,comptopo);
+      parafield.getField()->setNature(IntensiveMaximum);
+      MCAuto<MEDCouplingFieldDouble> f2(MEDCouplingFieldDouble::New(ON_CELLS,NO_TIME));
+      f2->setMesh(mesh);
+      MCAuto<DataArrayDouble> arr2(DataArrayDouble::New());
+      arr2->alloc(mesh->getNumberOfCells(),2);
+      arr2->fillWithZero();
+      f2->setArray(arr2);
+      f2->setNature(IntensiveMaximum);
+      std::vector<MEDCouplingFieldDouble *> fields(2);
+      fields[0]=parafield.getField(); fields[1]=f2;
+      //
+      MEDCoupling::InterpKernelDEC dec(source_group,target_group);
+      dec.attachLocalField(&parafield);
+      dec.synchronize();
+      for(int iter=0;iter<2;iter++)
+        {
+          if(rank==0)
+            {
+              parafield.getField()->getArray()->setIJ(0,0,7.+iter);
+              arr2->setIJ(0,0,1.+iter); arr2->setIJ(0,1,2.+iter);
+              dec.sendData(fields);
+            }
+          else
+            {
+              dec.recvData(fields);
+              for(mcIdType i=0;i<2;i++)
+                {
+                  CPPUNIT_ASSERT_DOUBLES_EQUAL(7.+iter,parafield.getField()->getArray()->getIJ(i,0),1e-12);
+                  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.+iter,arr2->getIJ(i,0),1e-12);
+                  CPPUNIT_ASSERT_DOUBLES_EQUAL(2.+iter,arr2->getIJ(i,1),1e-12);
+                }
+            }
+          // reverse direction : the quad receives the mean of the values of the 2 triangles
+          if(rank==0)
+            {
+              dec.recvData(fields);
+              CPPUNIT_ASSERT_DOUBLES_EQUAL(7.5+iter,parafield.getField()->getArray()->getIJ(0,0),1e-12);
+              CPPUNIT_ASSERT_DOUBLES_EQUAL(1.5+iter,arr2->getIJ(0,0),1e-12);
+              CPPUNIT_ASSERT_DOUBLES_EQUAL(4.+iter,arr2->getIJ(0,1),1e-12);
+            }
+          else
+            {
+              parafield.getField()->getArray()->setIJ(1,0,8.+iter);
+              arr2->setIJ(1,0,2.+iter); arr2->setIJ(1,1,6.+iter);
+              dec.sendData(fields);
+            }
+        }
+    }
+  if(partialComm != MPI_COMM_NULL)
+    interface.commFree(&partialComm);
+  interface.groupFree(&grp);
+  interface.groupFree(&group_world);
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
+/*!
+ * Non-blocking exchanges with isendData/irecvData : the receiving side goes on computing (a dummy counter here, standing for the
+ * iterations of a solver) while its request is pending, which is checked by holding the sending side until the request is posted. Proc 0 is the source (a quad), proc 1 the target (2 triangles),
+ * proc 2 is idle.
+ */
+void ParaMEDMEMTest::testInterpKernelDECAsynchronous()
+{
+  int size;
+  int rank;
+  MPI_Comm_size(MPI_COMM_WORLD,&size);
+  MPI_Comm_rank(MPI_COMM_WORLD,&rank);
+  //
+  if(size!=3)
+    return ;
+  set<int> procs_source;
+  set<int> procs_target;
+  procs_source.insert(0);
+  procs_target.insert(1);
+  //
+  MEDCoupling::CommInterface interface;
+  MPI_Barrier(MPI_COMM_WORLD);
+  double coords[8]={ 0.,0., 1., 0., 0., 1., 1., 1. };
+  // the groups of the DEC have to form a partition of their communicator : proc 2 is left out of it
+  int grpIds[2]={0,1};
+  MPI_Group grp,group_world;
+  interface.commGroup(MPI_COMM_WORLD,&group_world);
+  interface.groupIncl(group_world,2,grpIds,&grp);
+  MPI_Comm partialComm;
+  interface.commCreate(MPI_COMM_WORLD,grp,&partialComm);
+  if(rank==0 || rank==1)
+    {
+      MEDCoupling::MPIProcessorGroup source_group(interface,procs_source,partialComm);
+      MEDCoupling::MPIProcessorGroup target_group(interface,procs_target,partialComm);
+      MCAuto<MEDCouplingUMesh> mesh(MEDCouplingUMesh::New("mesh",2));
+      MCAuto<DataArrayDouble> myCoords(DataArrayDouble::New());
+      myCoords->alloc(4,2);
+      std::copy(coords,coords+8,myCoords->getPointer());
+      mesh->setCoords(myCoords);
+      if(rank==0)
+        {
+          mcIdType conn[4]={0,2,3,1};
+          mesh->allocateCells(1);
+          mesh->insertNextCell(INTERP_KERNEL::NORM_QUAD4,4,conn);
+        }
+      else
+        {
+          mcIdType conn[6]={0,2,1,2,3,1};
+          mesh->allocateCells(2);
+          mesh->insertNextCell(INTERP_KERNEL::NORM_TRI3,3,conn);
+          mesh->insertNextCell(INTERP_KERNEL::NORM_TRI3,3,conn+3);
+        }
+      mesh->finishInsertingCells();
+      MEDCoupling::ComponentTopology comptopo;
+      const ProcessorGroup& local_group(rank==0?static_cast<const ProcessorGroup&>(source_group):target_group);
+      ParaMESH paramesh(mesh,local_group,"mesh");
+      ParaFIELD parafield(ON_CELLS,NO_TIME,&paramesh,comptopo);
+      parafield.getField()->setNature(IntensiveMaximum);
+      DataArrayDouble *arr(parafield.getField()->getArray());
+      //
+      MEDCoupling::InterpKernelDEC dec(source_group,target_group);
+      dec.attachLocalField(&parafield);
+      dec.synchronize();
+      // the receiving side posts its request, checks that it is pending and only then lets the other side send, by a "go" message
+      const int goTag(77);
+      int go(0),nbOfWorkIterations(0);
+      MPI_Status status;
+      for(int iter=0;iter<3;iter++)
+        {
+          // source -> target
+          if(rank==0)
+            {
+              MPI_Recv(&go,1,MPI_INT,1,goTag,MPI_COMM_WORLD,&status);
+              arr->setIJ(0,0,7.+iter);
+              DECRequest req(dec.isendData());
+              // the sent values are packed : the field can be modified while the exchange goes on
+              arr->setIJ(0,0,-1.);
+              while(!req.test())
+                ;
+            }
+          else
+            {
+              DECRequest req(dec.irecvData());
+              // nothing has been sent yet : the request is pending and proc 1 computes meanwhile
+              CPPUNIT_ASSERT(!req.test());
+              nbOfWorkIterations++;
+              MPI_Send(&go,1,MPI_INT,0,goTag,MPI_COMM_WORLD);
+              while(!req.test())
+                nbOfWorkIterations++;
+              CPPUNIT_ASSERT(req.isCompleted());
+              CPPUNIT_ASSERT_DOUBLES_EQUAL(7.+iter,arr->getIJ(0,0),1e-12);
+              CPPUNIT_ASSERT_DOUBLES_EQUAL(7.+iter,arr->getIJ(1,0),1e-12);
+            }
+          // target -> source
+          if(rank==0)
+            {
+              DECRequest req(dec.irecvData());
+              CPPUNIT_ASSERT(!req.test());
+              nbOfWorkIterations++;
+              MPI_Send(&go,1,MPI_INT,1,goTag,MPI_COMM_WORLD);
+              req.wait();
+              CPPUNIT_ASSERT_DOUBLES_EQUAL(7.+iter,arr->getIJ(0,0),1e-12);
+            }
+          else
+            {
+              MPI_Recv(&go,1,MPI_INT,0,goTag,MPI_COMM_WORLD,&status);
+              DECRequest req(dec.isendData());
+              // the destructor of the request waits for the end of the exchange
+            }
+        }
+      // each side has computed at least once per received field while its exchange was pending
+      CPPUNIT_ASSERT(nbOfWorkIterations>=3);
+    }
+  if(partialComm != MPI_COMM_NULL)
+    interface.commFree(&partialComm);
+  interface.groupFree(&grp);
+  interface.groupFree(&group_world);
+  MPI_Barrier(MPI_COMM_WORLD);
+}
+
 /*!
  * This test reproduces bug of Gauthier on 13/9/2010 concerning 3DSurf meshes.
  * It is possible to lead to dead lock in InterpKernelDEC when 3DSurfMeshes global bounding boxes intersects whereas cell bounding box intersecting only on one side.
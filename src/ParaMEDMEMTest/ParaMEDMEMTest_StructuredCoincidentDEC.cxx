@@ -54,10 +54,15 @@ using namespace MEDCoupling;
  void synchronize();
  void recvData();
  void sendData();
+ DECRequest irecvData();
+ DECRequest isendData();
 */
 
-void ParaMEDMEMTest::testStructuredCoincidentDEC() {
-  string testname="ParaMEDMEM - testStructured CoincidentDEC";
+/*!
+ * Exchange of a field split on 3 procs towards 2 procs holding a part of its components each,
+ * by sendData/recvData or by their non-blocking counterparts isendData/irecvData if \a asynchronous.
+ */
+static void CheckStructuredCoincidentDEC(bool asynchronous) {
   //  MPI_Init(&argc, &argv); 
   int size;
   int rank;
@@ -118,7 +123,13 @@ void ParaMEDMEMTest::testStructuredCoincidentDEC() {
 
     dec.attachLocalField(parafield);
     dec.synchronize();
-    dec.sendData();
+    if (asynchronous) {
+      DECRequest req(dec.isendData());
+      req.wait();
+      CPPUNIT_ASSERT(req.isCompleted());
+    }
+    else
+      dec.sendData();
     //delete icocofield;
   }
 
@@ -142,7 +153,16 @@ void ParaMEDMEMTest::testStructuredCoincidentDEC() {
 
     dec.attachLocalField(parafield);
     dec.synchronize();
-    dec.recvData();
+    if (asynchronous) {
+      DECRequest req(dec.irecvData());
+      // the received values are stored in the field only on completion
+      for (int i=0; i<nb_local*comptopo.nbLocalComponents(); i++)
+        CPPUNIT_ASSERT_DOUBLES_EQUAL(0.,value[i],1e-12);
+      while (!req.test())
+        ;
+    }
+    else
+      dec.recvData();
 
     //checking validity of field
     const double* recv_value = parafield->getField()->getArray()->getPointer();
@@ -160,3 +180,11 @@ void ParaMEDMEMTest::testStructuredCoincidentDEC() {
   //  MPI_Barrier(MPI_COMM_WORLD);
 
 }
+
+void ParaMEDMEMTest::testStructuredCoincidentDEC() {
+  CheckStructuredCoincidentDEC(false);
+}
+
+void ParaMEDMEMTest::testStructuredCoincidentDECAsynchronous() {
+  CheckStructuredCoincidentDEC(true);
+}
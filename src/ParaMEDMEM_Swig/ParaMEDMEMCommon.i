@@ -46,6 +46,12 @@ using namespace MEDCoupling;
 using namespace ICoCo;
 %}
 
+// the completion handles of the non-blocking exchanges are move-only : not wrapped
+%ignore MEDCoupling::DisjointDEC::irecvData;
+%ignore MEDCoupling::DisjointDEC::isendData;
+%ignore MEDCoupling::StructuredCoincidentDEC::irecvData;
+%ignore MEDCoupling::StructuredCoincidentDEC::isendData;
+
 %include "InterpolationOptions.hxx"
 %include "ProcessorGroup.hxx"
 %include "DECOptions.hxx"